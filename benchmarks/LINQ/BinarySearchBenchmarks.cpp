@@ -0,0 +1,97 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <vector>
+
+#include <ExtendedCpp/LINQ/Algorithm.h>
+#include <ExtendedCpp/LINQ/SortedIndex.h>
+
+constexpr std::size_t LOOKUP_KEYS_COUNT = 4096;
+
+std::vector<int> GenerateSortedNumbers(const std::size_t count) noexcept
+{
+    std::vector<int> result(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+        result[i] = static_cast<int>(i * 2);
+
+    return result;
+}
+
+// Keys are spread over the whole collection, so the most of searches miss the cache.
+std::vector<int> GenerateLookupKeys(const std::size_t collectionSize) noexcept
+{
+    std::vector<int> result(LOOKUP_KEYS_COUNT);
+
+    std::size_t state = 1;
+    for (std::size_t i = 0; i < LOOKUP_KEYS_COUNT; ++i)
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        result[i] = static_cast<int>((state >> 33) % (collectionSize * 2));
+    }
+
+    return result;
+}
+
+template<typename ...Args>
+void StdLowerBoundBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector numbers = GenerateSortedNumbers(std::get<0>(argsTuple));
+    const std::vector keys = GenerateLookupKeys(numbers.size());
+    for ([[maybe_unused]] auto _ : state)
+        for (const int key : keys)
+            benchmark::DoNotOptimize(std::lower_bound(numbers.begin(), numbers.end(), key));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+BENCHMARK_CAPTURE(StdLowerBoundBenchmark, intSize1000, std::size_t(1000));
+BENCHMARK_CAPTURE(StdLowerBoundBenchmark, intSize1000000, std::size_t(1000000));
+BENCHMARK_CAPTURE(StdLowerBoundBenchmark, intSize64000000, std::size_t(64000000));
+
+template<typename ...Args>
+void LowerBoundBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector numbers = GenerateSortedNumbers(std::get<0>(argsTuple));
+    const std::vector keys = GenerateLookupKeys(numbers.size());
+    for ([[maybe_unused]] auto _ : state)
+        for (const int key : keys)
+            benchmark::DoNotOptimize(ExtendedCpp::LINQ::Algorithm::LowerBound(key, numbers.data(), 0, numbers.size() - 1));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+BENCHMARK_CAPTURE(LowerBoundBenchmark, intSize1000, std::size_t(1000));
+BENCHMARK_CAPTURE(LowerBoundBenchmark, intSize1000000, std::size_t(1000000));
+BENCHMARK_CAPTURE(LowerBoundBenchmark, intSize64000000, std::size_t(64000000));
+
+template<typename ...Args>
+void BatchLowerBoundBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector numbers = GenerateSortedNumbers(std::get<0>(argsTuple));
+    const std::vector keys = GenerateLookupKeys(numbers.size());
+    std::vector<std::size_t> results(keys.size());
+    for ([[maybe_unused]] auto _ : state)
+    {
+        ExtendedCpp::LINQ::Algorithm::BatchLowerBound(keys.data(), keys.size(), numbers.data(),
+                                                      0, numbers.size() - 1, results.data());
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+BENCHMARK_CAPTURE(BatchLowerBoundBenchmark, intSize1000, std::size_t(1000));
+BENCHMARK_CAPTURE(BatchLowerBoundBenchmark, intSize1000000, std::size_t(1000000));
+BENCHMARK_CAPTURE(BatchLowerBoundBenchmark, intSize64000000, std::size_t(64000000));
+
+template<typename ...Args>
+void SortedIndexBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const ExtendedCpp::LINQ::SortedIndex index(GenerateSortedNumbers(std::get<0>(argsTuple)));
+    const std::vector keys = GenerateLookupKeys(index.size());
+    for ([[maybe_unused]] auto _ : state)
+        for (const int key : keys)
+            benchmark::DoNotOptimize(index.LowerBound(key));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+BENCHMARK_CAPTURE(SortedIndexBenchmark, intSize1000, std::size_t(1000));
+BENCHMARK_CAPTURE(SortedIndexBenchmark, intSize1000000, std::size_t(1000000));
+BENCHMARK_CAPTURE(SortedIndexBenchmark, intSize64000000, std::size_t(64000000));
@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include <ExtendedCpp/LINQ.h>
+
+constexpr std::size_t RECORDS_COUNT = 1000000;
+
+struct Trade
+{
+    long long Id{};
+    std::string Symbol;
+    int Quantity{};
+    double Price{};
+    double Fee{};
+    long long Timestamp{};
+};
+
+std::vector<Trade> GenerateTrades() noexcept
+{
+    std::vector<Trade> result(RECORDS_COUNT);
+
+    std::size_t state = 1;
+    for (std::size_t i = 0; i < RECORDS_COUNT; ++i)
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        result[i].Id = static_cast<long long>(i);
+        result[i].Symbol = "SYM" + std::to_string((state >> 33) % 64);
+        result[i].Quantity = static_cast<int>((state >> 20) % 1000);
+        result[i].Price = static_cast<double>((state >> 40) % 10000) / 100.0;
+        result[i].Timestamp = static_cast<long long>(state >> 1);
+    }
+
+    return result;
+}
+
+static void RowSumBenchmark(benchmark::State& state)
+{
+    const auto linq = ExtendedCpp::LINQ::From(GenerateTrades());
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(linq.Sum([](const Trade& trade){ return trade.Price; }));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * RECORDS_COUNT));
+}
+BENCHMARK(RowSumBenchmark);
+
+static void ColumnarSumBenchmark(benchmark::State& state)
+{
+    const auto columns = ExtendedCpp::LINQ::Columnar<&Trade::Id, &Trade::Symbol, &Trade::Quantity,
+                                                     &Trade::Price, &Trade::Fee, &Trade::Timestamp>(GenerateTrades());
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(columns.Sum<&Trade::Price>());
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * RECORDS_COUNT));
+}
+BENCHMARK(ColumnarSumBenchmark);
+
+static void RowWhereGroupByBenchmark(benchmark::State& state)
+{
+    const auto linq = ExtendedCpp::LINQ::From(GenerateTrades());
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(linq.Where([](const Trade& trade){ return trade.Quantity < 500; })
+                                     .GroupBy([](const Trade& trade){ return trade.Symbol; }));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * RECORDS_COUNT));
+}
+BENCHMARK(RowWhereGroupByBenchmark);
+
+static void ColumnarWhereGroupBySumBenchmark(benchmark::State& state)
+{
+    const auto columns = ExtendedCpp::LINQ::Columnar<&Trade::Id, &Trade::Symbol, &Trade::Quantity,
+                                                     &Trade::Price, &Trade::Fee, &Trade::Timestamp>(GenerateTrades());
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(columns.Where<&Trade::Quantity>([](const int quantity){ return quantity < 500; })
+                                     .GroupBy<&Trade::Symbol>().Sum<&Trade::Price>());
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * RECORDS_COUNT));
+}
+BENCHMARK(ColumnarWhereGroupBySumBenchmark);
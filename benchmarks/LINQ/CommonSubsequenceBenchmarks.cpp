@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include <ExtendedCpp/LINQ/Algorithm.h>
+
+// Every tenth element of the second sequence is changed, as in the diff of two versions of a text.
+std::pair<std::string, std::string> GenerateSequences(const std::size_t count) noexcept
+{
+    std::string first(count, ' ');
+    std::string second(count, ' ');
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        first[i] = static_cast<char>('a' + i * 7919 % 26);
+        second[i] = i % 10 == 0 ? static_cast<char>('a' + i * 31 % 26) : first[i];
+    }
+
+    return { std::move(first), std::move(second) };
+}
+
+template<typename ...Args>
+void CountCommonSubsequenceBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const auto [first, second] = GenerateSequences(std::get<0>(argsTuple));
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(ExtendedCpp::LINQ::Algorithm::CountCommonSubsequence(first, first.size(),
+                                                                                       second, second.size()));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * first.size() * second.size()));
+}
+BENCHMARK_CAPTURE(CountCommonSubsequenceBenchmark, charSize1000, std::size_t(1000));
+BENCHMARK_CAPTURE(CountCommonSubsequenceBenchmark, charSize10000, std::size_t(10000));
+BENCHMARK_CAPTURE(CountCommonSubsequenceBenchmark, charSize100000, std::size_t(100000));
+
+template<typename ...Args>
+void CountCommonSubsequenceByRowsBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const auto [first, second] = GenerateSequences(std::get<0>(argsTuple));
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(ExtendedCpp::LINQ::Algorithm::CountCommonSubsequenceByRows(first, first.size(),
+                                                                                             second, second.size()));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * first.size() * second.size()));
+}
+BENCHMARK_CAPTURE(CountCommonSubsequenceByRowsBenchmark, charSize1000, std::size_t(1000));
+BENCHMARK_CAPTURE(CountCommonSubsequenceByRowsBenchmark, charSize10000, std::size_t(10000));
+
+template<typename ...Args>
+void EditScriptBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const auto [first, second] = GenerateSequences(std::get<0>(argsTuple));
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(ExtendedCpp::LINQ::Algorithm::EditScript(first, first.size(), second, second.size()));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * first.size() * second.size()));
+}
+BENCHMARK_CAPTURE(EditScriptBenchmark, charSize1000, std::size_t(1000));
+BENCHMARK_CAPTURE(EditScriptBenchmark, charSize10000, std::size_t(10000));
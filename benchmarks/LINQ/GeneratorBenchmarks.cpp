@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+#include <string>
+
+#include <ExtendedCpp/LINQ.h>
+
+std::vector<int> GeneratePipelineNumbers(const std::size_t count) noexcept
+{
+    std::vector<int> result(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+        result[i] = static_cast<int>(i * 7919 % 100000);
+
+    return result;
+}
+
+std::vector<std::string> GeneratePipelineStrings(const std::size_t count) noexcept
+{
+    std::vector<std::string> result(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+        result[i] = std::string(40, static_cast<char>('a' + i % 26)) + std::to_string(i);
+
+    return result;
+}
+
+template<typename ...Args>
+void GeneratorPipelineBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector numbers = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(ExtendedCpp::LINQ::Generator(numbers)
+            .Where([](const int number){ return number % 3 != 0; })
+            .Select([](const int number){ return number * 2; })
+            .Skip(10)
+            .Where([](const int number){ return number > 100; })
+            .Take(numbers.size() / 2)
+            .Sum());
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * numbers.size()));
+}
+BENCHMARK_CAPTURE(GeneratorPipelineBenchmark, intSize1000, GeneratePipelineNumbers(1000));
+BENCHMARK_CAPTURE(GeneratorPipelineBenchmark, intSize1000000, GeneratePipelineNumbers(1000000));
+
+template<typename ...Args>
+void LoopPipelineBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector numbers = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        int sum = 0;
+        std::size_t skipped = 0;
+        std::size_t taken = 0;
+        for (const int number : numbers)
+        {
+            if (number % 3 == 0)
+                continue;
+            const int doubled = number * 2;
+            if (skipped < 10)
+            {
+                ++skipped;
+                continue;
+            }
+            if (doubled <= 100)
+                continue;
+            if (taken++ == numbers.size() / 2)
+                break;
+            sum += doubled;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * numbers.size()));
+}
+BENCHMARK_CAPTURE(LoopPipelineBenchmark, intSize1000, GeneratePipelineNumbers(1000));
+BENCHMARK_CAPTURE(LoopPipelineBenchmark, intSize1000000, GeneratePipelineNumbers(1000000));
+
+template<typename ...Args>
+void GeneratorStringPipelineBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector strings = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(ExtendedCpp::LINQ::Generator(strings)
+            .Where([](const std::string& string){ return string[0] != 'b'; })
+            .Skip(10)
+            .Where([](const std::string& string){ return string.size() > 40; })
+            .TakeWhile([](const std::string& string){ return !string.empty(); })
+            .Take(strings.size() / 2)
+            .ToVector());
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * strings.size()));
+}
+BENCHMARK_CAPTURE(GeneratorStringPipelineBenchmark, stringSize1000, GeneratePipelineStrings(1000));
+BENCHMARK_CAPTURE(GeneratorStringPipelineBenchmark, stringSize100000, GeneratePipelineStrings(100000));
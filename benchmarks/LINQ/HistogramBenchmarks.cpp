@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include <ExtendedCpp/LINQ/Algorithm.h>
+
+// Domain of 1000 keys is counted in an array, larger domains in the hash map.
+std::vector<int> GenerateKeys(const std::size_t count, const std::size_t domain) noexcept
+{
+    std::vector<int> result(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+        result[i] = static_cast<int>(i * 7919 % domain);
+
+    return result;
+}
+
+template<typename ...Args>
+void CountEqualKeysBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector keys = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(ExtendedCpp::LINQ::Algorithm::CountEqualKeys(keys, 0, keys.size() - 1));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+BENCHMARK_CAPTURE(CountEqualKeysBenchmark, intSize1000000Domain1000, GenerateKeys(1000000, 1000));
+BENCHMARK_CAPTURE(CountEqualKeysBenchmark, intSize1000000Domain100000, GenerateKeys(1000000, 100000));
+
+template<typename ...Args>
+void HistogramBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector keys = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(ExtendedCpp::LINQ::Algorithm::Histogram(keys, 0, keys.size() - 1));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+BENCHMARK_CAPTURE(HistogramBenchmark, intSize1000000Domain1000, GenerateKeys(1000000, 1000));
+BENCHMARK_CAPTURE(HistogramBenchmark, intSize1000000Domain100000, GenerateKeys(1000000, 100000));
+BENCHMARK_CAPTURE(HistogramBenchmark, intSize16000000Domain100000, GenerateKeys(16000000, 100000));
+
+template<typename ...Args>
+void ParallelHistogramBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector keys = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(ExtendedCpp::LINQ::Algorithm::ParallelHistogram(keys, 0, keys.size() - 1));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+BENCHMARK_CAPTURE(ParallelHistogramBenchmark, intSize1000000Domain1000, GenerateKeys(1000000, 1000));
+BENCHMARK_CAPTURE(ParallelHistogramBenchmark, intSize1000000Domain100000, GenerateKeys(1000000, 100000));
+BENCHMARK_CAPTURE(ParallelHistogramBenchmark, intSize16000000Domain100000, GenerateKeys(16000000, 100000));
@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+#include <unordered_set>
+#include <vector>
+
+#include <ExtendedCpp/LINQ.h>
+
+constexpr std::size_t BUILD_KEYS_COUNT = 4000000;
+constexpr std::size_t PROBE_KEYS_COUNT = 1000000;
+
+std::size_t NextRandom(std::size_t& state) noexcept
+{
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return state >> 1;
+}
+
+// Build keys are even, so a probe matches only if it is even.
+std::vector<long long> GenerateBuildKeys() noexcept
+{
+    std::vector<long long> result(BUILD_KEYS_COUNT);
+
+    std::size_t state = 1;
+    for (std::size_t i = 0; i < BUILD_KEYS_COUNT; ++i)
+        result[i] = static_cast<long long>(NextRandom(state) & ~std::size_t { 1 });
+
+    return result;
+}
+
+// Selectivity is the percent of probes that match, matched keys are spread over the whole build side.
+std::vector<long long> GenerateProbeKeys(const std::size_t selectivity) noexcept
+{
+    const std::vector<long long> buildKeys = GenerateBuildKeys();
+    std::vector<long long> result(PROBE_KEYS_COUNT);
+
+    std::size_t state = 2;
+    for (std::size_t i = 0; i < PROBE_KEYS_COUNT; ++i)
+    {
+        if (NextRandom(state) % 100 < selectivity)
+            result[i] = buildKeys[NextRandom(state) % BUILD_KEYS_COUNT];
+        else
+            result[i] = static_cast<long long>(NextRandom(state) | 1);
+    }
+
+    return result;
+}
+
+template<typename ...Args>
+void SemiJoinBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector probeKeys = std::get<0>(argsTuple);
+    const std::vector buildKeys = GenerateBuildKeys();
+    const auto linq = ExtendedCpp::LINQ::From(probeKeys);
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(linq.SemiJoin(buildKeys));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * probeKeys.size()));
+}
+BENCHMARK_CAPTURE(SemiJoinBenchmark, longSelectivity1, GenerateProbeKeys(1));
+BENCHMARK_CAPTURE(SemiJoinBenchmark, longSelectivity10, GenerateProbeKeys(10));
+BENCHMARK_CAPTURE(SemiJoinBenchmark, longSelectivity50, GenerateProbeKeys(50));
+BENCHMARK_CAPTURE(SemiJoinBenchmark, longSelectivity100, GenerateProbeKeys(100));
+
+template<typename ...Args>
+void KeySetProbeBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector probeKeys = std::get<0>(argsTuple);
+    ExtendedCpp::LINQ::KeySet<long long> keys(GenerateBuildKeys(), [](const long long key) { return key; });
+    for ([[maybe_unused]] auto _ : state)
+    {
+        std::size_t matched = 0;
+        for (const long long key : probeKeys)
+            matched += keys.Contains(key) ? 1 : 0;
+        benchmark::DoNotOptimize(matched);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * probeKeys.size()));
+}
+BENCHMARK_CAPTURE(KeySetProbeBenchmark, longSelectivity1, GenerateProbeKeys(1));
+BENCHMARK_CAPTURE(KeySetProbeBenchmark, longSelectivity10, GenerateProbeKeys(10));
+BENCHMARK_CAPTURE(KeySetProbeBenchmark, longSelectivity50, GenerateProbeKeys(50));
+BENCHMARK_CAPTURE(KeySetProbeBenchmark, longSelectivity100, GenerateProbeKeys(100));
+
+template<typename ...Args>
+void UnorderedSetProbeBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector probeKeys = std::get<0>(argsTuple);
+    const std::vector buildKeys = GenerateBuildKeys();
+    const std::unordered_set<long long> keys(buildKeys.cbegin(), buildKeys.cend());
+    for ([[maybe_unused]] auto _ : state)
+    {
+        std::size_t matched = 0;
+        for (const long long key : probeKeys)
+            matched += keys.contains(key) ? 1 : 0;
+        benchmark::DoNotOptimize(matched);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * probeKeys.size()));
+}
+BENCHMARK_CAPTURE(UnorderedSetProbeBenchmark, longSelectivity1, GenerateProbeKeys(1));
+BENCHMARK_CAPTURE(UnorderedSetProbeBenchmark, longSelectivity10, GenerateProbeKeys(10));
+BENCHMARK_CAPTURE(UnorderedSetProbeBenchmark, longSelectivity50, GenerateProbeKeys(50));
+BENCHMARK_CAPTURE(UnorderedSetProbeBenchmark, longSelectivity100, GenerateProbeKeys(100));
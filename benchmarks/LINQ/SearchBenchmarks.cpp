@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+#include <ExtendedCpp/LINQ/Algorithm.h>
+
+std::vector<char> GenerateText(const std::size_t count) noexcept
+{
+    std::vector<char> result(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+        result[i] = static_cast<char>('a' + i * 7919 % 26);
+
+    return result;
+}
+
+std::vector<int> GenerateSearchNumbers(const std::size_t count) noexcept
+{
+    std::vector<int> result(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+        result[i] = static_cast<int>(i % 1000);
+
+    return result;
+}
+
+// The pattern is placed at the end, so the whole text is scanned.
+std::vector<char> PlacePattern(std::vector<char> text, const std::vector<char>& pattern) noexcept
+{
+    std::copy(pattern.begin(), pattern.end(), text.end() - static_cast<std::ptrdiff_t>(pattern.size()));
+    return text;
+}
+
+const std::vector<char> SEARCH_PATTERN = { 'e', 'x', 't', 'e', 'n', 'd', 'e', 'd', 'c', 'p', 'p', 'l', 'i', 'n', 'q', 's' };
+
+template<typename ...Args>
+void FindBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector numbers = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(ExtendedCpp::LINQ::Algorithm::Find(numbers.data(), numbers.size(), -1));
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * numbers.size() * sizeof(int)));
+}
+BENCHMARK_CAPTURE(FindBenchmark, intSize1000000, GenerateSearchNumbers(1000000));
+BENCHMARK_CAPTURE(FindBenchmark, intSize16000000, GenerateSearchNumbers(16000000));
+
+template<typename ...Args>
+void ScalarFindBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector numbers = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        std::size_t index = ExtendedCpp::LINQ::NPOS;
+        for (std::size_t i = 0; i < numbers.size(); ++i)
+        {
+            if (numbers[i] == -1)
+            {
+                index = i;
+                break;
+            }
+        }
+        benchmark::DoNotOptimize(index);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * numbers.size() * sizeof(int)));
+}
+BENCHMARK_CAPTURE(ScalarFindBenchmark, intSize1000000, GenerateSearchNumbers(1000000));
+BENCHMARK_CAPTURE(ScalarFindBenchmark, intSize16000000, GenerateSearchNumbers(16000000));
+
+template<typename ...Args>
+void IndexAtBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector text = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(ExtendedCpp::LINQ::Algorithm::IndexAt(text.data(), text.size(),
+                                                                      SEARCH_PATTERN.data(), SEARCH_PATTERN.size()));
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * text.size()));
+}
+BENCHMARK_CAPTURE(IndexAtBenchmark, charSize1000000, PlacePattern(GenerateText(1000000), SEARCH_PATTERN));
+BENCHMARK_CAPTURE(IndexAtBenchmark, charSize64000000, PlacePattern(GenerateText(64000000), SEARCH_PATTERN));
+
+template<typename ...Args>
+void TwoWaySearchBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector text = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(ExtendedCpp::LINQ::Algorithm::TwoWaySearch(text.data(), text.size(),
+                                                                           SEARCH_PATTERN.data(), SEARCH_PATTERN.size()));
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * text.size()));
+}
+BENCHMARK_CAPTURE(TwoWaySearchBenchmark, charSize1000000, PlacePattern(GenerateText(1000000), SEARCH_PATTERN));
+BENCHMARK_CAPTURE(TwoWaySearchBenchmark, charSize64000000, PlacePattern(GenerateText(64000000), SEARCH_PATTERN));
+
+template<typename ...Args>
+void KmpSearchBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector text = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(ExtendedCpp::LINQ::Algorithm::KmpSearch(text.data(), text.size(),
+                                                                        SEARCH_PATTERN.data(), SEARCH_PATTERN.size()));
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * text.size()));
+}
+BENCHMARK_CAPTURE(KmpSearchBenchmark, charSize1000000, PlacePattern(GenerateText(1000000), SEARCH_PATTERN));
+BENCHMARK_CAPTURE(KmpSearchBenchmark, charSize64000000, PlacePattern(GenerateText(64000000), SEARCH_PATTERN));
+
+template<typename ...Args>
+void StdBoyerMooreHorspoolBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector text = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(std::search(text.begin(), text.end(),
+            std::boyer_moore_horspool_searcher(SEARCH_PATTERN.begin(), SEARCH_PATTERN.end())));
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * text.size()));
+}
+BENCHMARK_CAPTURE(StdBoyerMooreHorspoolBenchmark, charSize1000000, PlacePattern(GenerateText(1000000), SEARCH_PATTERN));
+BENCHMARK_CAPTURE(StdBoyerMooreHorspoolBenchmark, charSize64000000, PlacePattern(GenerateText(64000000), SEARCH_PATTERN));
@@ -119,6 +119,83 @@ BENCHMARK_CAPTURE(TimSortBenchmark, doubleSize100000, GenerateDoubles(100000));
 BENCHMARK_CAPTURE(TimSortBenchmark, doubleSize1000000, GenerateDoubles(1000000));
 BENCHMARK_CAPTURE(TimSortBenchmark, doubleSize10000000, GenerateDoubles(10000000));
 
+template<typename ...Args>
+void RadixSortBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    std::vector numbers = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+        ExtendedCpp::LINQ::Sort::RadixSort(numbers.data(), 0, numbers.size() - 1);
+}
+BENCHMARK_CAPTURE(RadixSortBenchmark, doubleSize20, GenerateDoubles(20));
+BENCHMARK_CAPTURE(RadixSortBenchmark, doubleSize100, GenerateDoubles(100));
+BENCHMARK_CAPTURE(RadixSortBenchmark, doubleSize1000, GenerateDoubles(1000));
+BENCHMARK_CAPTURE(RadixSortBenchmark, doubleSize10000, GenerateDoubles(10000));
+BENCHMARK_CAPTURE(RadixSortBenchmark, doubleSize100000, GenerateDoubles(100000));
+BENCHMARK_CAPTURE(RadixSortBenchmark, doubleSize1000000, GenerateDoubles(1000000));
+BENCHMARK_CAPTURE(RadixSortBenchmark, doubleSize10000000, GenerateDoubles(10000000));
+
+template<typename ...Args>
+void ParallelSortBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    std::vector numbers = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+        ExtendedCpp::LINQ::Sort::ParallelSort(numbers.data(), 0, numbers.size() - 1);
+}
+BENCHMARK_CAPTURE(ParallelSortBenchmark, doubleSize10000, GenerateDoubles(10000));
+BENCHMARK_CAPTURE(ParallelSortBenchmark, doubleSize100000, GenerateDoubles(100000));
+BENCHMARK_CAPTURE(ParallelSortBenchmark, doubleSize1000000, GenerateDoubles(1000000));
+BENCHMARK_CAPTURE(ParallelSortBenchmark, doubleSize10000000, GenerateDoubles(10000000));
+
+template<typename ...Args>
+void ParallelStableSortBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    std::vector numbers = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+        ExtendedCpp::LINQ::Sort::ParallelStableSort(numbers.data(), 0, numbers.size() - 1);
+}
+BENCHMARK_CAPTURE(ParallelStableSortBenchmark, doubleSize10000, GenerateDoubles(10000));
+BENCHMARK_CAPTURE(ParallelStableSortBenchmark, doubleSize100000, GenerateDoubles(100000));
+BENCHMARK_CAPTURE(ParallelStableSortBenchmark, doubleSize1000000, GenerateDoubles(1000000));
+BENCHMARK_CAPTURE(ParallelStableSortBenchmark, doubleSize10000000, GenerateDoubles(10000000));
+
+template<typename ...Args>
+void TopKBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector source = std::get<0>(argsTuple);
+    std::vector numbers = source;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        state.PauseTiming();
+        numbers = source;
+        state.ResumeTiming();
+        ExtendedCpp::LINQ::Sort::TopK(numbers.data(), 0, numbers.size() - 1, 100, ExtendedCpp::LINQ::OrderType::DESC);
+    }
+}
+BENCHMARK_CAPTURE(TopKBenchmark, doubleSize10000, GenerateDoubles(10000));
+BENCHMARK_CAPTURE(TopKBenchmark, doubleSize100000, GenerateDoubles(100000));
+BENCHMARK_CAPTURE(TopKBenchmark, doubleSize1000000, GenerateDoubles(1000000));
+
+template<typename ...Args>
+void ParallelTopKBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector source = std::get<0>(argsTuple);
+    std::vector numbers = source;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        state.PauseTiming();
+        numbers = source;
+        state.ResumeTiming();
+        ExtendedCpp::LINQ::Sort::ParallelTopK(numbers.data(), 0, numbers.size() - 1, 100, ExtendedCpp::LINQ::OrderType::DESC);
+    }
+}
+BENCHMARK_CAPTURE(ParallelTopKBenchmark, doubleSize100000, GenerateDoubles(100000));
+BENCHMARK_CAPTURE(ParallelTopKBenchmark, doubleSize1000000, GenerateDoubles(1000000));
+
 template<typename ...Args>
 void StdSortBenchmark(benchmark::State& state, Args&&... args)
 {
@@ -119,6 +119,48 @@ BENCHMARK_CAPTURE(TimSortBenchmark, intSize100000, GenerateInts(100000));
 BENCHMARK_CAPTURE(TimSortBenchmark, intSize1000000, GenerateInts(1000000));
 BENCHMARK_CAPTURE(TimSortBenchmark, intSize10000000, GenerateInts(10000000));
 
+template<typename ...Args>
+void RadixSortBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    std::vector numbers = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+        ExtendedCpp::LINQ::Sort::RadixSort(numbers.data(), 0, numbers.size() - 1);
+}
+BENCHMARK_CAPTURE(RadixSortBenchmark, intSize20, GenerateInts(20));
+BENCHMARK_CAPTURE(RadixSortBenchmark, intSize100, GenerateInts(100));
+BENCHMARK_CAPTURE(RadixSortBenchmark, intSize1000, GenerateInts(1000));
+BENCHMARK_CAPTURE(RadixSortBenchmark, intSize10000, GenerateInts(10000));
+BENCHMARK_CAPTURE(RadixSortBenchmark, intSize100000, GenerateInts(100000));
+BENCHMARK_CAPTURE(RadixSortBenchmark, intSize1000000, GenerateInts(1000000));
+BENCHMARK_CAPTURE(RadixSortBenchmark, intSize10000000, GenerateInts(10000000));
+
+template<typename ...Args>
+void ParallelSortBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    std::vector numbers = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+        ExtendedCpp::LINQ::Sort::ParallelSort(numbers.data(), 0, numbers.size() - 1);
+}
+BENCHMARK_CAPTURE(ParallelSortBenchmark, intSize10000, GenerateInts(10000));
+BENCHMARK_CAPTURE(ParallelSortBenchmark, intSize100000, GenerateInts(100000));
+BENCHMARK_CAPTURE(ParallelSortBenchmark, intSize1000000, GenerateInts(1000000));
+BENCHMARK_CAPTURE(ParallelSortBenchmark, intSize10000000, GenerateInts(10000000));
+
+template<typename ...Args>
+void ParallelStableSortBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    std::vector numbers = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+        ExtendedCpp::LINQ::Sort::ParallelStableSort(numbers.data(), 0, numbers.size() - 1);
+}
+BENCHMARK_CAPTURE(ParallelStableSortBenchmark, intSize10000, GenerateInts(10000));
+BENCHMARK_CAPTURE(ParallelStableSortBenchmark, intSize100000, GenerateInts(100000));
+BENCHMARK_CAPTURE(ParallelStableSortBenchmark, intSize1000000, GenerateInts(1000000));
+BENCHMARK_CAPTURE(ParallelStableSortBenchmark, intSize10000000, GenerateInts(10000000));
+
 template<typename ...Args>
 void StdSortBenchmark(benchmark::State& state, Args&&... args)
 {
@@ -3,6 +3,7 @@
 #include <benchmark/benchmark.h>
 
 #include <ExtendedCpp/LINQ/Sort.h>
+#include <ExtendedCpp/LINQ/StringDictionary.h>
 #include <ExtendedCpp/Random.h>
 
 std::vector<std::string> GenerateStrings(const std::size_t count) noexcept
@@ -15,6 +16,18 @@ std::vector<std::string> GenerateStrings(const std::size_t count) noexcept
     return result;
 }
 
+// Every string is repeated about count / distinct times, like a column of names or categories.
+std::vector<std::string> GenerateRepeatedStrings(const std::size_t count, const std::size_t distinct) noexcept
+{
+    const std::vector<std::string> dictionary = GenerateStrings(distinct);
+    std::vector<std::string> result(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+        result[i] = dictionary[ExtendedCpp::Random::RandomInt<std::size_t>(0, distinct - 1)];
+
+    return result;
+}
+
 template<typename ...Args>
 void QuickSortBenchmark(benchmark::State& state, Args&&... args)
 {
@@ -84,6 +97,42 @@ BENCHMARK_CAPTURE(TimSortBenchmark, stringSize1000, GenerateStrings(1000));
 BENCHMARK_CAPTURE(TimSortBenchmark, stringSize10000, GenerateStrings(10000));
 BENCHMARK_CAPTURE(TimSortBenchmark, stringSize100000, GenerateStrings(100000));
 
+template<typename ...Args>
+void RadixSortBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    std::vector strings = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+        ExtendedCpp::LINQ::Sort::RadixSort(strings.data(), 0, strings.size() - 1);
+}
+BENCHMARK_CAPTURE(RadixSortBenchmark, stringSize20, GenerateStrings(20));
+BENCHMARK_CAPTURE(RadixSortBenchmark, stringSize100, GenerateStrings(100));
+BENCHMARK_CAPTURE(RadixSortBenchmark, stringSize1000, GenerateStrings(1000));
+BENCHMARK_CAPTURE(RadixSortBenchmark, stringSize10000, GenerateStrings(10000));
+BENCHMARK_CAPTURE(RadixSortBenchmark, stringSize100000, GenerateStrings(100000));
+
+template<typename ...Args>
+void ParallelSortBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    std::vector strings = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+        ExtendedCpp::LINQ::Sort::ParallelSort(strings.data(), 0, strings.size() - 1);
+}
+BENCHMARK_CAPTURE(ParallelSortBenchmark, stringSize10000, GenerateStrings(10000));
+BENCHMARK_CAPTURE(ParallelSortBenchmark, stringSize100000, GenerateStrings(100000));
+
+template<typename ...Args>
+void ParallelStableSortBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    std::vector strings = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+        ExtendedCpp::LINQ::Sort::ParallelStableSort(strings.data(), 0, strings.size() - 1);
+}
+BENCHMARK_CAPTURE(ParallelStableSortBenchmark, stringSize10000, GenerateStrings(10000));
+BENCHMARK_CAPTURE(ParallelStableSortBenchmark, stringSize100000, GenerateStrings(100000));
+
 template<typename ...Args>
 void StdSortBenchmark(benchmark::State& state, Args&&... args)
 {
@@ -96,4 +145,43 @@ BENCHMARK_CAPTURE(StdSortBenchmark, stringSize20, GenerateStrings(20));
 BENCHMARK_CAPTURE(StdSortBenchmark, stringSize100, GenerateStrings(100));
 BENCHMARK_CAPTURE(StdSortBenchmark, stringSize1000, GenerateStrings(1000));
 BENCHMARK_CAPTURE(StdSortBenchmark, stringSize10000, GenerateStrings(10000));
-BENCHMARK_CAPTURE(StdSortBenchmark, stringSize100000, GenerateStrings(100000));
\ No newline at end of file
+BENCHMARK_CAPTURE(StdSortBenchmark, stringSize100000, GenerateStrings(100000));
+template<typename ...Args>
+void StdSortCopyBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector strings = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        std::vector copy = strings;
+        std::sort(copy.begin(), copy.end());
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK_CAPTURE(StdSortCopyBenchmark, distinct100, GenerateRepeatedStrings(100000, 100));
+BENCHMARK_CAPTURE(StdSortCopyBenchmark, distinct10000, GenerateRepeatedStrings(100000, 10000));
+BENCHMARK_CAPTURE(StdSortCopyBenchmark, distinct100000, GenerateStrings(100000));
+
+template<typename ...Args>
+void EncodedOrderBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const std::vector strings = std::get<0>(argsTuple);
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(ExtendedCpp::LINQ::EncodedStringContainer(strings).Order().ToVector());
+}
+BENCHMARK_CAPTURE(EncodedOrderBenchmark, distinct100, GenerateRepeatedStrings(100000, 100));
+BENCHMARK_CAPTURE(EncodedOrderBenchmark, distinct10000, GenerateRepeatedStrings(100000, 10000));
+BENCHMARK_CAPTURE(EncodedOrderBenchmark, distinct100000, GenerateStrings(100000));
+
+template<typename ...Args>
+void EncodedOrderCodesBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const ExtendedCpp::LINQ::EncodedStringContainer encoded(std::get<0>(argsTuple));
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(encoded.Order());
+}
+BENCHMARK_CAPTURE(EncodedOrderCodesBenchmark, distinct100, GenerateRepeatedStrings(100000, 100));
+BENCHMARK_CAPTURE(EncodedOrderCodesBenchmark, distinct10000, GenerateRepeatedStrings(100000, 10000));
+BENCHMARK_CAPTURE(EncodedOrderCodesBenchmark, distinct100000, GenerateStrings(100000));
@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+#include <cmath>
+
+#include <ExtendedCpp/LINQ/Aggregate.h>
+#include <ExtendedCpp/Random.h>
+
+std::vector<double> GenerateSummands(const std::size_t count) noexcept
+{
+    std::vector<double> result(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+        result[i] = static_cast<double>(ExtendedCpp::Random::RandomInt(-100000, 100000)) / 7.0 +
+                    (i % 2 == 0 ? 1e10 : -1e10);
+
+    return result;
+}
+
+long double ReferenceSum(const std::vector<double>& numbers) noexcept
+{
+    long double sum = 0;
+    long double compensation = 0;
+
+    for (const double number : numbers)
+    {
+        const long double value = number;
+        const long double total = sum + value;
+        if (std::abs(sum) >= std::abs(value))
+            compensation += (sum - total) + value;
+        else
+            compensation += (value - total) + sum;
+        sum = total;
+    }
+
+    return sum + compensation;
+}
+
+template<typename ...Args>
+void SumBenchmark(benchmark::State& state, Args&&... args)
+{
+    auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
+    const ExtendedCpp::LINQ::SummationType summationType = std::get<0>(argsTuple);
+    const std::vector numbers = std::get<1>(argsTuple);
+    double sum = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        sum = ExtendedCpp::LINQ::Aggregate::Sum(numbers.data(), 0, numbers.size() - 1, summationType);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * numbers.size()));
+    state.counters["error"] = static_cast<double>(std::abs(static_cast<long double>(sum) - ReferenceSum(numbers)));
+}
+BENCHMARK_CAPTURE(SumBenchmark, lanesSize1000, ExtendedCpp::LINQ::SummationType::LANES, GenerateSummands(1000));
+BENCHMARK_CAPTURE(SumBenchmark, lanesSize100000, ExtendedCpp::LINQ::SummationType::LANES, GenerateSummands(100000));
+BENCHMARK_CAPTURE(SumBenchmark, lanesSize1000000, ExtendedCpp::LINQ::SummationType::LANES, GenerateSummands(1000000));
+BENCHMARK_CAPTURE(SumBenchmark, naiveSize1000, ExtendedCpp::LINQ::SummationType::NAIVE, GenerateSummands(1000));
+BENCHMARK_CAPTURE(SumBenchmark, naiveSize100000, ExtendedCpp::LINQ::SummationType::NAIVE, GenerateSummands(100000));
+BENCHMARK_CAPTURE(SumBenchmark, naiveSize1000000, ExtendedCpp::LINQ::SummationType::NAIVE, GenerateSummands(1000000));
+BENCHMARK_CAPTURE(SumBenchmark, pairwiseSize1000, ExtendedCpp::LINQ::SummationType::PAIRWISE, GenerateSummands(1000));
+BENCHMARK_CAPTURE(SumBenchmark, pairwiseSize100000, ExtendedCpp::LINQ::SummationType::PAIRWISE, GenerateSummands(100000));
+BENCHMARK_CAPTURE(SumBenchmark, pairwiseSize1000000, ExtendedCpp::LINQ::SummationType::PAIRWISE, GenerateSummands(1000000));
+BENCHMARK_CAPTURE(SumBenchmark, kahanNeumaierSize1000, ExtendedCpp::LINQ::SummationType::KAHAN_NEUMAIER, GenerateSummands(1000));
+BENCHMARK_CAPTURE(SumBenchmark, kahanNeumaierSize100000, ExtendedCpp::LINQ::SummationType::KAHAN_NEUMAIER, GenerateSummands(100000));
+BENCHMARK_CAPTURE(SumBenchmark, kahanNeumaierSize1000000, ExtendedCpp::LINQ::SummationType::KAHAN_NEUMAIER, GenerateSummands(1000000));
+BENCHMARK_CAPTURE(SumBenchmark, parallelPairwiseSize100000, ExtendedCpp::LINQ::SummationType::PARALLEL_PAIRWISE, GenerateSummands(100000));
+BENCHMARK_CAPTURE(SumBenchmark, parallelPairwiseSize1000000, ExtendedCpp::LINQ::SummationType::PARALLEL_PAIRWISE, GenerateSummands(1000000));
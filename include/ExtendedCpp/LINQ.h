@@ -1,13 +1,67 @@
 #ifndef LINQ_LINQ_H
 #define LINQ_LINQ_H
 
+#include <algorithm>
+#include <span>
+#include <ranges>
+#include <memory_resource>
+
 #include <ExtendedCpp/LINQ/LinqContainer.h>
 #include <ExtendedCpp/LINQ/LinqGenerator.h>
 #include <ExtendedCpp/LINQ/LinqView.h>
+#include <ExtendedCpp/LINQ/AsyncLinqGenerator.h>
+#include <ExtendedCpp/LINQ/SortedIndex.h>
+#include <ExtendedCpp/LINQ/IncrementalQuery.h>
+#include <ExtendedCpp/LINQ/ColumnarContainer.h>
+#include <ExtendedCpp/LINQ/StringDictionary.h>
 
 /// @brief 
 namespace ExtendedCpp::LINQ
 {
+    /// @brief Get the container under std::stack, std::queue or std::priority_queue without copying the adaptor
+    /// @tparam TAdaptor 
+    /// @param adaptor 
+    /// @return 
+    template<typename TAdaptor>
+    const typename TAdaptor::container_type& UnderlyingContainer(const TAdaptor& adaptor) noexcept
+    {
+        struct Access final : TAdaptor
+        {
+            static const typename TAdaptor::container_type& Get(const TAdaptor& adaptor) noexcept
+            {
+                return adaptor.*(&Access::c);
+            }
+        };
+        return Access::Get(adaptor);
+    }
+
+    /// @brief Container which reads the contiguous storage of the collection in place. The collection is copied
+    /// on the first mutable access, so queries that only read it do not allocate. The collection must outlive
+    /// the container and every copy of it
+    /// @tparam TSource 
+    /// @tparam TCollection 
+    /// @param collection 
+    /// @return 
+    template<std::ranges::contiguous_range TCollection, typename TSource = std::ranges::range_value_t<TCollection>>
+    requires std::ranges::sized_range<TCollection> && std::ranges::borrowed_range<TCollection>
+    LinqContainer<TSource> Borrow(TCollection&& collection) noexcept
+    {
+        return LinqContainer<TSource>(std::span<const TSource>(std::ranges::data(collection), std::ranges::size(collection)));
+    }
+
+    /// @brief Container which reads [begin, end) in place until the first mutable access.
+    /// The storage must outlive the container and every copy of it
+    /// @tparam TSource 
+    /// @tparam TIterator 
+    /// @param begin 
+    /// @param end 
+    /// @return 
+    template<std::contiguous_iterator TIterator, typename TSource = std::iter_value_t<TIterator>>
+    LinqContainer<TSource> Borrow(const TIterator begin, const TIterator end) noexcept
+    {
+        return LinqContainer<TSource>(std::span<const TSource>(std::to_address(begin), std::to_address(end)));
+    }
+
     /// @brief 
     /// @tparam TSource 
     /// @tparam TCollection 
@@ -42,6 +96,23 @@ namespace ExtendedCpp::LINQ
         return LinqContainer(std::vector<TSource>(begin, end));
     }
 
+    /// @brief Materializes a standard range without container typedefs, such as std::views pipelines
+    /// @tparam TRange 
+    /// @tparam TSource 
+    /// @param range 
+    /// @return 
+    template<std::ranges::input_range TRange, typename TSource = std::ranges::range_value_t<TRange>>
+    requires (!Concepts::ConstIterable<std::remove_cvref_t<TRange>>) && (!Concepts::Iterable<std::remove_cvref_t<TRange>>)
+    LinqContainer<TSource> From(TRange&& range)
+    {
+        std::vector<TSource> collection;
+        if constexpr (std::ranges::sized_range<TRange>)
+            collection.reserve(std::ranges::size(range));
+        for (auto&& value : range)
+            collection.push_back(std::forward<decltype(value)>(value));
+        return LinqContainer<TSource>(std::move(collection));
+    }
+
     /// @brief 
     /// @tparam TSource 
     /// @param collection 
@@ -52,24 +123,60 @@ namespace ExtendedCpp::LINQ
         return LinqContainer(std::move(collection));
     }
 
-    /// @brief 
+    /// @brief Container which allocates the elements and the results of the queries from the memory resource
+    /// of the collection
     /// @tparam TSource 
     /// @param collection 
     /// @return 
     template<typename TSource>
-    LinqContainer<TSource> From(const std::stack<TSource>& collection) 
-    noexcept(std::is_nothrow_move_assignable_v<TSource> && std::is_nothrow_copy_assignable_v<std::stack<TSource>>)
+    LinqContainer<TSource> From(std::pmr::vector<TSource>&& collection) noexcept
     {
-        std::stack<TSource> copy = collection;
+        return LinqContainer(std::move(collection));
+    }
 
-        std::vector<TSource> vectorCollection(collection.size());
-        for (std::size_t i = 0; i < collection.size(); ++i)
-        {
-            vectorCollection[i] = std::move(copy.top());
-            copy.pop();
-        }
+    /// @brief Container which allocates the elements and the results of the queries from the memory resource,
+    /// e.g. std::pmr::monotonic_buffer_resource of one request. The resource must outlive the container
+    /// and every container made from it
+    /// @tparam TSource 
+    /// @tparam TCollection 
+    /// @param collection 
+    /// @param resource 
+    /// @return 
+    template<Concepts::ConstIterable TCollection, typename TSource = std::decay_t<TCollection>::value_type>
+    LinqContainer<TSource> From(const TCollection& collection, std::pmr::memory_resource* resource)
+    {
+        return LinqContainer(std::pmr::vector<TSource>(collection.cbegin(), collection.cend(), resource));
+    }
 
-        return LinqContainer(std::move(vectorCollection));
+    /// @brief Container which allocates the elements and the results of the queries from the memory resource.
+    /// Elements of the expiring collection or generator are moved into the resource
+    /// @tparam TSource 
+    /// @tparam TCollection 
+    /// @param collection 
+    /// @param resource 
+    /// @return 
+    template<Concepts::Iterable TCollection, typename TSource = std::decay_t<TCollection>::value_type>
+    LinqContainer<TSource> From(TCollection&& collection, std::pmr::memory_resource* resource)
+    {
+        std::pmr::vector<TSource> newCollection(resource);
+        if constexpr (Concepts::HasSize<TCollection>)
+            newCollection.reserve(collection.size());
+
+        for (auto&& element : collection)
+            newCollection.push_back(std::move(element));
+
+        return LinqContainer(std::move(newCollection));
+    }
+
+    /// @brief 
+    /// @tparam TSource 
+    /// @param collection 
+    /// @return 
+    template<typename TSource>
+    LinqContainer<TSource> From(const std::stack<TSource>& collection)
+    {
+        const auto& container = UnderlyingContainer(collection);
+        return LinqContainer(std::vector<TSource>(container.crbegin(), container.crend()));
     }
 
     /// @brief 
@@ -81,7 +188,7 @@ namespace ExtendedCpp::LINQ
     noexcept(std::is_nothrow_move_assignable_v<TSource>)
     {
         std::vector<TSource> vectorCollection(collection.size());
-        for (std::size_t i = 0; i < collection.size(); ++i)
+        for (std::size_t i = 0; i < vectorCollection.size(); ++i)
         {
             vectorCollection[i] = std::move(collection.top());
             collection.pop();
@@ -95,19 +202,10 @@ namespace ExtendedCpp::LINQ
     /// @param collection 
     /// @return 
     template<typename TSource>
-    LinqContainer<TSource> From(const std::queue<TSource>& collection) 
-    noexcept(std::is_nothrow_move_assignable_v<TSource> && std::is_nothrow_copy_assignable_v<std::queue<TSource>>)
+    LinqContainer<TSource> From(const std::queue<TSource>& collection)
     {
-        std::queue<TSource> copy = collection;
-
-        std::vector<TSource> vectorCollection(collection.size());
-        for (std::size_t i = 0; i < collection.size(); ++i)
-        {
-            vectorCollection[i] = std::move(copy.front());
-            copy.pop();
-        }
-
-        return LinqContainer(std::move(vectorCollection));
+        const auto& container = UnderlyingContainer(collection);
+        return LinqContainer(std::vector<TSource>(container.cbegin(), container.cend()));
     }
 
     /// @brief 
@@ -119,7 +217,7 @@ namespace ExtendedCpp::LINQ
     noexcept(std::is_nothrow_move_assignable_v<TSource>)
     {
         std::vector<TSource> vectorCollection(collection.size());
-        for (std::size_t i = 0; i < collection.size(); ++i)
+        for (std::size_t i = 0; i < vectorCollection.size(); ++i)
         {
             vectorCollection[i] = std::move(collection.front());
             collection.pop();
@@ -133,18 +231,12 @@ namespace ExtendedCpp::LINQ
     /// @param collection 
     /// @return 
     template<typename TSource>
-    LinqContainer<TSource> From(const std::priority_queue<TSource>& collection) 
-    noexcept(std::is_nothrow_move_assignable_v<TSource> && std::is_nothrow_copy_assignable_v<std::priority_queue<TSource>>)
+    LinqContainer<TSource> From(const std::priority_queue<TSource>& collection)
     {
-        std::priority_queue<TSource> copy = collection;
-
-        std::vector<TSource> vectorCollection(collection.size());
-        for (std::size_t i = 0; i < collection.size(); ++i)
-        {
-            vectorCollection[i] = std::move(copy.top());
-            copy.pop();
-        }
-
+        const auto& container = UnderlyingContainer(collection);
+        std::vector<TSource> vectorCollection(container.cbegin(), container.cend());
+        std::sort_heap(vectorCollection.begin(), vectorCollection.end());
+        std::reverse(vectorCollection.begin(), vectorCollection.end());
         return LinqContainer(std::move(vectorCollection));
     }
 
@@ -157,7 +249,7 @@ namespace ExtendedCpp::LINQ
     noexcept(std::is_nothrow_move_assignable_v<TSource>)
     {
         std::vector<TSource> vectorCollection(collection.size());
-        for (std::size_t i = 0; i < collection.size(); ++i)
+        for (std::size_t i = 0; i < vectorCollection.size(); ++i)
         {
             vectorCollection[i] = std::move(collection.top());
             collection.pop();
@@ -402,17 +494,27 @@ namespace ExtendedCpp::LINQ
         return LinqGenerator<std::pair<TKey, TValue>>(std::move(collection));
     }
 
+    /// @brief Asynchronous generator over the elements returned by tasks of operation, std::nullopt ends it
+    /// @tparam TOperation Any functional object without arguments, which returns Task<std::optional<TSource>>
+    /// @tparam TSource 
+    /// @param operation 
+    /// @return 
+    template<std::invocable TOperation,
+             typename TSource = typename decltype(std::declval<std::invoke_result_t<TOperation>>().Result())::value_type>
+    AsyncLinqGenerator<TSource> AsyncGenerator(TOperation&& operation)
+    {
+        return AsyncLinqGenerator<TSource>(std::forward<TOperation>(operation));
+    }
+
     /// @brief 
     /// @tparam TIterator 
     /// @tparam TCollection 
     /// @param collection 
     /// @return 
     template<Concepts::ConstIterable TCollection, typename TIterator = std::decay_t<TCollection>::const_iterator>
-    LinqView<OptionalIterator<TIterator>> View(const TCollection& collection) noexcept
+    LinqView<TIterator> View(const TCollection& collection) noexcept
     {
-        return LinqView<OptionalIterator<TIterator>>(
-            OptionalIterator<TIterator>(collection.cbegin()),
-            OptionalIterator<TIterator>(collection.cend()));
+        return LinqView<TIterator>(collection.cbegin(), collection.cend());
     }
 
     /// @brief 
@@ -421,11 +523,9 @@ namespace ExtendedCpp::LINQ
     /// @param collection 
     /// @return 
     template<Concepts::Iterable TCollection, typename TIterator = std::decay_t<TCollection>::iterator>
-    LinqView<OptionalIterator<TIterator>> View(TCollection& collection) noexcept
+    LinqView<TIterator> View(TCollection& collection) noexcept
     {
-        return LinqView<OptionalIterator<TIterator>>(
-            OptionalIterator<TIterator>(collection.begin()),
-            OptionalIterator<TIterator>(collection.end()));
+        return LinqView<TIterator>(collection.begin(), collection.end());
     }
 
     /// @brief 
@@ -434,11 +534,23 @@ namespace ExtendedCpp::LINQ
     /// @param end 
     /// @return 
     template<std::forward_iterator TIterator>
-    LinqView<OptionalIterator<TIterator>> View(const TIterator begin, const TIterator end) noexcept
+    LinqView<TIterator> View(const TIterator begin, const TIterator end) noexcept
     {
-        return LinqView<OptionalIterator<TIterator>>(
-            OptionalIterator<TIterator>(begin),
-            OptionalIterator<TIterator>(end));
+        return LinqView<TIterator>(begin, end);
+    }
+
+    /// @brief View over a standard range without container typedefs, such as std::views pipelines.
+    /// The range must outlive the view unless it is borrowed
+    /// @tparam TRange 
+    /// @tparam TIterator 
+    /// @param range 
+    /// @return 
+    template<std::ranges::forward_range TRange, typename TIterator = std::ranges::iterator_t<TRange>>
+    requires std::ranges::common_range<TRange> && std::ranges::borrowed_range<TRange> &&
+             (!Concepts::ConstIterable<std::remove_cvref_t<TRange>>) && (!Concepts::Iterable<std::remove_cvref_t<TRange>>)
+    LinqView<TIterator> View(TRange&& range) noexcept
+    {
+        return LinqView<TIterator>(std::ranges::begin(range), std::ranges::end(range));
     }
 
     /// @brief 
@@ -447,7 +559,7 @@ namespace ExtendedCpp::LINQ
     /// @param collection 
     /// @return 
     template<typename TSource, typename TIterator = std::vector<TSource>::iterator>
-    LinqView<OptionalIterator<TIterator>> View(std::stack<TSource> collection) = delete;
+    LinqView<TIterator> View(std::stack<TSource> collection) = delete;
 
     /// @brief 
     /// @tparam TSource 
@@ -455,7 +567,7 @@ namespace ExtendedCpp::LINQ
     /// @param collection 
     /// @return 
     template<typename TSource, typename TIterator = std::vector<TSource>::iterator>
-    LinqView<OptionalIterator<TIterator>> View(std::queue<TSource> collection) = delete;
+    LinqView<TIterator> View(std::queue<TSource> collection) = delete;
 
     /// @brief 
     /// @tparam TSource 
@@ -463,7 +575,41 @@ namespace ExtendedCpp::LINQ
     /// @param collection 
     /// @return 
     template<typename TSource, typename TIterator = std::vector<TSource>::iterator>
-    LinqView<OptionalIterator<TIterator>> View(std::priority_queue<TSource> collection) = delete;
+    LinqView<TIterator> View(std::priority_queue<TSource> collection) = delete;
+
+    /// @brief Query over the observable collection, which updates its result on every change of the collection
+    /// @tparam TSource
+    /// @param collection
+    /// @return
+    template<std::copyable TSource>
+    IncrementalQuery<TSource> Incremental(ObservableCollection<TSource>& collection)
+    {
+        return IncrementalQuery<TSource>(collection);
+    }
+
+    /// @brief Stores the fields of the records as separate columns
+    /// @tparam Fields Pointers to the stored data members of the record
+    /// @tparam TCollection
+    /// @tparam TRecord
+    /// @param records
+    /// @return
+    template<auto... Fields, Concepts::ConstIterable TCollection,
+             typename TRecord = std::remove_cvref_t<typename TCollection::value_type>>
+    ColumnarContainer<TRecord, Fields...> Columnar(const TCollection& records)
+    {
+        return ColumnarContainer<TRecord, Fields...>(records);
+    }
+
+    /// @brief Encodes the strings by a sorted dictionary of different strings
+    /// @tparam TCollection
+    /// @param strings
+    /// @return
+    template<Concepts::ConstIterable TCollection>
+    requires std::convertible_to<const typename TCollection::value_type&, std::string_view>
+    EncodedStringContainer Encode(const TCollection& strings)
+    {
+        return EncodedStringContainer(strings);
+    }
 }
 
 #endif
\ No newline at end of file
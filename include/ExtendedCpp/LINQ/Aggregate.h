@@ -1,12 +1,221 @@
 #ifndef LINQ_Aggregate_H
 #define LINQ_Aggregate_H
 
+#include <array>
+#include <bit>
+#include <cmath>
+#include <future>
+#include <utility>
+#include <type_traits>
+#include <concepts>
+
 #include <ExtendedCpp/LINQ/TypeTraits.h>
 #include <ExtendedCpp/LINQ/Concepts.h>
+#include <ExtendedCpp/LINQ/Parallel.h>
+#include <ExtendedCpp/LINQ/SummationType.h>
 
 /// @brief 
 namespace ExtendedCpp::LINQ::Aggregate
 {
+    /// @brief Number of independent accumulators of the arithmetic kernels
+    static constexpr std::size_t LANES = 8;
+
+    /// @brief Size of the leaves of the pairwise summation tree
+    static constexpr std::size_t PAIRWISE_BLOCK = 128;
+
+    /// @brief Minimal size of a subtree of the pairwise summation tree that is summed by a separate task
+    static constexpr std::size_t PARALLEL_SUM_THRESHOLD = 1 << 16;
+
+    /// @brief Built-in arithmetic types except bool, which are aggregated by the multi-lane kernels
+    template<typename T>
+    concept LaneArithmetic = std::is_arithmetic_v<T> && !std::same_as<T, bool>;
+
+    /// @brief Sums get(start), ..., get(end) in LANES independent accumulators, which the compiler maps to SIMD lanes.
+    /// Reassociation policy: element i is added to lane (i - start) % LANES in order, the tail after the last
+    /// full block goes to a separate accumulator, lanes are combined pairwise and the tail is added last.
+    /// Integers are accumulated as unsigned, so the result is the same as a sequential sum modulo 2^N
+    /// @tparam T 
+    /// @tparam TGet 
+    /// @param start 
+    /// @param end 
+    /// @param get 
+    /// @return 
+    template<LaneArithmetic T, typename TGet>
+    T LaneSum(const std::size_t start, const std::size_t end, TGet&& get)
+    noexcept(std::is_nothrow_invocable_v<TGet, std::size_t>)
+    {
+        using TLane = typename std::conditional_t<std::is_integral_v<T>,
+                                                  std::make_unsigned<T>, std::type_identity<T>>::type;
+
+        std::array<TLane, LANES> lanes {};
+        std::size_t i = start;
+        for (; end + 1 - i >= LANES; i += LANES)
+            for (std::size_t lane = 0; lane < LANES; ++lane)
+                lanes[lane] = static_cast<TLane>(lanes[lane] + static_cast<TLane>(get(i + lane)));
+
+        TLane tail {};
+        for (; i <= end; ++i)
+            tail = static_cast<TLane>(tail + static_cast<TLane>(get(i)));
+
+        for (std::size_t width = LANES / 2; width > 0; width /= 2)
+            for (std::size_t lane = 0; lane < width; ++lane)
+                lanes[lane] = static_cast<TLane>(lanes[lane] + lanes[lane + width]);
+
+        return static_cast<T>(static_cast<TLane>(lanes[0] + tail));
+    }
+
+    /// @brief Sums get(start), ..., get(end) by recursive halving, leaves of at most PAIRWISE_BLOCK elements
+    /// are summed by LaneSum. The shape of the tree depends only on the number of elements
+    /// @tparam T 
+    /// @tparam TGet 
+    /// @param start 
+    /// @param end 
+    /// @param get 
+    /// @return 
+    template<LaneArithmetic T, typename TGet>
+    T PairwiseSum(const std::size_t start, const std::size_t end, TGet&& get)
+    noexcept(std::is_nothrow_invocable_v<TGet, std::size_t>)
+    {
+        const std::size_t size = end + 1 - start;
+        if (size <= PAIRWISE_BLOCK)
+            return LaneSum<T>(start, end, get);
+
+        const std::size_t middle = start + size / 2;
+        return static_cast<T>(PairwiseSum<T>(start, middle - 1, get) + PairwiseSum<T>(middle, end, get));
+    }
+
+    /// @brief Evaluates the tree of PairwiseSum with subtrees of at least PARALLEL_SUM_THRESHOLD elements
+    /// summed by separate tasks, so the result is bitwise equal to PairwiseSum for any depth
+    /// @tparam T 
+    /// @tparam TGet 
+    /// @param start 
+    /// @param end 
+    /// @param get Invoked concurrently
+    /// @param depth Number of levels that may still fork tasks
+    /// @return 
+    template<LaneArithmetic T, typename TGet>
+    T ParallelPairwiseSum(const std::size_t start, const std::size_t end, TGet&& get, const std::size_t depth)
+    {
+        const std::size_t size = end + 1 - start;
+        if (depth == 0 || size < PARALLEL_SUM_THRESHOLD)
+            return PairwiseSum<T>(start, end, get);
+
+        const std::size_t middle = start + size / 2;
+        auto leftTask = std::async(std::launch::async, [&get, start, middle, depth]
+        {
+            return ParallelPairwiseSum<T>(start, middle - 1, get, depth - 1);
+        });
+        const T right = ParallelPairwiseSum<T>(middle, end, get, depth - 1);
+        return static_cast<T>(leftTask.get() + right);
+    }
+
+    /// @brief Kahan-Neumaier compensated summation of get(start), ..., get(end)
+    /// @tparam T 
+    /// @tparam TGet 
+    /// @param start 
+    /// @param end 
+    /// @param get 
+    /// @return 
+    template<std::floating_point T, typename TGet>
+    T KahanNeumaierSum(const std::size_t start, const std::size_t end, TGet&& get)
+    noexcept(std::is_nothrow_invocable_v<TGet, std::size_t>)
+    {
+        T sum = 0;
+        T compensation = 0;
+
+        for (std::size_t i = start; i <= end; ++i)
+        {
+            const T value = get(i);
+            const T total = sum + value;
+            if (std::abs(sum) >= std::abs(value))
+                compensation += (sum - total) + value;
+            else
+                compensation += (value - total) + sum;
+            sum = total;
+        }
+
+        return sum + compensation;
+    }
+
+    /// @brief Sums get(start), ..., get(end) in the order defined by summationType
+    /// @tparam T 
+    /// @tparam TGet 
+    /// @param start 
+    /// @param end 
+    /// @param get 
+    /// @param summationType 
+    /// @param threadCount Maximum number of threads for PARALLEL_PAIRWISE, 0 means std::thread::hardware_concurrency()
+    /// @return 
+    template<std::floating_point T, typename TGet>
+    T SumBy(const std::size_t start, const std::size_t end, TGet&& get,
+            const SummationType summationType, const std::size_t threadCount = 0)
+    {
+        switch (summationType)
+        {
+            case SummationType::NAIVE:
+            {
+                T sum = get(start);
+                for (std::size_t i = start + 1; i <= end; ++i)
+                    sum += get(i);
+                return sum;
+            }
+            case SummationType::PAIRWISE:
+                return PairwiseSum<T>(start, end, get);
+            case SummationType::KAHAN_NEUMAIER:
+                return KahanNeumaierSum<T>(start, end, get);
+            case SummationType::PARALLEL_PAIRWISE:
+                return ParallelPairwiseSum<T>(start, end, get, static_cast<std::size_t>(
+                    std::bit_width(Parallel { .ThreadCount = threadCount }.Threads() - 1)));
+            default:
+                return LaneSum<T>(start, end, get);
+        }
+    }
+
+    /// @brief Finds the minimum and the maximum of get(start), ..., get(end) in LANES independent accumulators.
+    /// All lanes start from get(start), so a NaN in the first element is returned as both results
+    /// and NaNs elsewhere are skipped, as in a sequential pass
+    /// @tparam T 
+    /// @tparam TGet 
+    /// @param start 
+    /// @param end 
+    /// @param get 
+    /// @return Minimum and maximum
+    template<LaneArithmetic T, typename TGet>
+    std::pair<T, T> LaneMinMax(const std::size_t start, const std::size_t end, TGet&& get)
+    noexcept(std::is_nothrow_invocable_v<TGet, std::size_t>)
+    {
+        const T first = get(start);
+        std::array<T, LANES> minLanes;
+        std::array<T, LANES> maxLanes;
+        minLanes.fill(first);
+        maxLanes.fill(first);
+
+        std::size_t i = start + 1;
+        for (; end + 1 - i >= LANES; i += LANES)
+            for (std::size_t lane = 0; lane < LANES; ++lane)
+            {
+                const T value = get(i + lane);
+                minLanes[lane] = value < minLanes[lane] ? value : minLanes[lane];
+                maxLanes[lane] = maxLanes[lane] < value ? value : maxLanes[lane];
+            }
+
+        for (; i <= end; ++i)
+        {
+            const T value = get(i);
+            minLanes[0] = value < minLanes[0] ? value : minLanes[0];
+            maxLanes[0] = maxLanes[0] < value ? value : maxLanes[0];
+        }
+
+        for (std::size_t width = LANES / 2; width > 0; width /= 2)
+            for (std::size_t lane = 0; lane < width; ++lane)
+            {
+                minLanes[lane] = minLanes[lane + width] < minLanes[lane] ? minLanes[lane + width] : minLanes[lane];
+                maxLanes[lane] = maxLanes[lane] < maxLanes[lane + width] ? maxLanes[lane + width] : maxLanes[lane];
+            }
+
+        return std::make_pair(minLanes[0], maxLanes[0]);
+    }
+
     /// @brief 
     /// @tparam TResult 
     /// @tparam TCollection 
@@ -45,8 +254,7 @@ namespace ExtendedCpp::LINQ::Aggregate
     {
         std::size_t count = 0;
         for (std::size_t i = start; i <= end; ++i)
-            if (predicate(collection[i]))
-                ++count;
+            count += static_cast<bool>(predicate(collection[i])) ? 1 : 0;
         return count;
     }
 
@@ -60,6 +268,9 @@ namespace ExtendedCpp::LINQ::Aggregate
     template<Concepts::RandomAccess TCollection, Concepts::Summarize T = RandomAccessValueType<TCollection>>
     T Sum(TCollection&& collection, const std::size_t start, const std::size_t end) noexcept
     {
+        if constexpr (LaneArithmetic<T>)
+            return LaneSum<T>(start, end, [&collection](const std::size_t i) { return collection[i]; });
+
         T sum = collection[start];
         for (std::size_t i = start + 1; i <= end; ++i)
             sum += collection[i];
@@ -83,12 +294,56 @@ namespace ExtendedCpp::LINQ::Aggregate
     TResult Sum(TCollection&& collection, const std::size_t start, const std::size_t end, TSelector&& selector)
     noexcept(std::is_nothrow_invocable_v<TSelector, T>)
     {
+        if constexpr (LaneArithmetic<TResult>)
+            return LaneSum<TResult>(start, end, [&collection, &selector](const std::size_t i)
+                { return selector(collection[i]); });
+
         TResult sum = selector(collection[start]);
         for (std::size_t i = start + 1; i <= end; ++i)
             sum += selector(collection[i]);
         return sum;
     }
 
+    /// @brief 
+    /// @tparam TCollection 
+    /// @tparam T 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param summationType 
+    /// @param threadCount Maximum number of threads for PARALLEL_PAIRWISE, 0 means std::thread::hardware_concurrency()
+    /// @return 
+    template<Concepts::RandomAccess TCollection, std::floating_point T = RandomAccessValueType<TCollection>>
+    T Sum(TCollection&& collection, const std::size_t start, const std::size_t end,
+          const SummationType summationType, const std::size_t threadCount = 0)
+    {
+        return SumBy<T>(start, end, [&collection](const std::size_t i) { return collection[i]; },
+                        summationType, threadCount);
+    }
+
+    /// @brief 
+    /// @tparam T 
+    /// @tparam TCollection 
+    /// @tparam TSelector Must be safe to invoke concurrently for PARALLEL_PAIRWISE
+    /// @tparam TResult 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param selector 
+    /// @param summationType 
+    /// @param threadCount Maximum number of threads for PARALLEL_PAIRWISE, 0 means std::thread::hardware_concurrency()
+    /// @return 
+    template<Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>,
+             std::invocable<T> TSelector,
+             std::floating_point TResult = std::invoke_result_t<TSelector, T>>
+    TResult Sum(TCollection&& collection, const std::size_t start, const std::size_t end, TSelector&& selector,
+                const SummationType summationType, const std::size_t threadCount = 0)
+    {
+        return SumBy<TResult>(start, end, [&collection, &selector](const std::size_t i)
+            { return selector(collection[i]); }, summationType, threadCount);
+    }
+
     /// @brief 
     /// @tparam TCollection 
     /// @tparam T 
@@ -100,6 +355,9 @@ namespace ExtendedCpp::LINQ::Aggregate
              Concepts::Comparable T = RandomAccessValueType<TCollection>>
     T Min(TCollection&& collection, const std::size_t start, const std::size_t end) noexcept
     {
+        if constexpr (LaneArithmetic<T>)
+            return LaneMinMax<T>(start, end, [&collection](const std::size_t i) { return collection[i]; }).first;
+
         T min = collection[start];
         for (std::size_t i = start + 1; i <= end; ++i)
             if (collection[i] < min)
@@ -124,6 +382,10 @@ namespace ExtendedCpp::LINQ::Aggregate
     TResult Min(TCollection&& collection, const std::size_t start, const std::size_t end, TSelector&& selector)
     noexcept(std::is_nothrow_invocable_v<TSelector, T>)
     {
+        if constexpr (LaneArithmetic<TResult>)
+            return LaneMinMax<TResult>(start, end, [&collection, &selector](const std::size_t i)
+                { return selector(collection[i]); }).first;
+
         TResult min = selector(collection[start]);
         for (std::size_t i = start + 1; i <= end; ++i)
             if (selector(collection[i]) < min)
@@ -141,6 +403,9 @@ namespace ExtendedCpp::LINQ::Aggregate
     template<Concepts::RandomAccess TCollection, Concepts::Comparable T = RandomAccessValueType<TCollection>>
     T Max(TCollection&& collection, const std::size_t start, const std::size_t end) noexcept
     {
+        if constexpr (LaneArithmetic<T>)
+            return LaneMinMax<T>(start, end, [&collection](const std::size_t i) { return collection[i]; }).second;
+
         T max = collection[start];
         for (std::size_t i = start + 1; i <= end; ++i)
             if (max < collection[i])
@@ -165,6 +430,10 @@ namespace ExtendedCpp::LINQ::Aggregate
     TResult Max(TCollection&& collection, const std::size_t start, const std::size_t end, TSelector&& selector)
     noexcept(std::is_nothrow_invocable_v<TSelector, T>)
     {
+        if constexpr (LaneArithmetic<TResult>)
+            return LaneMinMax<TResult>(start, end, [&collection, &selector](const std::size_t i)
+                { return selector(collection[i]); }).second;
+
         TResult max = selector(collection[start]);
         for (std::size_t i = start + 1; i <= end; ++i)
             if (max < selector(collection[i]))
@@ -172,6 +441,66 @@ namespace ExtendedCpp::LINQ::Aggregate
         return max;
     }
 
+    /// @brief Finds the minimum and the maximum in one pass
+    /// @tparam TCollection 
+    /// @tparam T 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @return Minimum and maximum
+    template<Concepts::RandomAccess TCollection, Concepts::Comparable T = RandomAccessValueType<TCollection>>
+    std::pair<T, T> MinMax(TCollection&& collection, const std::size_t start, const std::size_t end) noexcept
+    {
+        if constexpr (LaneArithmetic<T>)
+            return LaneMinMax<T>(start, end, [&collection](const std::size_t i) { return collection[i]; });
+
+        T min = collection[start];
+        T max = collection[start];
+        for (std::size_t i = start + 1; i <= end; ++i)
+        {
+            if (collection[i] < min)
+                min = collection[i];
+            else if (max < collection[i])
+                max = collection[i];
+        }
+        return std::make_pair(std::move(min), std::move(max));
+    }
+
+    /// @brief Finds the minimum and the maximum of the selected values in one pass
+    /// @tparam T 
+    /// @tparam TCollection 
+    /// @tparam TSelector 
+    /// @tparam TResult 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param selector 
+    /// @return Minimum and maximum
+    template<Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>,
+             std::invocable<T> TSelector,
+             Concepts::Comparable TResult = std::invoke_result_t<TSelector, T>>
+    std::pair<TResult, TResult> MinMax(TCollection&& collection, const std::size_t start, const std::size_t end,
+                                       TSelector&& selector)
+    noexcept(std::is_nothrow_invocable_v<TSelector, T>)
+    {
+        if constexpr (LaneArithmetic<TResult>)
+            return LaneMinMax<TResult>(start, end, [&collection, &selector](const std::size_t i)
+                { return selector(collection[i]); });
+
+        TResult min = selector(collection[start]);
+        TResult max = min;
+        for (std::size_t i = start + 1; i <= end; ++i)
+        {
+            TResult value = selector(collection[i]);
+            if (value < min)
+                min = std::move(value);
+            else if (max < value)
+                max = std::move(value);
+        }
+        return std::make_pair(std::move(min), std::move(max));
+    }
+
     /// @brief 
     /// @tparam TCollection 
     /// @tparam T 
@@ -182,6 +511,10 @@ namespace ExtendedCpp::LINQ::Aggregate
     template<Concepts::RandomAccess TCollection, Concepts::Divisible T = RandomAccessValueType<TCollection>>
     T Average(TCollection&& collection, const std::size_t start, const std::size_t end) noexcept
     {
+        if constexpr (LaneArithmetic<T>)
+            return static_cast<T>(LaneSum<T>(start, end, [&collection](const std::size_t i) { return collection[i]; }) /
+                                  (end + 1 - start));
+
         T sum = collection[start];
         for (std::size_t i = start + 1; i <= end; ++i)
             sum += collection[i];
@@ -205,11 +538,54 @@ namespace ExtendedCpp::LINQ::Aggregate
     TResult Average(TCollection&& collection, const std::size_t start, const std::size_t end, TSelector&& selector)
     noexcept(std::is_nothrow_invocable_v<TSelector, T>)
     {
+        if constexpr (LaneArithmetic<TResult>)
+            return static_cast<TResult>(LaneSum<TResult>(start, end, [&collection, &selector](const std::size_t i)
+                { return selector(collection[i]); }) / (end + 1 - start));
+
         TResult sum = selector(collection[start]);
         for (std::size_t i = start + 1; i <= end; ++i)
             sum += selector(collection[i]);
         return static_cast<TResult>(sum / (end + 1 - start));
     }
+
+    /// @brief 
+    /// @tparam TCollection 
+    /// @tparam T 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param summationType 
+    /// @param threadCount Maximum number of threads for PARALLEL_PAIRWISE, 0 means std::thread::hardware_concurrency()
+    /// @return 
+    template<Concepts::RandomAccess TCollection, std::floating_point T = RandomAccessValueType<TCollection>>
+    T Average(TCollection&& collection, const std::size_t start, const std::size_t end,
+              const SummationType summationType, const std::size_t threadCount = 0)
+    {
+        return Sum(collection, start, end, summationType, threadCount) / static_cast<T>(end + 1 - start);
+    }
+
+    /// @brief 
+    /// @tparam T 
+    /// @tparam TCollection 
+    /// @tparam TSelector Must be safe to invoke concurrently for PARALLEL_PAIRWISE
+    /// @tparam TResult 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param selector 
+    /// @param summationType 
+    /// @param threadCount Maximum number of threads for PARALLEL_PAIRWISE, 0 means std::thread::hardware_concurrency()
+    /// @return 
+    template<Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>,
+             std::invocable<T> TSelector,
+             std::floating_point TResult = std::invoke_result_t<TSelector, T>>
+    TResult Average(TCollection&& collection, const std::size_t start, const std::size_t end, TSelector&& selector,
+                    const SummationType summationType, const std::size_t threadCount = 0)
+    {
+        return Sum(collection, start, end, std::forward<TSelector>(selector), summationType, threadCount) /
+               static_cast<TResult>(end + 1 - start);
+    }
 }
 
 #endif
\ No newline at end of file
@@ -3,12 +3,23 @@
 
 #include <map>
 #include <memory>
+#include <vector>
+#include <cstdint>
 #include <limits>
 #include <concepts>
 #include <type_traits>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <utility>
+#include <future>
 
 #include <ExtendedCpp/LINQ/TypeTraits.h>
 #include <ExtendedCpp/LINQ/Concepts.h>
+#include <ExtendedCpp/LINQ/FlatHashMap.h>
+#include <ExtendedCpp/LINQ/Parallel.h>
 
 /// @brief 
 namespace ExtendedCpp::LINQ
@@ -20,34 +31,139 @@ namespace ExtendedCpp::LINQ
 /// @brief 
 namespace ExtendedCpp::LINQ::Algorithm
 {
-    /// @brief 
+    /// @brief Hint to load the cache line of the address, which is needed soon
+    /// @param address 
+    inline void Prefetch([[maybe_unused]] const void* address) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address);
+#endif
+    }
+
+    /// @brief Branchless binary search: the range is halved by a conditional move, so the loop has no
+    /// unpredictable branches and the number of iterations depends only on the size
     /// @tparam TTarget 
     /// @tparam TCollection 
     /// @param target 
     /// @param collection 
     /// @param start 
     /// @param end 
-    /// @return 
+    /// @return Index of the first element in [start, end] that is not less than target, or end + 1
     template<Concepts::Comparable TTarget, Concepts::RandomAccess TCollection>
-    requires std::same_as<TTarget, RandomAccessValueType<TCollection>>
-    std::size_t BinarySearch(TTarget&& target, TCollection&& collection,
-                             const std::size_t start, const std::size_t end) noexcept
+    requires std::same_as<std::decay_t<TTarget>, RandomAccessValueType<TCollection>>
+    std::size_t LowerBound(const TTarget& target, TCollection&& collection,
+                           const std::size_t start, const std::size_t end) noexcept
     {
-        if (end - start <= 1)
+        std::size_t base = start;
+        std::size_t size = end - start + 1;
+
+        while (size > 1)
         {
-            if (target == collection[start])
-                return start;
-            if (target == collection[end])
-                return end;
-            return NPOS;
+            const std::size_t half = size / 2;
+            base = collection[base + half - 1] < target ? base + half : base;
+            size -= half;
         }
 
-        const std::size_t mid = (end + start) / 2;
-        if (target < collection[mid])
-            return BinarySearch(std::forward<TTarget>(target), std::forward<TCollection>(collection), start, mid - 1);
-        if (collection[mid] < target)
-            return BinarySearch(std::forward<TTarget>(target), std::forward<TCollection>(collection), mid + 1, end);
-        return mid;
+        return base + (collection[base] < target ? 1 : 0);
+    }
+
+    /// @brief Branchless binary search by the keys of elements
+    /// @tparam TTarget 
+    /// @tparam TCollection 
+    /// @tparam TCollectionType 
+    /// @tparam TSelector 
+    /// @param target 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param selector 
+    /// @return Index of the first element in [start, end] whose key is not less than target, or end + 1
+    template<Concepts::Comparable TTarget,
+             Concepts::RandomAccess TCollection,
+             typename TCollectionType = RandomAccessValueType<TCollection>,
+             std::invocable<TCollectionType> TSelector>
+    requires std::same_as<std::invoke_result_t<TSelector, TCollectionType>, std::decay_t<TTarget>>
+    std::size_t LowerBound(const TTarget& target, TCollection&& collection,
+                           const std::size_t start, const std::size_t end, TSelector&& selector)
+    noexcept(std::is_nothrow_invocable_v<TSelector, TCollectionType>)
+    {
+        std::size_t base = start;
+        std::size_t size = end - start + 1;
+
+        while (size > 1)
+        {
+            const std::size_t half = size / 2;
+            base = selector(collection[base + half - 1]) < target ? base + half : base;
+            size -= half;
+        }
+
+        return base + (selector(collection[base]) < target ? 1 : 0);
+    }
+
+    /// @brief Number of searches of BatchLowerBound, which run together. Their memory loads do not depend
+    /// on each other, so the processor waits for the cache misses of the group at once
+    constexpr std::size_t BATCH_SEARCH_GROUP_SIZE = 16;
+
+    /// @brief LowerBound of many keys. Searches of a group move through the levels together and each of them
+    /// prefetches its element of the next level, so the latency of memory is hidden
+    /// @tparam TKeys 
+    /// @tparam TCollection 
+    /// @param keys 
+    /// @param keysCount 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param results Receives keysCount indexes, end + 1 for keys greater than all elements
+    template<Concepts::RandomAccess TKeys, Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>>
+    requires std::same_as<RandomAccessValueType<TKeys>, T> && Concepts::Comparable<T>
+    void BatchLowerBound(TKeys&& keys, const std::size_t keysCount, TCollection&& collection,
+                         const std::size_t start, const std::size_t end, std::size_t* results) noexcept
+    {
+        std::array<std::size_t, BATCH_SEARCH_GROUP_SIZE> bases;
+
+        for (std::size_t first = 0; first < keysCount; first += BATCH_SEARCH_GROUP_SIZE)
+        {
+            const std::size_t count = std::min(BATCH_SEARCH_GROUP_SIZE, keysCount - first);
+            bases.fill(start);
+
+            std::size_t size = end - start + 1;
+            while (size > 1)
+            {
+                const std::size_t half = size / 2;
+                const std::size_t quarter = (size - half) / 2;
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const std::size_t base = collection[bases[i] + half - 1] < keys[first + i] ? bases[i] + half : bases[i];
+                    if (quarter > 0)
+                        Prefetch(std::addressof(collection[base + quarter - 1]));
+                    bases[i] = base;
+                }
+                size -= half;
+            }
+
+            for (std::size_t i = 0; i < count; ++i)
+                results[first + i] = bases[i] + (collection[bases[i]] < keys[first + i] ? 1 : 0);
+        }
+    }
+
+    /// @brief 
+    /// @tparam TTarget 
+    /// @tparam TCollection 
+    /// @param target 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @return Index of the first equal element or NPOS
+    template<Concepts::Comparable TTarget, Concepts::RandomAccess TCollection>
+    requires std::same_as<std::decay_t<TTarget>, RandomAccessValueType<TCollection>>
+    std::size_t BinarySearch(TTarget&& target, TCollection&& collection,
+                             const std::size_t start, const std::size_t end) noexcept
+    {
+        const std::size_t index = LowerBound(target, collection, start, end);
+        if (index <= end && collection[index] == target)
+            return index;
+        return NPOS;
     }
 
     /// @brief 
@@ -60,33 +176,205 @@ namespace ExtendedCpp::LINQ::Algorithm
     /// @param start 
     /// @param end 
     /// @param selector 
-    /// @return 
+    /// @return Index of the first element with equal key or NPOS
     template<Concepts::Comparable TTarget,
              Concepts::RandomAccess TCollection,
              typename TCollectionType = RandomAccessValueType<TCollection>,
              std::invocable<TCollectionType> TSelector>
-    requires std::same_as<std::invoke_result_t<TSelector, TCollectionType>, TTarget>
+    requires std::same_as<std::invoke_result_t<TSelector, TCollectionType>, std::decay_t<TTarget>>
     std::size_t BinarySearch(TTarget&& target, TCollection&& collection,
                              const std::size_t start, const std::size_t end, TSelector&& selector)
     noexcept(std::is_nothrow_invocable_v<TSelector, TCollectionType>)
     {
-        if (end - start <= 1)
+        const std::size_t index = LowerBound(target, collection, start, end, selector);
+        if (index <= end && selector(collection[index]) == target)
+            return index;
+        return NPOS;
+    }
+
+    /// @brief Integer keys, whose range is up to this size, are counted in an array instead of a hash map
+    constexpr std::size_t DENSE_HISTOGRAM_RANGE = 1 << 16;
+
+    /// @brief Minimum number of elements counted by one thread of ParallelHistogramBy
+    constexpr std::size_t PARALLEL_HISTOGRAM_THRESHOLD = 1 << 15;
+
+    /// @brief Counts equal values of get(start), ..., get(end) in a flat hash map. Integers with a range
+    /// not much larger than the number of values are counted in an array indexed by the value
+    /// @tparam T 
+    /// @tparam TGet 
+    /// @param start 
+    /// @param end 
+    /// @param get 
+    /// @return Number of occurrences of every value in the order of first occurrence
+    template<std::copyable T, std::invocable<std::size_t> TGet>
+    requires Concepts::Hashable<T> && Concepts::Equatable<T>
+    FlatHashMap<T, std::size_t> HistogramBy(const std::size_t start, const std::size_t end, TGet&& get)
+    {
+        FlatHashMap<T, std::size_t> histogram;
+
+        if constexpr (std::integral<T> && !std::same_as<T, bool>)
         {
-            if (target == selector(collection[start]))
-                return start;
-            if (target == selector(collection[end]))
-                return end;
-            return NPOS;
+            using TUnsigned = std::make_unsigned_t<T>;
+
+            T min = get(start);
+            T max = min;
+            for (std::size_t i = start + 1; i <= end; ++i)
+            {
+                const T value = get(i);
+                min = value < min ? value : min;
+                max = value > max ? value : max;
+            }
+
+            const auto offset = [min](const T value) noexcept
+            {
+                return static_cast<std::size_t>(static_cast<TUnsigned>(static_cast<TUnsigned>(value) -
+                                                                       static_cast<TUnsigned>(min)));
+            };
+
+            if (offset(max) < DENSE_HISTOGRAM_RANGE && offset(max) <= 2 * (end - start + 1))
+            {
+                std::vector<std::size_t> counts(offset(max) + 1, 0);
+                for (std::size_t i = start; i <= end; ++i)
+                    ++counts[offset(get(i))];
+
+                // Second pass restores the order of first occurrence, every count is taken once.
+                for (std::size_t i = start; i <= end; ++i)
+                {
+                    const T value = get(i);
+                    if (counts[offset(value)] != 0)
+                        histogram[value] = std::exchange(counts[offset(value)], 0);
+                }
+
+                return histogram;
+            }
+        }
+
+        for (std::size_t i = start; i <= end; ++i)
+            ++histogram[get(i)];
+
+        return histogram;
+    }
+
+    /// @brief Counts equal values of get(start), ..., get(end) by several threads. Each of them builds
+    /// its own histogram of a part, then they are merged in the order of the parts
+    /// @tparam T 
+    /// @tparam TGet 
+    /// @param start 
+    /// @param end 
+    /// @param get Invoked concurrently
+    /// @param threadCount Maximum number of threads, 0 means std::thread::hardware_concurrency()
+    /// @return Number of occurrences of every value in the order of first occurrence
+    template<std::copyable T, std::invocable<std::size_t> TGet>
+    requires Concepts::Hashable<T> && Concepts::Equatable<T>
+    FlatHashMap<T, std::size_t> ParallelHistogramBy(const std::size_t start, const std::size_t end, TGet&& get,
+                                                    const std::size_t threadCount = 0)
+    {
+        const std::size_t count = end - start + 1;
+        const std::size_t parts = std::min(Parallel { .ThreadCount = threadCount }.Threads(),
+                                           count / PARALLEL_HISTOGRAM_THRESHOLD);
+        if (parts <= 1)
+            return HistogramBy<T>(start, end, get);
+
+        const std::size_t partSize = count / parts;
+        std::vector<std::future<FlatHashMap<T, std::size_t>>> tasks;
+        tasks.reserve(parts - 1);
+        for (std::size_t part = 1; part < parts; ++part)
+        {
+            const std::size_t partStart = start + part * partSize;
+            const std::size_t partEnd = part + 1 == parts ? end : partStart + partSize - 1;
+            tasks.push_back(std::async(std::launch::async, [&get, partStart, partEnd]
+            {
+                return HistogramBy<T>(partStart, partEnd, get);
+            }));
         }
 
-        const std::size_t mid = (end + start) / 2;
-        if (target < selector(collection[mid]))
-            return BinarySearch(std::forward<TTarget>(target), std::forward<TCollection>(collection),
-                                start, mid - 1, std::forward<TSelector>(selector));
-        if (selector(collection[mid]) < target)
-            return BinarySearch(std::forward<TTarget>(target), std::forward<TCollection>(collection),
-                                mid + 1, end, std::forward<TSelector>(selector));
-        return mid;
+        FlatHashMap<T, std::size_t> histogram = HistogramBy<T>(start, start + partSize - 1, get);
+        for (auto& task : tasks)
+            for (const auto& [key, keyCount] : task.get())
+                histogram[key] += keyCount;
+
+        return histogram;
+    }
+
+    /// @brief 
+    /// @tparam TCollection 
+    /// @tparam T 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @return Number of occurrences of every element in the order of first occurrence
+    template<Concepts::RandomAccess TCollection, typename T = RandomAccessValueType<TCollection>>
+    requires Concepts::Hashable<T> && Concepts::Equatable<T> && std::copyable<T>
+    FlatHashMap<T, std::size_t> Histogram(TCollection&& collection, const std::size_t start, const std::size_t end)
+    {
+        return HistogramBy<T>(start, end, [&collection](const std::size_t i) { return collection[i]; });
+    }
+
+    /// @brief 
+    /// @tparam TCollection 
+    /// @tparam TCollectionType 
+    /// @tparam TSelector 
+    /// @tparam TKey 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param selector 
+    /// @return Number of elements with every key in the order of first occurrence
+    template<Concepts::RandomAccess TCollection,
+             typename TCollectionType = RandomAccessValueType<TCollection>,
+             std::invocable<TCollectionType> TSelector,
+             typename TKey = std::decay_t<std::invoke_result_t<TSelector, TCollectionType>>>
+    requires Concepts::Hashable<TKey> && Concepts::Equatable<TKey> && std::copyable<TKey>
+    FlatHashMap<TKey, std::size_t> Histogram(TCollection&& collection, const std::size_t start, const std::size_t end,
+                                             TSelector&& selector)
+    {
+        return HistogramBy<TKey>(start, end, [&collection, &selector](const std::size_t i)
+        {
+            return selector(collection[i]);
+        });
+    }
+
+    /// @brief 
+    /// @tparam TCollection 
+    /// @tparam T 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param threadCount Maximum number of threads, 0 means std::thread::hardware_concurrency()
+    /// @return Number of occurrences of every element in the order of first occurrence
+    template<Concepts::RandomAccess TCollection, typename T = RandomAccessValueType<TCollection>>
+    requires Concepts::Hashable<T> && Concepts::Equatable<T> && std::copyable<T>
+    FlatHashMap<T, std::size_t> ParallelHistogram(TCollection&& collection, const std::size_t start,
+                                                  const std::size_t end, const std::size_t threadCount = 0)
+    {
+        return ParallelHistogramBy<T>(start, end, [&collection](const std::size_t i) { return collection[i]; },
+                                      threadCount);
+    }
+
+    /// @brief 
+    /// @tparam TCollection 
+    /// @tparam TCollectionType 
+    /// @tparam TSelector Must be safe to invoke concurrently
+    /// @tparam TKey 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param selector 
+    /// @param threadCount Maximum number of threads, 0 means std::thread::hardware_concurrency()
+    /// @return Number of elements with every key in the order of first occurrence
+    template<Concepts::RandomAccess TCollection,
+             typename TCollectionType = RandomAccessValueType<TCollection>,
+             std::invocable<TCollectionType> TSelector,
+             typename TKey = std::decay_t<std::invoke_result_t<TSelector, TCollectionType>>>
+    requires Concepts::Hashable<TKey> && Concepts::Equatable<TKey> && std::copyable<TKey>
+    FlatHashMap<TKey, std::size_t> ParallelHistogram(TCollection&& collection, const std::size_t start,
+                                                     const std::size_t end, TSelector&& selector,
+                                                     const std::size_t threadCount = 0)
+    {
+        return ParallelHistogramBy<TKey>(start, end, [&collection, &selector](const std::size_t i)
+        {
+            return selector(collection[i]);
+        }, threadCount);
     }
 
     /// @brief 
@@ -101,17 +389,150 @@ namespace ExtendedCpp::LINQ::Algorithm
     {
         std::map<T, std::size_t> equalKeyCounts;
 
-        for (std::size_t i = start; i < end - start; ++i)
+        if constexpr (Concepts::Hashable<T> && std::copyable<T>)
         {
-            if (!equalKeyCounts.contains(collection[i]))
-                equalKeyCounts[collection[i]] = 0;
-            ++equalKeyCounts[collection[i]];
+            for (const auto& [key, count] : Histogram(collection, start, end))
+                equalKeyCounts.emplace(key, count);
+        }
+        else
+        {
+            for (std::size_t i = start; i <= end; ++i)
+                ++equalKeyCounts.try_emplace(collection[i], 0).first->second;
         }
 
         return equalKeyCounts;
     }
 
-    /// @brief 
+    /// @brief Last row of the table of common subsequence lengths of first[firstStart, firstEnd)
+    /// and second[secondStart, secondEnd). Only this row is kept, so memory is linear
+    /// @tparam reverse Sequences are compared from their ends
+    /// @tparam TCollection 
+    /// @tparam TOtherCollection 
+    /// @param first 
+    /// @param firstStart 
+    /// @param firstEnd 
+    /// @param second 
+    /// @param secondStart 
+    /// @param secondEnd 
+    /// @param row Receives secondEnd - secondStart + 1 lengths
+    template<bool reverse, Concepts::RandomAccess TCollection, Concepts::RandomAccess TOtherCollection>
+    requires std::same_as<RandomAccessValueType<TCollection>, RandomAccessValueType<TOtherCollection>> &&
+             Concepts::Equatable<RandomAccessValueType<TCollection>>
+    void CommonSubsequenceRow(TCollection&& first, const std::size_t firstStart, const std::size_t firstEnd,
+                              TOtherCollection&& second, const std::size_t secondStart, const std::size_t secondEnd,
+                              std::size_t* row) noexcept
+    {
+        const std::size_t secondSize = secondEnd - secondStart;
+        std::fill(row, row + secondSize + 1, 0);
+
+        for (std::size_t i = 0; i < firstEnd - firstStart; ++i)
+        {
+            const auto& element = reverse ? first[firstEnd - 1 - i] : first[firstStart + i];
+            std::size_t diagonal = 0;
+            for (std::size_t j = 1; j <= secondSize; ++j)
+            {
+                const std::size_t upper = row[j];
+                const auto& other = reverse ? second[secondEnd - j] : second[secondStart + j - 1];
+                row[j] = element == other ? diagonal + 1 : std::max(upper, row[j - 1]);
+                diagonal = upper;
+            }
+        }
+    }
+
+    /// @brief Length of the longest common subsequence by rows of the table, O(firstSize * secondSize) time
+    /// and O(min(firstSize, secondSize)) memory
+    /// @tparam TCollection 
+    /// @tparam TOtherCollection 
+    /// @param firstSequence 
+    /// @param firstSize 
+    /// @param secondSequence 
+    /// @param secondSize 
+    /// @return 
+    template<Concepts::RandomAccess TCollection, Concepts::RandomAccess TOtherCollection>
+    requires std::same_as<RandomAccessValueType<TCollection>, RandomAccessValueType<TOtherCollection>> &&
+             Concepts::Equatable<RandomAccessValueType<TCollection>>
+    std::size_t CountCommonSubsequenceByRows(TCollection&& firstSequence, const std::size_t firstSize,
+                                             TOtherCollection&& secondSequence, const std::size_t secondSize) noexcept
+    {
+        if (firstSize < secondSize)
+        {
+            std::vector<std::size_t> row(firstSize + 1);
+            CommonSubsequenceRow<false>(secondSequence, 0, secondSize, firstSequence, 0, firstSize, row.data());
+            return row[firstSize];
+        }
+
+        std::vector<std::size_t> row(secondSize + 1);
+        CommonSubsequenceRow<false>(firstSequence, 0, firstSize, secondSequence, 0, secondSize, row.data());
+        return row[secondSize];
+    }
+
+    /// @brief Length of the longest common subsequence by the bit-parallel algorithm of Allison-Dix and Hyyro.
+    /// A column of the table is kept as bits of the first sequence and is updated by one addition per 64 elements,
+    /// so the time is O(firstSize * secondSize / 64) and the memory is O(alphabetSize * firstSize / 64) bits
+    /// @tparam TCollection 
+    /// @tparam TOtherCollection 
+    /// @tparam TSymbol 
+    /// @param firstSequence 
+    /// @param firstSize 
+    /// @param secondSequence 
+    /// @param secondSize 
+    /// @param symbolOf Gives the index of the element in the alphabet, or NPOS for elements absent in the first sequence
+    /// @param alphabetSize Number of different elements of the first sequence
+    /// @return 
+    template<Concepts::RandomAccess TCollection, Concepts::RandomAccess TOtherCollection,
+             typename T = RandomAccessValueType<TCollection>,
+             std::invocable<T> TSymbol>
+    requires std::same_as<T, RandomAccessValueType<TOtherCollection>> &&
+             std::convertible_to<std::invoke_result_t<TSymbol, T>, std::size_t>
+    std::size_t CountCommonSubsequenceBitParallel(TCollection&& firstSequence, const std::size_t firstSize,
+                                                  TOtherCollection&& secondSequence, const std::size_t secondSize,
+                                                  TSymbol&& symbolOf, const std::size_t alphabetSize) noexcept
+    {
+        constexpr std::size_t WORD_BITS = std::numeric_limits<std::uint64_t>::digits;
+        const std::size_t words = (firstSize + WORD_BITS - 1) / WORD_BITS;
+
+        std::vector<std::uint64_t> matches(alphabetSize * words, 0);
+        for (std::size_t i = 0; i < firstSize; ++i)
+            matches[symbolOf(firstSequence[i]) * words + i / WORD_BITS] |= std::uint64_t{1} << (i % WORD_BITS);
+
+        // Zero bits of the column mark the elements of the first sequence, where its common subsequence grows.
+        std::vector<std::uint64_t> column(words, ~std::uint64_t{0});
+        for (std::size_t j = 0; j < secondSize; ++j)
+        {
+            const std::size_t symbol = symbolOf(secondSequence[j]);
+            if (symbol == NPOS)
+                continue;
+
+            const std::uint64_t* match = matches.data() + symbol * words;
+            std::uint64_t carry = 0;
+            for (std::size_t w = 0; w < words; ++w)
+            {
+                const std::uint64_t matched = column[w] & match[w];
+                const std::uint64_t carried = column[w] + carry;
+                const std::uint64_t sum = carried + matched;
+                carry = (carried < carry ? 1 : 0) | (sum < matched ? 1 : 0);
+                column[w] = sum | (column[w] & ~match[w]);
+            }
+        }
+
+        std::size_t ones = 0;
+        for (std::size_t w = 0; w + 1 < words; ++w)
+            ones += static_cast<std::size_t>(std::popcount(column[w]));
+        if (words > 0)
+        {
+            const std::size_t lastBits = firstSize - (words - 1) * WORD_BITS;
+            const std::uint64_t mask = lastBits == WORD_BITS ? ~std::uint64_t{0} : (std::uint64_t{1} << lastBits) - 1;
+            ones += static_cast<std::size_t>(std::popcount(column[words - 1] & mask));
+        }
+
+        return firstSize - ones;
+    }
+
+    /// @brief Alphabets up to this size are compared by CountCommonSubsequenceBitParallel
+    constexpr std::size_t BIT_PARALLEL_ALPHABET_SIZE = 256;
+
+    /// @brief Length of the longest common subsequence. Sequences of bytes and of comparable elements
+    /// with a small alphabet are compared bit-parallel, other sequences by rows of the table
     /// @tparam TCollection 
     /// @tparam TOtherCollection 
     /// @param firstSequence 
@@ -125,54 +546,382 @@ namespace ExtendedCpp::LINQ::Algorithm
     std::size_t CountCommonSubsequence(TCollection&& firstSequence, const std::size_t firstSize,
                                        TOtherCollection&& secondSequence, const std::size_t secondSize) noexcept
     {
-        std::unique_ptr<std::unique_ptr<size_t[]>[]> LCSTable(new std::unique_ptr<size_t[]>[firstSize + 1]);
+        using T = RandomAccessValueType<TCollection>;
+
+        if (firstSize > secondSize)
+            return CountCommonSubsequence(secondSequence, secondSize, firstSequence, firstSize);
+        if (firstSize == 0)
+            return 0;
 
-        for (std::size_t i = 0; i <= firstSize; ++i)
+        if constexpr (std::integral<T> && sizeof(T) == 1)
         {
-            LCSTable[i] = std::unique_ptr<std::size_t[]>(new std::size_t[secondSize + 1]);
-            for (std::size_t j = 0; j <= secondSize; ++j)
-                LCSTable[i][j] = 0;
+            return CountCommonSubsequenceBitParallel(firstSequence, firstSize, secondSequence, secondSize,
+                [](const T element) noexcept { return static_cast<std::size_t>(static_cast<unsigned char>(element)); },
+                BIT_PARALLEL_ALPHABET_SIZE);
         }
+        else if constexpr (Concepts::Comparable<T> && std::copyable<T>)
+        {
+            std::vector<T> alphabet;
+            alphabet.reserve(firstSize);
+            for (std::size_t i = 0; i < firstSize; ++i)
+                alphabet.push_back(firstSequence[i]);
+            std::sort(alphabet.begin(), alphabet.end());
+            alphabet.erase(std::unique(alphabet.begin(), alphabet.end()), alphabet.end());
 
-        for (std::size_t i = 1; i <= firstSize; ++i)
-            for (std::size_t j = 1; j <= secondSize; ++j)
+            if (alphabet.size() <= BIT_PARALLEL_ALPHABET_SIZE)
+                return CountCommonSubsequenceBitParallel(firstSequence, firstSize, secondSequence, secondSize,
+                    [&alphabet](const T& element)
+                    {
+                        const std::size_t index = LowerBound(element, alphabet, 0, alphabet.size() - 1);
+                        return index < alphabet.size() && alphabet[index] == element ? index : NPOS;
+                    },
+                    alphabet.size());
+        }
+
+        return CountCommonSubsequenceByRows(firstSequence, firstSize, secondSequence, secondSize);
+    }
+
+    /// @brief 
+    enum class EditOperationType
+    {
+        Keep,
+        Remove,
+        Insert
+    };
+
+    /// @brief Step of the transformation of the first sequence into the second one
+    struct EditOperation final
+    {
+        /// @brief 
+        EditOperationType type;
+
+        /// @brief Index in the first sequence, NPOS for inserted elements
+        std::size_t firstIndex;
+
+        /// @brief Index in the second sequence, NPOS for removed elements
+        std::size_t secondIndex;
+
+        /// @brief 
+        /// @param other 
+        /// @return 
+        bool operator==(const EditOperation& other) const noexcept = default;
+    };
+
+    /// @brief Hirschberg's division: the middle row of the first sequence is matched with the column of the second one,
+    /// where the sum of the forward and the backward lengths is maximal, and both halves are solved separately
+    /// @tparam TCollection 
+    /// @tparam TOtherCollection 
+    /// @param first 
+    /// @param firstStart 
+    /// @param firstEnd 
+    /// @param second 
+    /// @param secondStart 
+    /// @param secondEnd 
+    /// @param forward Row buffer of the size of the second sequence + 1
+    /// @param backward Row buffer of the size of the second sequence + 1
+    /// @param script 
+    template<Concepts::RandomAccess TCollection, Concepts::RandomAccess TOtherCollection>
+    void HirschbergEditScript(TCollection&& first, const std::size_t firstStart, const std::size_t firstEnd,
+                              TOtherCollection&& second, const std::size_t secondStart, const std::size_t secondEnd,
+                              std::size_t* forward, std::size_t* backward, std::vector<EditOperation>& script)
+    {
+        if (firstStart == firstEnd)
+        {
+            for (std::size_t j = secondStart; j < secondEnd; ++j)
+                script.push_back({ EditOperationType::Insert, NPOS, j });
+            return;
+        }
+
+        if (secondStart == secondEnd)
+        {
+            for (std::size_t i = firstStart; i < firstEnd; ++i)
+                script.push_back({ EditOperationType::Remove, i, NPOS });
+            return;
+        }
+
+        if (firstEnd - firstStart == 1)
+        {
+            std::size_t match = secondStart;
+            while (match < secondEnd && !(first[firstStart] == second[match]))
+                ++match;
+
+            if (match == secondEnd)
+                script.push_back({ EditOperationType::Remove, firstStart, NPOS });
+            for (std::size_t j = secondStart; j < secondEnd; ++j)
+            {
+                if (j == match)
+                    script.push_back({ EditOperationType::Keep, firstStart, j });
+                else
+                    script.push_back({ EditOperationType::Insert, NPOS, j });
+            }
+            return;
+        }
+
+        const std::size_t middle = firstStart + (firstEnd - firstStart) / 2;
+        const std::size_t secondSize = secondEnd - secondStart;
+        CommonSubsequenceRow<false>(first, firstStart, middle, second, secondStart, secondEnd, forward);
+        CommonSubsequenceRow<true>(first, middle, firstEnd, second, secondStart, secondEnd, backward);
+
+        std::size_t split = 0;
+        for (std::size_t k = 1; k <= secondSize; ++k)
+            if (forward[k] + backward[secondSize - k] > forward[split] + backward[secondSize - split])
+                split = k;
+
+        HirschbergEditScript(first, firstStart, middle, second, secondStart, secondStart + split,
+                             forward, backward, script);
+        HirschbergEditScript(first, middle, firstEnd, second, secondStart + split, secondEnd,
+                             forward, backward, script);
+    }
+
+    /// @brief Shortest edit script by the longest common subsequence. Common prefix and suffix are kept as is,
+    /// the rest is divided by Hirschberg's algorithm in O(firstSize * secondSize) time and O(secondSize) memory
+    /// @tparam TCollection 
+    /// @tparam TOtherCollection 
+    /// @param firstSequence 
+    /// @param firstSize 
+    /// @param secondSequence 
+    /// @param secondSize 
+    /// @return Operations in the order of both sequences, kept elements form the longest common subsequence
+    template<Concepts::RandomAccess TCollection, Concepts::RandomAccess TOtherCollection>
+    requires std::same_as<RandomAccessValueType<TCollection>, RandomAccessValueType<TOtherCollection>> &&
+             Concepts::Equatable<RandomAccessValueType<TCollection>>
+    std::vector<EditOperation> EditScript(TCollection&& firstSequence, const std::size_t firstSize,
+                                          TOtherCollection&& secondSequence, const std::size_t secondSize)
+    {
+        std::size_t prefix = 0;
+        while (prefix < firstSize && prefix < secondSize && firstSequence[prefix] == secondSequence[prefix])
+            ++prefix;
+
+        std::size_t suffix = 0;
+        while (suffix < firstSize - prefix && suffix < secondSize - prefix &&
+               firstSequence[firstSize - 1 - suffix] == secondSequence[secondSize - 1 - suffix])
+            ++suffix;
+
+        std::vector<EditOperation> script;
+        script.reserve(std::max(firstSize, secondSize));
+
+        for (std::size_t i = 0; i < prefix; ++i)
+            script.push_back({ EditOperationType::Keep, i, i });
+
+        std::vector<std::size_t> forward(secondSize - prefix - suffix + 1);
+        std::vector<std::size_t> backward(secondSize - prefix - suffix + 1);
+        HirschbergEditScript(firstSequence, prefix, firstSize - suffix, secondSequence, prefix, secondSize - suffix,
+                             forward.data(), backward.data(), script);
+
+        for (std::size_t i = suffix; i > 0; --i)
+            script.push_back({ EditOperationType::Keep, firstSize - i, secondSize - i });
+
+        return script;
+    }
+
+    /// @brief Size of the block compared at once by Find and FilteredSearch, the comparisons of a block
+    /// do not branch and are compiled into vector instructions
+    constexpr std::size_t SEARCH_BLOCK_BYTES = 64;
+
+    /// @brief Accumulator of the comparisons of a block. Its size equals the size of the elements, otherwise
+    /// the comparisons are not vectorized
+    /// @tparam T 
+    template<typename T>
+    using SearchMask = std::conditional_t<sizeof(T) == 1, unsigned char,
+                       std::conditional_t<sizeof(T) == 2, unsigned short,
+                       std::conditional_t<sizeof(T) == 4, unsigned int, unsigned long long>>>;
+
+    /// @brief Patterns not longer than this are searched by KMP with the prefix table on the stack
+    constexpr std::size_t KMP_STACK_TABLE_SIZE = 256;
+
+    /// @brief Linear search of an element. Bytes are searched by memchr, other integers by blocks
+    /// @tparam T 
+    /// @param data 
+    /// @param size 
+    /// @param target 
+    /// @return Index of the first equal element or NPOS
+    template<Concepts::BitwiseEquatable T>
+    std::size_t Find(const T* data, const std::size_t size, const T target) noexcept
+    {
+        if constexpr (sizeof(T) == 1)
+        {
+            if (size == 0)
+                return NPOS;
+            const void* found = std::memchr(data, std::bit_cast<unsigned char>(target), size);
+            return found == nullptr ? NPOS : static_cast<std::size_t>(static_cast<const T*>(found) - data);
+        }
+        else
+        {
+            constexpr std::size_t BLOCK_SIZE = SEARCH_BLOCK_BYTES / sizeof(T);
+
+            std::size_t i = 0;
+            for (; i + BLOCK_SIZE <= size; i += BLOCK_SIZE)
             {
-                if (firstSequence[i - 1] == secondSequence[j - 1])
+                SearchMask<T> found = 0;
+                for (std::size_t j = 0; j < BLOCK_SIZE; ++j)
+                    found |= static_cast<SearchMask<T>>(data[i + j] == target);
+                if (found != 0)
+                    break;
+            }
+
+            for (; i < size; ++i)
+                if (data[i] == target)
+                    return i;
+            return NPOS;
+        }
+    }
+
+    /// @brief Start and period of the maximal suffix of the pattern by the order or by the reversed order
+    /// @tparam TCollection 
+    /// @param pattern 
+    /// @param patternSize 
+    /// @param reversed 
+    /// @return Position before the suffix, -1 for the whole pattern, and period of the suffix
+    template<Concepts::RandomAccess TCollection>
+    std::pair<std::ptrdiff_t, std::size_t> MaximalSuffix(TCollection&& pattern, const std::size_t patternSize,
+                                                         const bool reversed) noexcept
+    {
+        std::ptrdiff_t suffix = -1;
+        std::size_t j = 0;
+        std::size_t k = 1;
+        std::size_t period = 1;
+
+        while (j + k < patternSize)
+        {
+            const auto& a = pattern[j + k];
+            const auto& b = pattern[static_cast<std::size_t>(suffix + static_cast<std::ptrdiff_t>(k))];
+
+            if (reversed ? b < a : a < b)
+            {
+                j += k;
+                k = 1;
+                period = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(j) - suffix);
+            }
+            else if (a == b)
+            {
+                if (k != period)
                 {
-                    LCSTable[i][j] = LCSTable[i - 1][j - 1] + 1;
+                    ++k;
                 }
                 else
                 {
-                    if (LCSTable[i][j - 1] > LCSTable[i - 1][j])
-                        LCSTable[i][j] = LCSTable[i][j - 1];
-                    else
-                        LCSTable[i][j] = LCSTable[i - 1][j];
+                    j += period;
+                    k = 1;
                 }
             }
+            else
+            {
+                suffix = static_cast<std::ptrdiff_t>(j);
+                j = j + 1;
+                k = period = 1;
+            }
+        }
 
-        return LCSTable[firstSize][secondSize];
+        return { suffix, period };
     }
 
-    /// @brief 
+    /// @brief Two-Way string matching of Crochemore and Perrin: linear time and constant memory
     /// @tparam TCollection 
     /// @tparam TSubCollection 
     /// @param collection 
     /// @param collectionSize 
     /// @param subCollection 
-    /// @param subCollectionSize 
-    /// @return 
+    /// @param subCollectionSize Must not be zero
+    /// @return Index of the first occurrence or NPOS
     template<Concepts::RandomAccess TCollection, Concepts::RandomAccess TSubCollection>
-    requires std::same_as<RandomAccessValueType<TCollection>, RandomAccessValueType<TSubCollection>> &&
-             Concepts::Equatable<RandomAccessValueType<TCollection>>
-    bool Contains(TCollection&& collection, const std::size_t collectionSize,
-                  TSubCollection&& subCollection, const std::size_t subCollectionSize) noexcept
+    requires Concepts::Comparable<RandomAccessValueType<TCollection>>
+    std::size_t TwoWaySearch(TCollection&& collection, const std::size_t collectionSize,
+                             TSubCollection&& subCollection, const std::size_t subCollectionSize) noexcept
     {
         if (subCollectionSize > collectionSize)
-            return false;
+            return NPOS;
 
-        std::unique_ptr<std::size_t[]> prefixSizeSubCollection(new std::size_t[subCollectionSize]);
-        prefixSizeSubCollection[0] = 0;
+        const auto [suffix, period] = MaximalSuffix(subCollection, subCollectionSize, false);
+        const auto [reversedSuffix, reversedPeriod] = MaximalSuffix(subCollection, subCollectionSize, true);
+        const std::ptrdiff_t critical = suffix > reversedSuffix ? suffix : reversedSuffix;
+        std::size_t shift = suffix > reversedSuffix ? period : reversedPeriod;
+        const auto size = static_cast<std::ptrdiff_t>(subCollectionSize);
+
+        bool periodic = shift + static_cast<std::size_t>(critical + 1) <= subCollectionSize;
+        for (std::ptrdiff_t i = 0; periodic && i <= critical; ++i)
+            periodic = subCollection[static_cast<std::size_t>(i)] == subCollection[static_cast<std::size_t>(i) + shift];
 
+        const auto at = [&collection](const std::size_t position, const std::ptrdiff_t i) -> decltype(auto)
+            { return collection[position + static_cast<std::size_t>(i)]; };
+        const auto pattern = [&subCollection](const std::ptrdiff_t i) -> decltype(auto)
+            { return subCollection[static_cast<std::size_t>(i)]; };
+
+        if (periodic)
+        {
+            std::ptrdiff_t memory = -1;
+            for (std::size_t position = 0; position <= collectionSize - subCollectionSize;)
+            {
+                std::ptrdiff_t i = (critical > memory ? critical : memory) + 1;
+                while (i < size && pattern(i) == at(position, i))
+                    ++i;
+
+                if (i >= size)
+                {
+                    i = critical;
+                    while (i > memory && pattern(i) == at(position, i))
+                        --i;
+                    if (i <= memory)
+                        return position;
+                    position += shift;
+                    memory = size - static_cast<std::ptrdiff_t>(shift) - 1;
+                }
+                else
+                {
+                    position += static_cast<std::size_t>(i - critical);
+                    memory = -1;
+                }
+            }
+        }
+        else
+        {
+            shift = static_cast<std::size_t>(std::max(critical + 1, size - critical - 1) + 1);
+            for (std::size_t position = 0; position <= collectionSize - subCollectionSize;)
+            {
+                std::ptrdiff_t i = critical + 1;
+                while (i < size && pattern(i) == at(position, i))
+                    ++i;
+
+                if (i >= size)
+                {
+                    i = critical;
+                    while (i >= 0 && pattern(i) == at(position, i))
+                        --i;
+                    if (i < 0)
+                        return position;
+                    position += shift;
+                }
+                else
+                {
+                    position += static_cast<std::size_t>(i - critical);
+                }
+            }
+        }
+
+        return NPOS;
+    }
+
+    /// @brief Knuth-Morris-Pratt search for elements, which can only be compared for equality
+    /// @tparam TCollection 
+    /// @tparam TSubCollection 
+    /// @param collection 
+    /// @param collectionSize 
+    /// @param subCollection 
+    /// @param subCollectionSize Must not be zero
+    /// @return Index of the first occurrence or NPOS
+    template<Concepts::RandomAccess TCollection, Concepts::RandomAccess TSubCollection>
+    std::size_t KmpSearch(TCollection&& collection, const std::size_t collectionSize,
+                          TSubCollection&& subCollection, const std::size_t subCollectionSize)
+    {
+        std::array<std::size_t, KMP_STACK_TABLE_SIZE> stackTable;
+        std::unique_ptr<std::size_t[]> heapTable;
+        std::size_t* prefixSizeSubCollection = stackTable.data();
+        if (subCollectionSize > KMP_STACK_TABLE_SIZE)
+        {
+            heapTable = std::make_unique_for_overwrite<std::size_t[]>(subCollectionSize);
+            prefixSizeSubCollection = heapTable.get();
+        }
+
+        prefixSizeSubCollection[0] = 0;
         for (std::size_t i = 1; i < subCollectionSize; ++i)
         {
             std::size_t j = prefixSizeSubCollection[i - 1];
@@ -191,51 +940,126 @@ namespace ExtendedCpp::LINQ::Algorithm
             if (collection[i] == subCollection[j])
                 ++j;
             if (j == subCollectionSize)
-                return true;
+                return i + 1 - subCollectionSize;
         }
 
-        return false;
+        return NPOS;
     }
 
-    /// @brief 
+    /// @brief Candidates are the positions, where the first and the last elements of the pattern match.
+    /// They are found by blocks without branches and checked by memcmp. If checks cost more than the scan,
+    /// the rest is searched by Two-Way, so the time stays linear
+    /// @tparam T 
+    /// @param collection 
+    /// @param collectionSize 
+    /// @param subCollection 
+    /// @param subCollectionSize Must not be zero
+    /// @return Index of the first occurrence or NPOS
+    template<Concepts::BitwiseEquatable T>
+    std::size_t FilteredSearch(const T* collection, const std::size_t collectionSize,
+                               const T* subCollection, const std::size_t subCollectionSize) noexcept
+    {
+        if (subCollectionSize > collectionSize)
+            return NPOS;
+        if (subCollectionSize == 1)
+            return Find(collection, collectionSize, subCollection[0]);
+
+        constexpr std::size_t BLOCK_SIZE = SEARCH_BLOCK_BYTES / sizeof(T) < 16 ? 16 : SEARCH_BLOCK_BYTES / sizeof(T);
+        const T first = subCollection[0];
+        const T last = subCollection[subCollectionSize - 1];
+        const std::size_t lastOffset = subCollectionSize - 1;
+        const std::size_t positions = collectionSize - subCollectionSize + 1;
+        const auto matches = [&](const std::size_t position)
+        {
+            return std::memcmp(collection + position + 1, subCollection + 1, (subCollectionSize - 2) * sizeof(T)) == 0;
+        };
+
+        std::size_t checked = 0;
+        std::size_t position = 0;
+        for (; position + BLOCK_SIZE <= positions; position += BLOCK_SIZE)
+        {
+            SearchMask<T> found = 0;
+            for (std::size_t j = 0; j < BLOCK_SIZE; ++j)
+                found |= static_cast<SearchMask<T>>((collection[position + j] == first) &
+                                                    (collection[position + j + lastOffset] == last));
+            if (found == 0)
+                continue;
+
+            for (std::size_t j = 0; j < BLOCK_SIZE; ++j)
+            {
+                if (collection[position + j] == first && collection[position + j + lastOffset] == last)
+                {
+                    if (matches(position + j))
+                        return position + j;
+                    checked += subCollectionSize;
+                }
+            }
+
+            if (checked > 4 * (position + BLOCK_SIZE))
+            {
+                const std::size_t next = position + BLOCK_SIZE;
+                const std::size_t index = TwoWaySearch(collection + next, collectionSize - next,
+                                                       subCollection, subCollectionSize);
+                return index == NPOS ? NPOS : next + index;
+            }
+        }
+
+        for (; position < positions; ++position)
+            if (collection[position] == first && collection[position + lastOffset] == last && matches(position))
+                return position;
+
+        return NPOS;
+    }
+
+    /// @brief Contiguous collections of integers are searched by FilteredSearch, other ordered elements by Two-Way,
+    /// elements without order by KMP
     /// @tparam TCollection 
     /// @tparam TOtherCollection 
     /// @param collection 
     /// @param collectionSize 
     /// @param subCollection 
     /// @param subCollectionSize 
-    /// @return 
+    /// @return Index of the first occurrence, 0 for empty subcollection, or NPOS
     template<Concepts::RandomAccess TCollection, Concepts::RandomAccess TOtherCollection>
     requires std::same_as<RandomAccessValueType<TCollection>, RandomAccessValueType<TOtherCollection>> &&
              Concepts::Equatable<RandomAccessValueType<TCollection>>
     std::size_t IndexAt(TCollection&& collection, const std::size_t collectionSize,
                         TOtherCollection&& subCollection, const std::size_t subCollectionSize) noexcept
     {
-        std::unique_ptr<std::size_t[]> prefixSizeSubCollection(new std::size_t[subCollectionSize]);
-        prefixSizeSubCollection[0] = 0;
+        using T = RandomAccessValueType<TCollection>;
 
-        for (std::size_t i = 1; i < subCollectionSize; ++i)
-        {
-            std::size_t j = prefixSizeSubCollection[i - 1];
-            while (j > 0 && subCollection[i] != subCollection[j])
-                j = prefixSizeSubCollection[j - 1];
-            if (subCollection[i] == subCollection[j])
-                ++j;
-            prefixSizeSubCollection[i] = j;
-        }
+        if (subCollectionSize == 0)
+            return 0;
+        if (subCollectionSize > collectionSize)
+            return NPOS;
 
-        std::size_t j = 0;
-        for (std::size_t i = 0; i < collectionSize; ++i)
-        {
-            while (j > 0 && collection[i] != subCollection[j])
-                j = prefixSizeSubCollection[j - 1];
-            if (collection[i] == subCollection[j])
-                ++j;
-            if (j == subCollectionSize)
-                return i + 1 - subCollectionSize;
-        }
+        if constexpr (Concepts::BitwiseEquatable<T> &&
+                      std::is_pointer_v<std::decay_t<TCollection>> && std::is_pointer_v<std::decay_t<TOtherCollection>>)
+            return FilteredSearch<T>(collection, collectionSize, subCollection, subCollectionSize);
+        else if constexpr (Concepts::Comparable<T>)
+            return TwoWaySearch(std::forward<TCollection>(collection), collectionSize,
+                                std::forward<TOtherCollection>(subCollection), subCollectionSize);
+        else
+            return KmpSearch(std::forward<TCollection>(collection), collectionSize,
+                             std::forward<TOtherCollection>(subCollection), subCollectionSize);
+    }
 
-        return NPOS;
+    /// @brief 
+    /// @tparam TCollection 
+    /// @tparam TSubCollection 
+    /// @param collection 
+    /// @param collectionSize 
+    /// @param subCollection 
+    /// @param subCollectionSize 
+    /// @return 
+    template<Concepts::RandomAccess TCollection, Concepts::RandomAccess TSubCollection>
+    requires std::same_as<RandomAccessValueType<TCollection>, RandomAccessValueType<TSubCollection>> &&
+             Concepts::Equatable<RandomAccessValueType<TCollection>>
+    bool Contains(TCollection&& collection, const std::size_t collectionSize,
+                  TSubCollection&& subCollection, const std::size_t subCollectionSize) noexcept
+    {
+        return IndexAt(std::forward<TCollection>(collection), collectionSize,
+                       std::forward<TSubCollection>(subCollection), subCollectionSize) != NPOS;
     }
 }
 
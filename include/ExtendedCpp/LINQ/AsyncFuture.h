@@ -0,0 +1,215 @@
+#ifndef LINQ_AsyncFuture_H
+#define LINQ_AsyncFuture_H
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+/// @brief
+namespace ExtendedCpp::LINQ
+{
+    /// @brief Lazy generator which may co_await between yields. Consumer awaits every element, so the producer
+    /// runs only when the next element is requested and never gets ahead of the consumer
+    /// @tparam TSource
+    template<typename TSource>
+    struct AsyncFuture final
+    {
+        struct promise_type;
+
+        /// @brief
+        using value_type = TSource;
+
+        /// @brief
+        using promise_type = promise_type;
+
+        /// @brief
+        using handle_type = std::coroutine_handle<promise_type>;
+
+        /// @brief Producer is resumed by the consumer inside of Next. If it yields before Next returns, the consumer
+        /// continues without suspension, otherwise the producer resumes the consumer itself, so synchronous
+        /// elements do not grow the stack and asynchronous elements are not lost
+        enum class State : unsigned char
+        {
+            Running,
+            Suspended,
+            Yielded
+        };
+
+        /// @brief Control returns to the awaiting consumer on every yield and at the end
+        struct ContinuationAwaiter final
+        {
+            /// @brief
+            /// @return
+            bool await_ready() const noexcept { return false; }
+
+            /// @brief
+            /// @param handle
+            /// @return
+            std::coroutine_handle<> await_suspend(handle_type handle) const noexcept
+            {
+                promise_type& promise = handle.promise();
+                if (promise._state.exchange(State::Yielded, std::memory_order_acq_rel) == State::Suspended)
+                    return promise._continuation;
+                return std::noop_coroutine();
+            }
+
+            /// @brief
+            void await_resume() const noexcept {}
+        };
+
+        /// @brief
+        struct promise_type final
+        {
+            /// @brief
+            /// @return
+            std::suspend_always initial_suspend() noexcept { return {}; }
+
+            /// @brief
+            /// @return
+            ContinuationAwaiter final_suspend() noexcept { return {}; }
+
+            /// @brief
+            void return_void() noexcept {}
+
+            /// @brief Exception is rethrown to the consumer by the awaited Next
+            void unhandled_exception() noexcept
+            {
+                _exception = std::current_exception();
+            }
+
+            /// @brief Yields a value, which is moved out by the consumer
+            /// @param value
+            /// @return
+            ContinuationAwaiter yield_value(std::remove_cvref_t<TSource>&& value) noexcept
+            {
+                _value = std::addressof(value);
+                _movable = true;
+                return {};
+            }
+
+            /// @brief Yields a value, which is copied by the consumer
+            /// @param value
+            /// @return
+            ContinuationAwaiter yield_value(const std::remove_cvref_t<TSource>& value) noexcept
+            {
+                _value = std::addressof(value);
+                _movable = false;
+                return {};
+            }
+
+            /// @brief
+            /// @return
+            AsyncFuture get_return_object() noexcept
+            {
+                return AsyncFuture(handle_type::from_promise(*this));
+            }
+
+        private:
+            friend struct AsyncFuture;
+
+            const TSource* _value = nullptr;
+            bool _movable = false;
+            std::coroutine_handle<> _continuation;
+            std::exception_ptr _exception;
+            std::atomic<State> _state = State::Running;
+        };
+
+        /// @brief Resumes the producer and suspends the consumer until the next element or the end
+        struct NextAwaiter final
+        {
+            /// @brief
+            /// @param handle
+            explicit NextAwaiter(handle_type handle) noexcept :
+                _handle(handle) {}
+
+            /// @brief
+            /// @return
+            bool await_ready() const noexcept
+            {
+                return !_handle || _handle.done();
+            }
+
+            /// @brief
+            /// @param continuation
+            /// @return false if the producer has already yielded
+            bool await_suspend(std::coroutine_handle<> continuation) const
+            {
+                promise_type& promise = _handle.promise();
+                promise._continuation = continuation;
+                promise._state.store(State::Running, std::memory_order_relaxed);
+                _handle.resume();
+                return promise._state.exchange(State::Suspended, std::memory_order_acq_rel) != State::Yielded;
+            }
+
+            /// @brief
+            /// @return Next element or std::nullopt at the end
+            std::optional<TSource> await_resume() const
+            {
+                if (!_handle)
+                    return std::nullopt;
+
+                promise_type& promise = _handle.promise();
+                if (promise._exception)
+                    std::rethrow_exception(std::exchange(promise._exception, nullptr));
+                if (_handle.done())
+                    return std::nullopt;
+
+                if constexpr (!std::is_trivially_copyable_v<TSource>)
+                    if (promise._movable)
+                        return std::optional<TSource>(std::move(*const_cast<TSource*>(promise._value)));
+                return std::optional<TSource>(*promise._value);
+            }
+
+        private:
+            handle_type _handle;
+        };
+
+        /// @brief
+        /// @param handle
+        explicit AsyncFuture(handle_type handle) noexcept :
+            _handle(handle) {}
+
+        /// @brief
+        /// @param other
+        AsyncFuture(AsyncFuture&& other) noexcept :
+            _handle(std::exchange(other._handle, nullptr)) {}
+
+        /// @brief
+        /// @param other
+        /// @return
+        AsyncFuture& operator=(AsyncFuture&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (_handle)
+                    _handle.destroy();
+                _handle = std::exchange(other._handle, nullptr);
+            }
+            return *this;
+        }
+
+        /// @brief Must not be destroyed while the producer awaits something
+        ~AsyncFuture()
+        {
+            if (_handle)
+                _handle.destroy();
+            _handle = nullptr;
+        }
+
+        /// @brief
+        /// @return Awaitable, which gives the next element or std::nullopt at the end
+        NextAwaiter Next() const noexcept
+        {
+            return NextAwaiter(_handle);
+        }
+
+    private:
+        handle_type _handle;
+    };
+}
+
+#endif
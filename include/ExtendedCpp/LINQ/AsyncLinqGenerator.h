@@ -0,0 +1,240 @@
+#ifndef LINQ_AsyncLinqGenerator_H
+#define LINQ_AsyncLinqGenerator_H
+
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <type_traits>
+#include <vector>
+#include <concepts>
+
+#include <ExtendedCpp/Task.h>
+#include <ExtendedCpp/LINQ/AsyncFuture.h>
+
+/// @brief
+namespace ExtendedCpp::LINQ
+{
+	/// @brief LINQ generator over asynchronous source. Elements are requested one by one with co_await, so only
+	/// the elements in flight are kept in memory. Every operator takes the generator, after it the generator became invalid
+	/// @tparam TSource
+	template<typename TSource>
+	class AsyncLinqGenerator final
+	{
+	private:
+		AsyncFuture<TSource> _yieldContext;
+
+	public:
+		/// @brief
+		using value_type = TSource;
+
+		/// @brief
+		using promise_type = typename AsyncFuture<TSource>::promise_type;
+
+		/// @brief
+		using handle_type = typename AsyncFuture<TSource>::handle_type;
+
+		/// @brief
+		/// @param yieldContext
+		explicit AsyncLinqGenerator(AsyncFuture<TSource>&& yieldContext) noexcept :
+			_yieldContext(std::move(yieldContext)) {}
+
+		/// @brief Reads elements from tasks returned by operation until it returns std::nullopt.
+		/// Next task is started before current element is given to the consumer, so reading overlaps processing
+		/// @tparam TOperation Any functional object without arguments, which returns Task<std::optional<TSource>>
+		/// @param operation
+		template<std::invocable TOperation>
+		requires std::same_as<std::invoke_result_t<TOperation>, Task<std::optional<TSource>>>
+		explicit AsyncLinqGenerator(TOperation&& operation) :
+			_yieldContext(TaskGenerator(std::forward<TOperation>(operation))) {}
+
+		/// @brief
+		/// @param other
+		AsyncLinqGenerator(AsyncLinqGenerator&& other) noexcept = default;
+
+		/// @brief
+		/// @param other
+		/// @return
+		AsyncLinqGenerator& operator=(AsyncLinqGenerator&& other) noexcept = default;
+
+		/// @brief Default destructor
+		~AsyncLinqGenerator() = default;
+
+		/// @brief
+		/// @return Awaitable, which gives the next element or std::nullopt at the end
+		auto Next() const noexcept
+		{
+			return _yieldContext.Next();
+		}
+
+		/// @brief Select elements by condition
+		/// @tparam TPredicate Any functional object with TSource argument and bool result
+		/// @param predicate
+		/// @return
+		template<std::invocable<TSource> TPredicate>
+		requires std::convertible_to<std::invoke_result_t<TPredicate, TSource>, bool>
+		AsyncLinqGenerator Where(TPredicate&& predicate)
+		{
+			return AsyncLinqGenerator(WhereGenerator(std::move(*this), std::forward<TPredicate>(predicate)));
+		}
+
+		/// @brief Project every element into a new form
+		/// @tparam TSelector Any functional object with TSource argument
+		/// @tparam TResult
+		/// @param selector
+		/// @return
+		template<std::invocable<TSource> TSelector,
+				 typename TResult = std::invoke_result_t<TSelector, TSource>>
+		AsyncLinqGenerator<TResult> Select(TSelector&& selector)
+		{
+			return AsyncLinqGenerator<TResult>(
+				SelectGenerator<TResult>(std::move(*this), std::forward<TSelector>(selector)));
+		}
+
+		/// @brief Take first elements, the source is not read after them
+		/// @param count
+		/// @return
+		AsyncLinqGenerator Take(const std::size_t count)
+		{
+			return AsyncLinqGenerator(TakeGenerator(std::move(*this), count));
+		}
+
+		/// @brief Group consecutive elements into vectors of the given size, the last vector may be shorter
+		/// @param size
+		/// @return
+		AsyncLinqGenerator<std::vector<TSource>> Batch(const std::size_t size)
+		{
+			if (size == 0)
+				throw std::invalid_argument("Batch size must be greater than zero");
+			return AsyncLinqGenerator<std::vector<TSource>>(BatchGenerator(std::move(*this), size));
+		}
+
+		/// @brief Performs a general aggregation of the elements depending on the specified expression.
+		/// Task is finished with the last element of the source
+		/// @tparam TResult
+		/// @tparam TAggregate
+		/// @param seed Initial value of the accumulator
+		/// @param aggregateFunction
+		/// @return
+		template<typename TResult, std::invocable<TResult, TSource> TAggregate>
+		Task<TResult> Aggregate(TResult seed, TAggregate&& aggregateFunction)
+		{
+			return AggregateTask<TResult>(std::move(*this), std::optional<TResult>(std::move(seed)),
+										  std::forward<TAggregate>(aggregateFunction));
+		}
+
+		/// @brief Performs a general aggregation of the elements depending on the specified expression,
+		/// the first element is the initial value of the accumulator. Throws std::out_of_range if source is empty
+		/// @tparam TResult
+		/// @tparam TAggregate
+		/// @param aggregateFunction
+		/// @return
+		template<typename TResult, std::invocable<TResult, TSource> TAggregate>
+		Task<TResult> Aggregate(TAggregate&& aggregateFunction)
+		{
+			return AggregateTask<TResult>(std::move(*this), std::nullopt, std::forward<TAggregate>(aggregateFunction));
+		}
+
+		/// @brief
+		/// @return Task with all elements of the source
+		Task<std::vector<TSource>> ToVector()
+		{
+			return ToVectorTask(std::move(*this));
+		}
+
+	private:
+		template<typename TOperation>
+		static AsyncFuture<TSource> TaskGenerator(TOperation operation)
+		{
+			Task<std::optional<TSource>> pending = operation();
+			while (true)
+			{
+				std::optional<TSource> value = co_await pending;
+				if (!value.has_value())
+					co_return;
+				pending = operation();
+				co_yield std::move(*value);
+			}
+		}
+
+		template<typename TPredicate>
+		static AsyncFuture<TSource> WhereGenerator(AsyncLinqGenerator source, TPredicate predicate)
+		{
+			while (std::optional<TSource> value = co_await source.Next())
+				if (predicate(*value))
+					co_yield std::move(*value);
+		}
+
+		template<typename TResult, typename TSelector>
+		static AsyncFuture<TResult> SelectGenerator(AsyncLinqGenerator source, TSelector selector)
+		{
+			while (std::optional<TSource> value = co_await source.Next())
+				co_yield selector(std::move(*value));
+		}
+
+		static AsyncFuture<TSource> TakeGenerator(AsyncLinqGenerator source, const std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				std::optional<TSource> value = co_await source.Next();
+				if (!value.has_value())
+					co_return;
+				co_yield std::move(*value);
+			}
+		}
+
+		static AsyncFuture<std::vector<TSource>> BatchGenerator(AsyncLinqGenerator source, const std::size_t size)
+		{
+			std::vector<TSource> batch;
+			batch.reserve(size);
+			while (std::optional<TSource> value = co_await source.Next())
+			{
+				batch.push_back(std::move(*value));
+				if (batch.size() == size)
+				{
+					co_yield std::move(batch);
+					batch = std::vector<TSource>();
+					batch.reserve(size);
+				}
+			}
+
+			if (!batch.empty())
+				co_yield std::move(batch);
+		}
+
+		// Source is moved into the task, because the task may be finished after the caller leaves its scope,
+		// and is destroyed before the end, since frame of Task is never released
+		template<typename TResult, typename TAggregate>
+		static Task<TResult> AggregateTask(AsyncLinqGenerator source, std::optional<TResult> seed,
+										   TAggregate aggregateFunction)
+		{
+			std::optional<TResult> result = std::move(seed);
+			{
+				const AsyncLinqGenerator inner = std::move(source);
+				while (std::optional<TSource> value = co_await inner.Next())
+				{
+					if (result.has_value())
+						result = aggregateFunction(std::move(*result), std::move(*value));
+					else
+						result = TResult(std::move(*value));
+				}
+			}
+
+			if (!result.has_value())
+				throw std::out_of_range("Collection is empty");
+			co_return std::move(*result);
+		}
+
+		static Task<std::vector<TSource>> ToVectorTask(AsyncLinqGenerator source)
+		{
+			std::vector<TSource> collection;
+			{
+				const AsyncLinqGenerator inner = std::move(source);
+				while (std::optional<TSource> value = co_await inner.Next())
+					collection.push_back(std::move(*value));
+			}
+			co_return std::move(collection);
+		}
+	};
+}
+
+#endif
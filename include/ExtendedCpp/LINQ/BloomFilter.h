@@ -0,0 +1,219 @@
+#ifndef LINQ_BloomFilter_H
+#define LINQ_BloomFilter_H
+
+#include <vector>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <bit>
+#include <concepts>
+#include <algorithm>
+#include <utility>
+
+#include <ExtendedCpp/LINQ/Concepts.h>
+
+/// @brief
+namespace ExtendedCpp::LINQ
+{
+    /// @brief Blocked Bloom filter. Every key sets one bit in each word of a single cache line, so a check
+    /// costs one cache miss at most. There are no false negatives, false positives are about 1% with 10 bits per key
+    /// @tparam T
+    /// @tparam THash
+    template<typename T, typename THash = std::hash<T>>
+    requires std::invocable<const THash&, const T&>
+    class BloomFilter final
+    {
+    public:
+        /// @brief Default number of bits per expected key
+        static constexpr std::size_t BITS_PER_KEY = 10;
+
+        /// @brief
+        /// @param count Expected number of keys
+        /// @param bitsPerKey
+        explicit BloomFilter(const std::size_t count, const std::size_t bitsPerKey = BITS_PER_KEY) :
+            _blocks(std::max<std::size_t>(1, (count * bitsPerKey + BLOCK_BITS - 1) / BLOCK_BITS)) {}
+
+        /// @brief
+        /// @param key
+        void Insert(const T& key) noexcept
+        {
+            const std::uint64_t hash = Mix(key);
+            Block& block = _blocks[BlockOf(hash)];
+            for (std::size_t i = 0; i < WORDS; ++i)
+                block.Words[i] |= Mask(hash, i);
+        }
+
+        /// @brief
+        /// @param key
+        /// @return false if the key has never been inserted
+        bool MayContain(const T& key) const noexcept
+        {
+            const std::uint64_t hash = Mix(key);
+            const Block& block = _blocks[BlockOf(hash)];
+            std::uint64_t missing = 0;
+            for (std::size_t i = 0; i < WORDS; ++i)
+                missing |= ~block.Words[i] & Mask(hash, i);
+            return missing == 0;
+        }
+
+    private:
+        static constexpr std::size_t WORDS = 8;
+        static constexpr std::size_t BLOCK_BITS = WORDS * 64;
+        static constexpr std::array<std::uint32_t, WORDS> SALTS =
+            { 0x47b6137bu, 0x44974d91u, 0x8824ad5bu, 0xa2b7289du, 0x705495c7u, 0x2df1424bu, 0x9efc4947u, 0x5c6bfb31u };
+
+        struct alignas(64) Block final
+        {
+            std::uint64_t Words[WORDS] {};
+        };
+
+        std::vector<Block> _blocks;
+        [[no_unique_address]] THash _hash;
+
+        // Multiplication spreads identity hashes of integers, high bits choose the block and low bits the words.
+        std::uint64_t Mix(const T& key) const noexcept
+        {
+            return static_cast<std::uint64_t>(_hash(key)) * 0x9E3779B97F4A7C15ull;
+        }
+
+        std::size_t BlockOf(const std::uint64_t hash) const noexcept
+        {
+            return static_cast<std::size_t>(((hash >> 32) * _blocks.size()) >> 32);
+        }
+
+        static std::uint64_t Mask(const std::uint64_t hash, const std::size_t word) noexcept
+        {
+            const std::uint32_t bit = (static_cast<std::uint32_t>(hash) * SALTS[word]) >> 26;
+            return std::uint64_t { 1 } << bit;
+        }
+    };
+
+    /// @brief Set of keys of the build side of a semi-join or an anti-join. Keys are stored in the slots
+    /// of an open addressing table, so a probe reads one cache line in most cases. A large set is guarded by
+    /// a Bloom filter, which rejects most of the missing keys before the probe of the table. The filter is dropped,
+    /// when most of the probes find their keys
+    /// @tparam TKey
+    /// @tparam THash
+    template<Concepts::Equatable TKey, typename THash = std::hash<TKey>>
+    requires std::copyable<TKey> && std::invocable<const THash&, const TKey&>
+    class KeySet final
+    {
+    public:
+        /// @brief Minimum number of keys, for which the set is guarded by a Bloom filter.
+        /// Smaller tables stay in cache, so the filter would only add work
+        static constexpr std::size_t FILTER_THRESHOLD = 1 << 16;
+
+        /// @brief
+        /// @tparam TCollection
+        /// @tparam TSelector
+        /// @param collection
+        /// @param selector
+        template<Concepts::ConstIterable TCollection, std::invocable<typename TCollection::value_type> TSelector>
+        KeySet(const TCollection& collection, TSelector&& selector)
+        {
+            std::size_t count = 0;
+            if constexpr (Concepts::HasSize<TCollection>)
+                count = collection.size();
+            else
+                for ([[maybe_unused]] const auto& element : collection)
+                    ++count;
+
+            const std::size_t capacity = std::bit_ceil(std::max<std::size_t>(count * 2, MIN_CAPACITY));
+            _slots.resize(capacity);
+            _shift = 64 - static_cast<std::size_t>(std::countr_zero(capacity));
+
+            for (const auto& element : collection)
+                Insert(selector(element));
+
+            if (_size < FILTER_THRESHOLD)
+                return;
+
+            _filter.emplace(_size);
+            for (const std::optional<TKey>& slot : _slots)
+                if (slot)
+                    _filter->Insert(*slot);
+        }
+
+        /// @brief
+        /// @return Number of different keys
+        [[nodiscard]]
+        std::size_t size() const noexcept
+        {
+            return _size;
+        }
+
+        /// @brief
+        /// @return
+        [[nodiscard]]
+        bool HasFilter() const noexcept
+        {
+            return _filter.has_value();
+        }
+
+        /// @brief Number of probes passed by the filter, after which it is dropped,
+        /// if it has rejected less than a third of this number of probes
+        static constexpr std::size_t FILTER_SAMPLE = 4096;
+
+        /// @brief Not thread-safe, probes decide whether the filter is worth checking
+        /// @param key
+        /// @return
+        bool Contains(const TKey& key) noexcept
+        {
+            if (_filter)
+            {
+                if (!_filter->MayContain(key))
+                {
+                    ++_rejected;
+                    return false;
+                }
+                if (++_passed == FILTER_SAMPLE && _rejected * 3 < FILTER_SAMPLE)
+                    _filter.reset();
+            }
+
+            std::size_t slot = Slot(key);
+            while (_slots[slot])
+            {
+                if (*_slots[slot] == key)
+                    return true;
+                slot = (slot + 1) & (_slots.size() - 1);
+            }
+
+            return false;
+        }
+
+    private:
+        static constexpr std::size_t MIN_CAPACITY = 16;
+
+        std::vector<std::optional<TKey>> _slots;
+        std::size_t _size = 0;
+        std::size_t _shift = 0;
+        std::size_t _passed = 0;
+        std::size_t _rejected = 0;
+        std::optional<BloomFilter<TKey, THash>> _filter;
+        [[no_unique_address]] THash _hash;
+
+        std::size_t Slot(const TKey& key) const noexcept
+        {
+            const auto hash = static_cast<std::uint64_t>(_hash(key));
+            return static_cast<std::size_t>((hash * 0x9E3779B97F4A7C15ull) >> _shift);
+        }
+
+        void Insert(TKey key)
+        {
+            std::size_t slot = Slot(key);
+            while (_slots[slot])
+            {
+                if (*_slots[slot] == key)
+                    return;
+                slot = (slot + 1) & (_slots.size() - 1);
+            }
+
+            _slots[slot].emplace(std::move(key));
+            ++_size;
+        }
+    };
+}
+
+#endif
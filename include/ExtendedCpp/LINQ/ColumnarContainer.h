@@ -0,0 +1,400 @@
+#ifndef LINQ_ColumnarContainer_H
+#define LINQ_ColumnarContainer_H
+
+#include <vector>
+#include <tuple>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <concepts>
+#include <utility>
+
+#include <ExtendedCpp/LINQ/Concepts.h>
+#include <ExtendedCpp/LINQ/TypeTraits.h>
+#include <ExtendedCpp/LINQ/CowVector.h>
+#include <ExtendedCpp/LINQ/FlatHashMap.h>
+#include <ExtendedCpp/LINQ/Aggregate.h>
+#include <ExtendedCpp/LINQ/LinqContainer.h>
+
+/// @brief
+namespace ExtendedCpp::LINQ
+{
+    template<typename TContainer, typename TKey>
+    class ColumnarGroupBy;
+
+    /// @brief Records stored as structure of arrays, every field is a separate contiguous column.
+    /// Queries on a field read only its column, rows are assembled only by ToVector.
+    /// Columns are shared between copies of the container and are copied on the first change
+    /// @tparam TRecord Record type, fields which are not stored are default initialized in assembled rows
+    /// @tparam Fields Pointers to the stored data members of the record, e.g. the fields of its META info
+    template<std::default_initializable TRecord, auto... Fields>
+    requires (sizeof...(Fields) > 0) &&
+             (std::is_member_object_pointer_v<decltype(Fields)> && ...) &&
+             (std::same_as<typename MemberPointerTraits<decltype(Fields)>::ObjectType, TRecord> && ...) &&
+             (std::copyable<typename MemberPointerTraits<decltype(Fields)>::FieldType> && ...)
+    class ColumnarContainer final
+    {
+    public:
+        /// @brief
+        using value_type = TRecord;
+
+        /// @brief Type of the column of the field
+        /// @tparam Field
+        template<auto Field>
+        using FieldType = typename MemberPointerTraits<decltype(Field)>::FieldType;
+
+    private:
+        std::tuple<CowVector<typename MemberPointerTraits<decltype(Fields)>::FieldType>...> _columns;
+        std::size_t _size = 0;
+
+        template<auto Left, auto Right>
+        static constexpr bool IsSameField() noexcept
+        {
+            if constexpr (std::same_as<decltype(Left), decltype(Right)>)
+                return Left == Right;
+            else
+                return false;
+        }
+
+        template<auto Field>
+        static constexpr std::size_t IndexOf() noexcept
+        {
+            constexpr bool matches[] = { IsSameField<Field, Fields>()... };
+            for (std::size_t i = 0; i < sizeof...(Fields); ++i)
+                if (matches[i])
+                    return i;
+            return sizeof...(Fields);
+        }
+
+        template<auto Field>
+        static constexpr bool IsStored = IndexOf<Field>() < sizeof...(Fields);
+
+        ColumnarContainer(std::tuple<CowVector<typename MemberPointerTraits<decltype(Fields)>::FieldType>...>&& columns,
+                          const std::size_t size) noexcept :
+            _columns(std::move(columns)),
+            _size(size) {}
+
+        // Branch-free selection: every index is written, the count grows only for matching values.
+        template<auto Field, typename TPredicate>
+        std::vector<std::size_t> SelectRows(TPredicate&& predicate) const
+        {
+            const CowVector<FieldType<Field>>& column = Column<Field>();
+            std::vector<std::size_t> indexes(_size);
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < _size; ++i)
+            {
+                indexes[count] = i;
+                count += static_cast<std::size_t>(static_cast<bool>(predicate(column[i])));
+            }
+            indexes.resize(count);
+            return indexes;
+        }
+
+        template<std::size_t... Indexes>
+        TRecord Row(const std::size_t row, std::index_sequence<Indexes...>) const
+        {
+            TRecord record {};
+            ((record.*Fields = std::get<Indexes>(_columns)[row]), ...);
+            return record;
+        }
+
+    public:
+        /// @brief
+        ColumnarContainer() = default;
+
+        /// @brief Scatters the fields of every record into the columns
+        /// @tparam TCollection
+        /// @param records
+        template<Concepts::ConstIterable TCollection>
+        requires std::same_as<std::remove_cvref_t<typename TCollection::value_type>, TRecord>
+        explicit ColumnarContainer(const TCollection& records)
+        {
+            std::tuple<std::vector<typename MemberPointerTraits<decltype(Fields)>::FieldType>...> columns;
+            if constexpr (Concepts::HasSize<TCollection>)
+                std::apply([&records](auto&... column) { (column.reserve(records.size()), ...); }, columns);
+
+            for (const TRecord& record : records)
+            {
+                std::apply([&record](auto&... column) { (column.push_back(record.*Fields), ...); }, columns);
+                ++_size;
+            }
+
+            std::apply([this](auto&... column)
+            {
+                _columns = std::make_tuple(CowVector(std::move(column))...);
+            }, columns);
+        }
+
+        /// @brief
+        /// @return Number of rows
+        [[nodiscard]]
+        std::size_t size() const noexcept
+        {
+            return _size;
+        }
+
+        /// @brief
+        /// @return
+        [[nodiscard]]
+        bool empty() const noexcept
+        {
+            return _size == 0;
+        }
+
+        /// @brief
+        /// @tparam Field
+        /// @return Values of the field in the order of rows
+        template<auto Field>
+        requires IsStored<Field>
+        const CowVector<FieldType<Field>>& Column() const noexcept
+        {
+            return std::get<IndexOf<Field>()>(_columns);
+        }
+
+        /// @brief Filters rows by the value of the field. The predicate reads only the column of the field,
+        /// other columns are gathered by the selected indexes
+        /// @tparam Field
+        /// @tparam TPredicate
+        /// @param predicate
+        /// @return
+        template<auto Field, typename TPredicate>
+        requires IsStored<Field> && Concepts::IsPredicate<TPredicate, FieldType<Field>>
+        ColumnarContainer Where(TPredicate&& predicate) const&
+        {
+            const std::vector<std::size_t> indexes = SelectRows<Field>(std::forward<TPredicate>(predicate));
+            if (indexes.size() == _size)
+                return *this;
+
+            auto columns = std::apply([&indexes](const auto&... column)
+            {
+                const auto gather = [&indexes]<typename TValue>(const CowVector<TValue>& source)
+                {
+                    std::vector<TValue> result;
+                    result.reserve(indexes.size());
+                    for (const std::size_t index : indexes)
+                        result.push_back(source[index]);
+                    return CowVector<TValue>(std::move(result));
+                };
+                return std::make_tuple(gather(column)...);
+            }, _columns);
+
+            return ColumnarContainer(std::move(columns), indexes.size());
+        }
+
+        /// @brief Filters rows by the value of the field, columns not shared with other containers are compacted in place
+        /// @tparam Field
+        /// @tparam TPredicate
+        /// @param predicate
+        /// @return
+        template<auto Field, typename TPredicate>
+        requires IsStored<Field> && Concepts::IsPredicate<TPredicate, FieldType<Field>>
+        ColumnarContainer Where(TPredicate&& predicate) &&
+        {
+            const std::vector<std::size_t> indexes = SelectRows<Field>(std::forward<TPredicate>(predicate));
+            if (indexes.size() == _size)
+                return std::move(*this);
+
+            std::apply([&indexes](auto&... column)
+            {
+                // Indexes grow, so every element is moved to the same or a lower position.
+                const auto compact = [&indexes](auto& collection)
+                {
+                    for (std::size_t i = 0; i < indexes.size(); ++i)
+                        if (indexes[i] != i)
+                            collection[i] = std::move(collection[indexes[i]]);
+                    collection.erase(collection.begin() + static_cast<std::ptrdiff_t>(indexes.size()),
+                                     collection.end());
+                };
+                (column.Modify(compact), ...);
+            }, _columns);
+
+            _size = indexes.size();
+            return std::move(*this);
+        }
+
+        /// @brief
+        /// @tparam Field
+        /// @return Copy of the column of the field
+        template<auto Field>
+        requires IsStored<Field>
+        LinqContainer<FieldType<Field>> Select() const
+        {
+            return LinqContainer<FieldType<Field>>(std::vector<FieldType<Field>>(Column<Field>().begin(),
+                                                                                 Column<Field>().end()));
+        }
+
+        /// @brief Projects the values of the field, other columns are not read
+        /// @tparam Field
+        /// @tparam TSelector
+        /// @tparam TResult
+        /// @param selector
+        /// @return
+        template<auto Field, std::invocable<FieldType<Field>> TSelector,
+                 typename TResult = std::invoke_result_t<TSelector, FieldType<Field>>>
+        requires IsStored<Field>
+        LinqContainer<TResult> Select(TSelector&& selector) const
+        {
+            const CowVector<FieldType<Field>>& column = Column<Field>();
+            std::vector<TResult> result;
+            result.reserve(_size);
+            for (const FieldType<Field>& value : column)
+                result.push_back(selector(value));
+            return LinqContainer<TResult>(std::move(result));
+        }
+
+        /// @brief Sum of the field, arithmetic columns are summed by the multi-lane kernel
+        /// @tparam Field
+        /// @return
+        template<auto Field>
+        requires IsStored<Field> && Concepts::Summarize<FieldType<Field>>
+        FieldType<Field> Sum() const
+        {
+            if (_size == 0)
+                throw std::out_of_range("Collection is empty");
+            return Aggregate::Sum(Column<Field>(), 0, _size - 1);
+        }
+
+        /// @brief
+        /// @tparam Field
+        /// @return
+        template<auto Field>
+        requires IsStored<Field> && Concepts::Divisible<FieldType<Field>>
+        FieldType<Field> Average() const
+        {
+            if (_size == 0)
+                throw std::out_of_range("Collection is empty");
+            return Aggregate::Average(Column<Field>(), 0, _size - 1);
+        }
+
+        /// @brief Groups rows by the value of the field, aggregates of the groups read only the needed columns
+        /// @tparam Field
+        /// @return
+        template<auto Field>
+        requires IsStored<Field> && Concepts::Hashable<FieldType<Field>> && Concepts::Equatable<FieldType<Field>>
+        ColumnarGroupBy<ColumnarContainer, FieldType<Field>> GroupBy() const
+        {
+            return ColumnarGroupBy<ColumnarContainer, FieldType<Field>>(*this, Column<Field>());
+        }
+
+        /// @brief Assembles the rows
+        /// @return
+        [[nodiscard]]
+        std::vector<TRecord> ToVector() const
+        {
+            std::vector<TRecord> records;
+            records.reserve(_size);
+            for (std::size_t i = 0; i < _size; ++i)
+                records.push_back(Row(i, std::index_sequence_for<decltype(Fields)...> {}));
+            return records;
+        }
+
+        /// @brief Assembles the rows
+        /// @return
+        [[nodiscard]]
+        LinqContainer<TRecord> ToLinq() const
+        {
+            return LinqContainer<TRecord>(ToVector());
+        }
+    };
+
+    /// @brief Rows of a columnar container grouped by the key column. Every row is mapped to the dense index
+    /// of its group once, so aggregates of the groups read only the key indexes and the aggregated column
+    /// @tparam TContainer
+    /// @tparam TKey
+    template<typename TContainer, typename TKey>
+    class ColumnarGroupBy final
+    {
+    private:
+        TContainer _container;
+        std::vector<TKey> _keys;
+        std::vector<std::size_t> _groups;
+
+        template<typename TValue>
+        LinqContainer<std::pair<TKey, TValue>> Zip(std::vector<TValue>&& values) const
+        {
+            std::vector<std::pair<TKey, TValue>> result;
+            result.reserve(_keys.size());
+            for (std::size_t group = 0; group < _keys.size(); ++group)
+                result.emplace_back(_keys[group], std::move(values[group]));
+            return LinqContainer<std::pair<TKey, TValue>>(std::move(result));
+        }
+
+    public:
+        /// @brief
+        /// @param container
+        /// @param keys Key column of the container
+        ColumnarGroupBy(const TContainer& container, const CowVector<TKey>& keys) :
+            _container(container),
+            _groups(keys.size())
+        {
+            FlatHashMap<TKey, std::size_t> groups;
+            for (std::size_t i = 0; i < keys.size(); ++i)
+            {
+                if (const std::size_t* group = groups.Find(keys[i]))
+                {
+                    _groups[i] = *group;
+                }
+                else
+                {
+                    _groups[i] = _keys.size();
+                    groups[keys[i]] = _keys.size();
+                    _keys.push_back(keys[i]);
+                }
+            }
+        }
+
+        /// @brief
+        /// @return Keys in the order of first occurrence
+        [[nodiscard]]
+        const std::vector<TKey>& Keys() const noexcept
+        {
+            return _keys;
+        }
+
+        /// @brief
+        /// @return Number of rows of every group in the order of first occurrence
+        LinqContainer<std::pair<TKey, std::size_t>> Count() const
+        {
+            std::vector<std::size_t> counts(_keys.size(), 0);
+            for (const std::size_t group : _groups)
+                ++counts[group];
+            return Zip(std::move(counts));
+        }
+
+        /// @brief
+        /// @tparam Field
+        /// @return Sum of the field in every group in the order of first occurrence
+        template<auto Field, typename TValue = typename TContainer::template FieldType<Field>>
+        requires Concepts::Summarize<TValue> && std::default_initializable<TValue>
+        LinqContainer<std::pair<TKey, TValue>> Sum() const
+        {
+            const CowVector<TValue>& column = _container.template Column<Field>();
+            std::vector<TValue> sums(_keys.size(), TValue {});
+            for (std::size_t i = 0; i < column.size(); ++i)
+                sums[_groups[i]] = sums[_groups[i]] + column[i];
+            return Zip(std::move(sums));
+        }
+
+        /// @brief
+        /// @tparam Field
+        /// @return Average of the field in every group in the order of first occurrence
+        template<auto Field, typename TValue = typename TContainer::template FieldType<Field>>
+        requires Concepts::Summarize<TValue> && Concepts::Divisible<TValue> && std::default_initializable<TValue>
+        LinqContainer<std::pair<TKey, TValue>> Average() const
+        {
+            const CowVector<TValue>& column = _container.template Column<Field>();
+            std::vector<TValue> sums(_keys.size(), TValue {});
+            std::vector<std::size_t> counts(_keys.size(), 0);
+            for (std::size_t i = 0; i < column.size(); ++i)
+            {
+                sums[_groups[i]] = sums[_groups[i]] + column[i];
+                ++counts[_groups[i]];
+            }
+            for (std::size_t group = 0; group < _keys.size(); ++group)
+                sums[group] = static_cast<TValue>(sums[group] / counts[group]);
+            return Zip(std::move(sums));
+        }
+    };
+}
+
+#endif
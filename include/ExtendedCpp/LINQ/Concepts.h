@@ -2,20 +2,16 @@
 #define LINQ_Concepts_H
 
 #include <utility>
-#include <optional>
+#include <functional>
 #include <coroutine>
+#include <concepts>
+#include <type_traits>
+#include <vector>
+#include <memory_resource>
 
 /// @brief 
 namespace ExtendedCpp::LINQ::Concepts
 {
-    template<typename TIter>
-    concept OptionalIter = requires(TIter iter)
-    {
-        { *(++iter) } -> std::same_as<std::optional<typename TIter::value_type>>;
-        { iter == iter } -> std::convertible_to<bool>;
-        { iter != iter } -> std::convertible_to<bool>;
-    };
-
     template<typename TPair>
     concept IsPair = requires(TPair pair)
     {
@@ -46,6 +42,12 @@ namespace ExtendedCpp::LINQ::Concepts
         { value + value } -> std::convertible_to<T>;
     };
 
+    template<typename T>
+    concept Subtractable = requires(T value)
+    {
+        { value - value } -> std::convertible_to<T>;
+    };
+
     template<typename T>
     concept Equatable = requires(T value)
     {
@@ -53,6 +55,20 @@ namespace ExtendedCpp::LINQ::Concepts
         { value != value } -> std::convertible_to<bool>;
     };
 
+    template<typename T>
+    concept Hashable = requires(T value)
+    {
+        { std::hash<T>{}(value) } -> std::convertible_to<std::size_t>;
+    };
+
+    template<typename T>
+    concept BitwiseEquatable = (std::integral<T> || std::is_enum_v<T> || std::is_pointer_v<T>) &&
+                               std::has_unique_object_representations_v<T>;
+
+    template<typename T>
+    concept RadixSortable = (std::integral<T> && !std::same_as<T, bool>) ||
+                            (std::floating_point<T> && (sizeof(T) == 4 || sizeof(T) == 8));
+
     template<typename TCollection>
     concept Iterable = requires(TCollection collection)
     {
@@ -89,6 +105,10 @@ namespace ExtendedCpp::LINQ::Concepts
     {
         { predicate(std::forward<TArgs>(args)...) } -> std::convertible_to<bool>;
     };
+
+    template<typename TSelector, typename TSource, typename TElement>
+    concept GroupSelector = std::invocable<TSelector, const std::pmr::vector<TSource>&, TElement> ||
+                            std::invocable<TSelector, const std::vector<TSource>&, TElement>;
 }
 
 #endif
\ No newline at end of file
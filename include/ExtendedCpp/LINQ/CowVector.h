@@ -0,0 +1,792 @@
+#ifndef LINQ_CowVector_H
+#define LINQ_CowVector_H
+
+#include <vector>
+#include <span>
+#include <memory>
+#include <memory_resource>
+#include <atomic>
+#include <iterator>
+#include <algorithm>
+#include <concepts>
+#include <utility>
+#include <type_traits>
+
+/// @brief
+namespace ExtendedCpp::LINQ
+{
+    /// @brief Other owners release shared storage with acquire-release ordering, the fence orders their last reads
+    /// before the changes made by the only owner
+    /// @tparam TStorage
+    /// @param storage
+    /// @return
+    template<typename TStorage>
+    bool IsUniquelyOwned(const std::shared_ptr<TStorage>& storage) noexcept
+    {
+        if (storage == nullptr || storage.use_count() != 1)
+            return false;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return true;
+    }
+
+    /// @brief Storage policy of CowVector: contiguous elements, which are owned and shared by copies of the storage
+    /// or borrowed from the caller, and the position of the first element of the vector
+    /// @tparam TSource
+    template<std::copyable TSource>
+    class CowStorage final
+    {
+    private:
+        std::shared_ptr<std::vector<TSource>> _adopted;
+        std::shared_ptr<std::pmr::vector<TSource>> _owned;
+        const TSource* _data = nullptr;
+
+        static std::shared_ptr<std::pmr::vector<TSource>> MakeStorage(std::pmr::memory_resource* resource)
+        {
+            return std::allocate_shared<std::pmr::vector<TSource>>(std::pmr::polymorphic_allocator<>(resource));
+        }
+
+        template<typename TVector>
+        void Trim(TVector& collection, const std::size_t size)
+        {
+            const auto offset = static_cast<std::ptrdiff_t>(_data - collection.data());
+            collection.erase(collection.begin() + offset + static_cast<std::ptrdiff_t>(size), collection.end());
+            collection.erase(collection.begin(), collection.begin() + offset);
+            _data = collection.data();
+        }
+
+    public:
+        /// @brief
+        using iterator = TSource*;
+
+        /// @brief
+        using const_iterator = const TSource*;
+
+        /// @brief
+        using const_reference = const TSource&;
+
+        /// @brief Elements are stored as objects, so CowVector gives pointers to them
+        static constexpr bool IS_CONTIGUOUS = true;
+
+        /// @brief
+        CowStorage() noexcept = default;
+
+        /// @brief Copies the collection
+        /// @param collection
+        /// @param resource
+        CowStorage(const std::vector<TSource>& collection, std::pmr::memory_resource* resource) :
+            _owned(MakeStorage(resource))
+        {
+            _owned->assign(collection.cbegin(), collection.cend());
+            _data = _owned->data();
+        }
+
+        /// @brief Takes the storage of the collection
+        /// @param collection
+        CowStorage(std::vector<TSource>&& collection, std::pmr::memory_resource*) :
+            _adopted(std::make_shared<std::vector<TSource>>(std::move(collection))),
+            _data(_adopted->data()) {}
+
+        /// @brief Takes the storage of the collection
+        /// @param collection
+        explicit CowStorage(std::pmr::vector<TSource>&& collection) :
+            _owned(MakeStorage(collection.get_allocator().resource()))
+        {
+            *_owned = std::move(collection);
+            _data = _owned->data();
+        }
+
+        /// @brief Borrows the storage
+        /// @param storage
+        CowStorage(const std::span<const TSource> storage, std::pmr::memory_resource*) noexcept :
+            _data(storage.data()) {}
+
+        /// @brief Shares owned elements
+        /// @param other
+        CowStorage(const CowStorage& other) noexcept = default;
+
+        /// @brief
+        /// @param other
+        CowStorage(CowStorage&& other) noexcept :
+            _adopted(std::move(other._adopted)),
+            _owned(std::move(other._owned)),
+            _data(std::exchange(other._data, nullptr)) {}
+
+        /// @brief Shares owned elements
+        /// @param other
+        /// @return
+        CowStorage& operator=(const CowStorage& other) noexcept = default;
+
+        /// @brief
+        /// @param other
+        /// @return
+        CowStorage& operator=(CowStorage&& other) noexcept
+        {
+            if (this != &other)
+            {
+                _adopted = std::move(other._adopted);
+                _owned = std::move(other._owned);
+                _data = std::exchange(other._data, nullptr);
+            }
+            return *this;
+        }
+
+        /// @brief Default destructor
+        ~CowStorage() = default;
+
+        /// @brief
+        /// @return
+        [[nodiscard]]
+        bool IsBorrowed() const noexcept
+        {
+            return _adopted == nullptr && _owned == nullptr && _data != nullptr;
+        }
+
+        /// @brief
+        /// @return true if no other storage shares the elements
+        [[nodiscard]]
+        bool IsOnlyOwner() const noexcept
+        {
+            return IsUniquelyOwned(_adopted) || IsUniquelyOwned(_owned);
+        }
+
+        /// @brief
+        /// @param size
+        /// @return true if no other storage shares the elements and they are exactly size elements from the first
+        [[nodiscard]]
+        bool IsOnlyOwner(const std::size_t size) const noexcept
+        {
+            if (_adopted != nullptr)
+                return IsUniquelyOwned(_adopted) && _data == _adopted->data() && size == _adopted->size();
+            if (_owned != nullptr)
+                return IsUniquelyOwned(_owned) && _data == _owned->data() && size == _owned->size();
+            return false;
+        }
+
+        /// @brief
+        /// @return
+        const_iterator begin() const noexcept
+        {
+            return _data;
+        }
+
+        /// @brief
+        /// @param index
+        /// @return
+        const_reference operator[](const std::size_t index) const noexcept
+        {
+            return _data[index];
+        }
+
+        /// @brief
+        /// @param offset
+        void Advance(const std::size_t offset) noexcept
+        {
+            _data += offset;
+        }
+
+        /// @brief Copies size elements from the first into new storage
+        /// @param size
+        /// @param resource
+        void Copy(const std::size_t size, std::pmr::memory_resource* resource)
+        {
+            std::shared_ptr<std::pmr::vector<TSource>> owned = MakeStorage(resource);
+            owned->assign(_data, _data + size);
+            _adopted = nullptr;
+            _owned = std::move(owned);
+            _data = _owned->data();
+        }
+
+        /// @brief Erases the elements outside of size elements from the first, only for the only owner
+        /// @param size
+        void Trim(const std::size_t size)
+        {
+            if (_adopted != nullptr)
+                Trim(*_adopted, size);
+            else
+                Trim(*_owned, size);
+        }
+
+        /// @brief Only for the only owner
+        /// @return
+        iterator MutableBegin() noexcept
+        {
+            if (_adopted != nullptr)
+                return _adopted->data() + (_data - _adopted->data());
+            return _owned->data() + (_data - _owned->data());
+        }
+
+        /// @brief Gives the vector to the function, only for the only owner of all its elements
+        /// @tparam TFunction
+        /// @param function
+        /// @return New number of elements
+        template<typename TFunction>
+        std::size_t Modify(TFunction&& function)
+        {
+            if (_adopted != nullptr)
+            {
+                function(*_adopted);
+                _data = _adopted->data();
+                return _adopted->size();
+            }
+
+            function(*_owned);
+            _data = _owned->data();
+            return _owned->size();
+        }
+
+        /// @brief Storage of a std::vector is taken back, elements of the only owner are moved,
+        /// shared and borrowed elements are copied. The storage is left unspecified
+        /// @param size
+        /// @return
+        std::vector<TSource> Release(const std::size_t size)
+        {
+            if (IsUniquelyOwned(_adopted))
+            {
+                Trim(*_adopted, size);
+                return std::move(*_adopted);
+            }
+            if (IsUniquelyOwned(_owned))
+                return std::vector<TSource>(std::make_move_iterator(MutableBegin()),
+                                            std::make_move_iterator(MutableBegin() + size));
+            return std::vector<TSource>(_data, _data + size);
+        }
+    };
+
+    /// @brief Bools are stored as bits of std::pmr::vector<bool>. There are no bool objects to point to,
+    /// so the elements are always owned: std::vector<bool> and spans are copied
+    template<>
+    class CowStorage<bool> final
+    {
+    private:
+        std::shared_ptr<std::pmr::vector<bool>> _owned;
+        std::size_t _offset = 0;
+
+        static std::shared_ptr<std::pmr::vector<bool>> MakeStorage(std::pmr::memory_resource* resource)
+        {
+            return std::allocate_shared<std::pmr::vector<bool>>(std::pmr::polymorphic_allocator<>(resource));
+        }
+
+        static const std::pmr::vector<bool>& Empty() noexcept
+        {
+            static const std::pmr::vector<bool> empty;
+            return empty;
+        }
+
+    public:
+        /// @brief
+        using iterator = std::pmr::vector<bool>::iterator;
+
+        /// @brief
+        using const_iterator = std::pmr::vector<bool>::const_iterator;
+
+        /// @brief
+        using const_reference = bool;
+
+        /// @brief Bits have no addresses, so CowVector gives no pointers to them
+        static constexpr bool IS_CONTIGUOUS = false;
+
+        /// @brief
+        CowStorage() noexcept = default;
+
+        /// @brief Copies the collection
+        /// @param collection
+        /// @param resource
+        CowStorage(const std::vector<bool>& collection, std::pmr::memory_resource* resource) :
+            _owned(MakeStorage(resource))
+        {
+            _owned->assign(collection.cbegin(), collection.cend());
+        }
+
+        /// @brief Copies the collection, its storage can not be adopted by std::pmr::vector<bool>
+        /// @param collection
+        /// @param resource
+        CowStorage(std::vector<bool>&& collection, std::pmr::memory_resource* resource) :
+            CowStorage(collection, resource) {}
+
+        /// @brief Takes the storage of the collection
+        /// @param collection
+        explicit CowStorage(std::pmr::vector<bool>&& collection) :
+            _owned(MakeStorage(collection.get_allocator().resource()))
+        {
+            *_owned = std::move(collection);
+        }
+
+        /// @brief Copies the storage
+        /// @param storage
+        /// @param resource
+        CowStorage(const std::span<const bool> storage, std::pmr::memory_resource* resource) :
+            _owned(MakeStorage(resource))
+        {
+            _owned->assign(storage.begin(), storage.end());
+        }
+
+        /// @brief Shares the elements
+        /// @param other
+        CowStorage(const CowStorage& other) noexcept = default;
+
+        /// @brief
+        /// @param other
+        CowStorage(CowStorage&& other) noexcept :
+            _owned(std::move(other._owned)),
+            _offset(std::exchange(other._offset, 0)) {}
+
+        /// @brief Shares the elements
+        /// @param other
+        /// @return
+        CowStorage& operator=(const CowStorage& other) noexcept = default;
+
+        /// @brief
+        /// @param other
+        /// @return
+        CowStorage& operator=(CowStorage&& other) noexcept
+        {
+            if (this != &other)
+            {
+                _owned = std::move(other._owned);
+                _offset = std::exchange(other._offset, 0);
+            }
+            return *this;
+        }
+
+        /// @brief Default destructor
+        ~CowStorage() = default;
+
+        /// @brief
+        /// @return Always false, bools are copied
+        [[nodiscard]]
+        bool IsBorrowed() const noexcept
+        {
+            return false;
+        }
+
+        /// @brief
+        /// @return true if no other storage shares the elements
+        [[nodiscard]]
+        bool IsOnlyOwner() const noexcept
+        {
+            return IsUniquelyOwned(_owned);
+        }
+
+        /// @brief
+        /// @param size
+        /// @return true if no other storage shares the elements and they are exactly size elements from the first
+        [[nodiscard]]
+        bool IsOnlyOwner(const std::size_t size) const noexcept
+        {
+            return IsUniquelyOwned(_owned) && _offset == 0 && size == _owned->size();
+        }
+
+        /// @brief
+        /// @return
+        const_iterator begin() const noexcept
+        {
+            return (_owned != nullptr ? *_owned : Empty()).cbegin() + static_cast<std::ptrdiff_t>(_offset);
+        }
+
+        /// @brief
+        /// @param index
+        /// @return
+        const_reference operator[](const std::size_t index) const noexcept
+        {
+            return (*_owned)[_offset + index];
+        }
+
+        /// @brief
+        /// @param offset
+        void Advance(const std::size_t offset) noexcept
+        {
+            _offset += offset;
+        }
+
+        /// @brief Copies size elements from the first into new storage
+        /// @param size
+        /// @param resource
+        void Copy(const std::size_t size, std::pmr::memory_resource* resource)
+        {
+            std::shared_ptr<std::pmr::vector<bool>> owned = MakeStorage(resource);
+            owned->assign(begin(), begin() + static_cast<std::ptrdiff_t>(size));
+            _owned = std::move(owned);
+            _offset = 0;
+        }
+
+        /// @brief Erases the elements outside of size elements from the first, only for the only owner
+        /// @param size
+        void Trim(const std::size_t size)
+        {
+            _owned->erase(_owned->begin() + static_cast<std::ptrdiff_t>(_offset + size), _owned->end());
+            _owned->erase(_owned->begin(), _owned->begin() + static_cast<std::ptrdiff_t>(_offset));
+            _offset = 0;
+        }
+
+        /// @brief Only for the only owner
+        /// @return
+        iterator MutableBegin() noexcept
+        {
+            return _owned->begin() + static_cast<std::ptrdiff_t>(_offset);
+        }
+
+        /// @brief Gives the vector to the function, only for the only owner of all its elements
+        /// @tparam TFunction
+        /// @param function
+        /// @return New number of elements
+        template<typename TFunction>
+        std::size_t Modify(TFunction&& function)
+        {
+            function(*_owned);
+            return _owned->size();
+        }
+
+        /// @brief Copies the elements, bits can not be moved into std::vector<bool>
+        /// @param size
+        /// @return
+        std::vector<bool> Release(const std::size_t size) const
+        {
+            return std::vector<bool>(begin(), begin() + static_cast<std::ptrdiff_t>(size));
+        }
+    };
+
+    /// @brief Vector which either owns its elements or borrows contiguous storage of the caller.
+    /// Owned elements are shared between copies and slices, so they are read in place. Elements are allocated
+    /// from the memory resource, only a std::vector moved into this vector keeps its own storage.
+    /// Invalidation rules: mutable access to shared or borrowed elements copies them first, so pointers taken before
+    /// keep pointing to the old elements, which live while another owner keeps them. Mutable access to solely owned
+    /// elements is given in place without moving them, and every later copy of this vector copies the elements.
+    /// Modify changes the storage of the only owner in place, like the operations of std::vector do.
+    /// Different vectors sharing elements may be used from different threads, one vector may not be changed
+    /// concurrently with any other access to it. Elements are kept by CowStorage, bools are stored as bits
+    /// @tparam TSource
+    template<std::copyable TSource>
+    class CowVector final
+    {
+    private:
+        using TStorage = CowStorage<TSource>;
+
+        std::size_t _size = 0;
+        std::pmr::memory_resource* _resource = std::pmr::get_default_resource();
+        TStorage _storage;
+        bool _exposed = false;
+
+        CowVector(TStorage&& storage, const std::size_t size, std::pmr::memory_resource* resource) noexcept :
+            _size(size),
+            _resource(resource),
+            _storage(std::move(storage)) {}
+
+        // The only owner gives up elements outside of its slice in place, otherwise the slice is copied.
+        void Own()
+        {
+            if (_storage.IsOnlyOwner())
+                _storage.Trim(_size);
+            else
+                _storage.Copy(_size, _resource);
+        }
+
+    public:
+        /// @brief
+        using value_type = TSource;
+
+        /// @brief
+        using iterator = typename TStorage::iterator;
+
+        /// @brief
+        using const_iterator = typename TStorage::const_iterator;
+
+        /// @brief
+        using reverse_iterator = std::reverse_iterator<iterator>;
+
+        /// @brief
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        /// @brief
+        CowVector() noexcept = default;
+
+        /// @brief
+        /// @param collection
+        /// @param resource
+        explicit CowVector(const std::vector<TSource>& collection,
+                           std::pmr::memory_resource* resource = std::pmr::get_default_resource()) :
+            _size(collection.size()),
+            _resource(resource),
+            _storage(collection, resource) {}
+
+        /// @brief Takes the storage of the collection, bools are copied
+        /// @param collection
+        explicit CowVector(std::vector<TSource>&& collection) :
+            _size(collection.size()),
+            _storage(std::move(collection), _resource) {}
+
+        /// @brief Takes the storage of the collection, the next copies are allocated from its memory resource
+        /// @param collection
+        explicit CowVector(std::pmr::vector<TSource>&& collection) :
+            _size(collection.size()),
+            _resource(collection.get_allocator().resource()),
+            _storage(std::move(collection)) {}
+
+        /// @brief Borrows the storage, which must outlive this vector and every copy of it. Bools are copied
+        /// @param storage
+        /// @param resource Memory resource of the copy made by the first mutable access
+        explicit CowVector(const std::span<const TSource> storage,
+                           std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        noexcept(std::is_nothrow_constructible_v<TStorage, std::span<const TSource>, std::pmr::memory_resource*>) :
+            _size(storage.size()),
+            _resource(resource),
+            _storage(storage, resource) {}
+
+        /// @brief Shares owned elements, a borrowing vector stays borrowing. Elements, which have been given out
+        /// for mutable access, are copied
+        /// @param other
+        CowVector(const CowVector& other) :
+            _size(other._size),
+            _resource(other._resource),
+            _storage(other._storage)
+        {
+            if (other._exposed)
+                _storage.Copy(_size, _resource);
+        }
+
+        /// @brief
+        /// @param other
+        CowVector(CowVector&& other) noexcept :
+            _size(std::exchange(other._size, 0)),
+            _resource(other._resource),
+            _storage(std::move(other._storage)),
+            _exposed(std::exchange(other._exposed, false)) {}
+
+        /// @brief Shares owned elements, a borrowing vector stays borrowing. Elements, which have been given out
+        /// for mutable access, are copied
+        /// @param other
+        /// @return
+        CowVector& operator=(const CowVector& other)
+        {
+            if (this != &other)
+                *this = CowVector(other);
+            return *this;
+        }
+
+        /// @brief
+        /// @param other
+        /// @return
+        CowVector& operator=(CowVector&& other) noexcept
+        {
+            if (this != &other)
+            {
+                _size = std::exchange(other._size, 0);
+                _resource = other._resource;
+                _storage = std::move(other._storage);
+                _exposed = std::exchange(other._exposed, false);
+            }
+            return *this;
+        }
+
+        /// @brief Default destructor
+        ~CowVector() = default;
+
+        /// @brief Copies the collection into the memory resource of this vector
+        /// @param collection
+        /// @return
+        CowVector& operator=(const std::vector<TSource>& collection)
+        {
+            return *this = CowVector(collection, _resource);
+        }
+
+        /// @brief Takes the storage of the collection, bools are copied into the memory resource of this vector
+        /// @param collection
+        /// @return
+        CowVector& operator=(std::vector<TSource>&& collection)
+        {
+            const std::size_t size = collection.size();
+            return *this = CowVector(TStorage(std::move(collection), _resource), size, _resource);
+        }
+
+        /// @brief
+        /// @return true if elements are read from the storage of the caller
+        [[nodiscard]]
+        bool IsBorrowed() const noexcept
+        {
+            return _storage.IsBorrowed();
+        }
+
+        /// @brief
+        /// @return Memory resource of the elements allocated by this vector
+        [[nodiscard]]
+        std::pmr::memory_resource* Resource() const noexcept
+        {
+            return _resource;
+        }
+
+        /// @brief
+        /// @return
+        [[nodiscard]]
+        std::size_t size() const noexcept
+        {
+            return _size;
+        }
+
+        /// @brief
+        /// @return
+        [[nodiscard]]
+        bool empty() const noexcept
+        {
+            return _size == 0;
+        }
+
+        /// @brief Elements [offset, offset + count) without copying, they are shared with this vector.
+        /// Elements, which have been given out for mutable access, are copied
+        /// @param offset Must not be greater than size
+        /// @param count Must not be greater than size - offset
+        /// @return
+        CowVector Slice(const std::size_t offset, const std::size_t count) const&
+        {
+            TStorage storage = _storage;
+            storage.Advance(offset);
+            if (_exposed)
+                storage.Copy(count, _resource);
+            return CowVector(std::move(storage), count, _resource);
+        }
+
+        /// @brief Elements [offset, offset + count) without copying, the storage is taken from this vector
+        /// @param offset Must not be greater than size
+        /// @param count Must not be greater than size - offset
+        /// @return
+        CowVector Slice(const std::size_t offset, const std::size_t count) && noexcept
+        {
+            CowVector slice = std::move(*this);
+            slice._storage.Advance(offset);
+            slice._size = count;
+            return slice;
+        }
+
+        /// @brief Gives the owned vector, std::vector or std::pmr::vector, to the function, which may change
+        /// its elements and size. Borrowed or shared elements are copied first
+        /// @tparam TFunction Any functional object with std::vector<TSource>& and std::pmr::vector<TSource>& arguments
+        /// @param function
+        template<typename TFunction>
+        void Modify(TFunction&& function)
+        {
+            if (!_storage.IsOnlyOwner(_size))
+                Own();
+            _size = _storage.Modify(std::forward<TFunction>(function));
+        }
+
+        /// @brief
+        /// @return
+        const TSource* data() const noexcept
+        requires TStorage::IS_CONTIGUOUS
+        {
+            return _storage.begin();
+        }
+
+        /// @brief Copies shared or borrowed storage before giving mutable access. Solely owned elements
+        /// are given in place, so the next copies of this vector copy them
+        /// @return
+        TSource* data()
+        requires TStorage::IS_CONTIGUOUS
+        {
+            return begin();
+        }
+
+        /// @brief
+        /// @param index
+        /// @return
+        typename TStorage::const_reference operator[](const std::size_t index) const noexcept
+        {
+            return _storage[index];
+        }
+
+        /// @brief
+        /// @return
+        const_iterator begin() const noexcept
+        {
+            return _storage.begin();
+        }
+
+        /// @brief
+        /// @return
+        const_iterator end() const noexcept
+        {
+            return begin() + static_cast<std::ptrdiff_t>(_size);
+        }
+
+        /// @brief Copies shared or borrowed storage before giving mutable access. Solely owned elements
+        /// are given in place, so the next copies of this vector copy them
+        /// @return
+        iterator begin()
+        {
+            _exposed = true;
+            if (!_storage.IsOnlyOwner())
+                _storage.Copy(_size, _resource);
+            return _storage.MutableBegin();
+        }
+
+        /// @brief Copies shared or borrowed storage before giving mutable access
+        /// @return
+        iterator end()
+        {
+            return begin() + static_cast<std::ptrdiff_t>(_size);
+        }
+
+        /// @brief
+        /// @return
+        const_iterator cbegin() const noexcept
+        {
+            return begin();
+        }
+
+        /// @brief
+        /// @return
+        const_iterator cend() const noexcept
+        {
+            return end();
+        }
+
+        /// @brief Copies shared or borrowed storage before giving mutable access
+        /// @return
+        reverse_iterator rbegin()
+        {
+            return reverse_iterator(end());
+        }
+
+        /// @brief Copies shared or borrowed storage before giving mutable access
+        /// @return
+        reverse_iterator rend()
+        {
+            return reverse_iterator(begin());
+        }
+
+        /// @brief
+        /// @return
+        const_reverse_iterator crbegin() const noexcept
+        {
+            return const_reverse_iterator(end());
+        }
+
+        /// @brief
+        /// @return
+        const_reverse_iterator crend() const noexcept
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        /// @brief
+        /// @return Copy of elements
+        [[nodiscard]]
+        std::vector<TSource> ToVector() const &
+        {
+            return std::vector<TSource>(begin(), end());
+        }
+
+        /// @brief
+        /// @return Storage of a std::vector moved into this vector is taken back, elements of the only owner
+        /// are moved, shared and borrowed elements are copied
+        [[nodiscard]]
+        std::vector<TSource> ToVector() &&
+        {
+            std::vector<TSource> collection = _storage.Release(_size);
+            _storage = TStorage();
+            _size = 0;
+            _exposed = false;
+            return collection;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,191 @@
+#ifndef LINQ_FlatHashMap_H
+#define LINQ_FlatHashMap_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <bit>
+#include <functional>
+#include <algorithm>
+#include <concepts>
+#include <utility>
+
+#include <ExtendedCpp/LINQ/Concepts.h>
+
+/// @brief
+namespace ExtendedCpp::LINQ
+{
+    /// @brief Hash map with open addressing. Entries are stored densely in the order of insertion,
+    /// the table of slots keeps only their indexes, so iteration is a pass over an array and rehashing does not move
+    /// the entries. Entries are never removed
+    /// @tparam TKey
+    /// @tparam TValue
+    /// @tparam THash
+    template<Concepts::Equatable TKey, typename TValue, typename THash = std::hash<TKey>>
+    requires std::invocable<const THash&, const TKey&>
+    class FlatHashMap final
+    {
+    public:
+        /// @brief
+        using value_type = std::pair<TKey, TValue>;
+
+        /// @brief
+        using const_iterator = typename std::vector<value_type>::const_iterator;
+
+        /// @brief Minimum number of slots
+        static constexpr std::size_t MIN_CAPACITY = 16;
+
+        /// @brief
+        FlatHashMap() = default;
+
+        /// @brief
+        /// @param count Expected number of keys
+        explicit FlatHashMap(const std::size_t count)
+        {
+            reserve(count);
+        }
+
+        /// @brief
+        /// @return
+        [[nodiscard]]
+        std::size_t size() const noexcept
+        {
+            return _entries.size();
+        }
+
+        /// @brief
+        /// @return
+        [[nodiscard]]
+        bool empty() const noexcept
+        {
+            return _entries.empty();
+        }
+
+        /// @brief
+        /// @return
+        const_iterator begin() const noexcept
+        {
+            return _entries.cbegin();
+        }
+
+        /// @brief
+        /// @return
+        const_iterator end() const noexcept
+        {
+            return _entries.cend();
+        }
+
+        /// @brief Prepares the table for count keys, so they are inserted without rehashing
+        /// @param count
+        void reserve(const std::size_t count)
+        {
+            _entries.reserve(count);
+            if (count * 2 > _slots.size())
+                Rehash(std::bit_ceil(std::max(count * 2, MIN_CAPACITY)));
+        }
+
+        /// @brief
+        /// @param key
+        /// @return Value of the key, it is value-initialized if the key is new
+        TValue& operator[](const TKey& key)
+        requires std::default_initializable<TValue>
+        {
+            if ((_entries.size() + 1) * 2 > _slots.size())
+                Rehash(std::max(_slots.size() * 2, MIN_CAPACITY));
+
+            std::size_t slot = Slot(key);
+            while (_slots[slot] != 0)
+            {
+                value_type& entry = _entries[_slots[slot] - 1];
+                if (entry.first == key)
+                    return entry.second;
+                slot = (slot + 1) & (_slots.size() - 1);
+            }
+
+            _entries.emplace_back(key, TValue());
+            _slots[slot] = _entries.size();
+            return _entries.back().second;
+        }
+
+        /// @brief
+        /// @param key
+        /// @return Pointer to the value of the key, or nullptr
+        TValue* Find(const TKey& key) noexcept
+        {
+            const std::size_t index = IndexOf(key);
+            return index == 0 ? nullptr : &_entries[index - 1].second;
+        }
+
+        /// @brief
+        /// @param key
+        /// @return Pointer to the value of the key, or nullptr
+        const TValue* Find(const TKey& key) const noexcept
+        {
+            const std::size_t index = IndexOf(key);
+            return index == 0 ? nullptr : &_entries[index - 1].second;
+        }
+
+        /// @brief
+        /// @param key
+        /// @return
+        bool Contains(const TKey& key) const noexcept
+        {
+            return IndexOf(key) != 0;
+        }
+
+        /// @brief Takes the entries in the order of insertion, the map becomes empty
+        /// @return
+        std::vector<value_type> ToVector() && noexcept
+        {
+            _slots.clear();
+            _shift = 0;
+            return std::move(_entries);
+        }
+
+    private:
+        std::vector<value_type> _entries;
+        std::vector<std::size_t> _slots;
+        std::size_t _shift = 0;
+        [[no_unique_address]] THash _hash;
+
+        // Fibonacci hashing takes the high bits of the product, so identity hashes of integers are spread
+        // over the whole table.
+        std::size_t Slot(const TKey& key) const noexcept
+        {
+            const auto hash = static_cast<std::uint64_t>(_hash(key));
+            return static_cast<std::size_t>((hash * 0x9E3779B97F4A7C15ull) >> _shift);
+        }
+
+        std::size_t IndexOf(const TKey& key) const noexcept
+        {
+            if (_slots.empty())
+                return 0;
+
+            std::size_t slot = Slot(key);
+            while (_slots[slot] != 0)
+            {
+                if (_entries[_slots[slot] - 1].first == key)
+                    return _slots[slot];
+                slot = (slot + 1) & (_slots.size() - 1);
+            }
+
+            return 0;
+        }
+
+        void Rehash(const std::size_t capacity)
+        {
+            _slots.assign(capacity, 0);
+            _shift = 64 - static_cast<std::size_t>(std::countr_zero(capacity));
+
+            for (std::size_t i = 0; i < _entries.size(); ++i)
+            {
+                std::size_t slot = Slot(_entries[i].first);
+                while (_slots[slot] != 0)
+                    slot = (slot + 1) & (capacity - 1);
+                _slots[slot] = i + 1;
+            }
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef LINQ_FramePool_H
+#define LINQ_FramePool_H
+
+#include <array>
+#include <cstddef>
+#include <new>
+
+/// @brief
+namespace ExtendedCpp::LINQ
+{
+    /// @brief Thread-local cache of coroutine frames. Every operator of a generator pipeline allocates a frame,
+    /// released frames are kept in lists by size class and reused by the next pipelines of the same thread
+    class FramePool final
+    {
+    public:
+        /// @brief Frame sizes are rounded up to a multiple of this value
+        static constexpr std::size_t GRANULARITY = 64;
+
+        /// @brief Number of cached size classes, larger frames go to the global heap directly
+        static constexpr std::size_t SIZE_CLASSES = 32;
+
+        /// @brief Maximum number of cached frames of one size class
+        static constexpr std::size_t MAX_CACHED_FRAMES = 64;
+
+        /// @brief
+        /// @param size
+        /// @return Memory for a coroutine frame
+        static void* Allocate(const std::size_t size)
+        {
+            const std::size_t sizeClass = SizeClass(size);
+            if (sizeClass >= SIZE_CLASSES)
+                return ::operator new(size);
+
+            // Every frame of a size class is large enough for any frame of the class, wherever it is released.
+            if (_destroyed)
+                return ::operator new((sizeClass + 1) * GRANULARITY);
+
+            Bucket& bucket = LocalCache().Buckets[sizeClass];
+            if (bucket.Head == nullptr)
+                return ::operator new((sizeClass + 1) * GRANULARITY);
+
+            FreeFrame* frame = bucket.Head;
+            bucket.Head = frame->Next;
+            --bucket.Count;
+            return frame;
+        }
+
+        /// @brief
+        /// @param frame Memory returned by Allocate
+        /// @param size Size passed to Allocate
+        static void Deallocate(void* frame, const std::size_t size) noexcept
+        {
+            const std::size_t sizeClass = SizeClass(size);
+            if (sizeClass >= SIZE_CLASSES || _destroyed)
+            {
+                ::operator delete(frame);
+                return;
+            }
+
+            Bucket& bucket = LocalCache().Buckets[sizeClass];
+            if (bucket.Count == MAX_CACHED_FRAMES)
+            {
+                ::operator delete(frame);
+                return;
+            }
+
+            bucket.Head = ::new(frame) FreeFrame { bucket.Head };
+            ++bucket.Count;
+        }
+
+    private:
+        struct FreeFrame final
+        {
+            FreeFrame* Next;
+        };
+
+        struct Bucket final
+        {
+            FreeFrame* Head = nullptr;
+            std::size_t Count = 0;
+        };
+
+        struct Cache final
+        {
+            std::array<Bucket, SIZE_CLASSES> Buckets;
+
+            ~Cache()
+            {
+                for (Bucket& bucket : Buckets)
+                {
+                    while (bucket.Head != nullptr)
+                    {
+                        FreeFrame* frame = bucket.Head;
+                        bucket.Head = frame->Next;
+                        ::operator delete(frame);
+                    }
+                }
+                _destroyed = true;
+            }
+        };
+
+        // Frames released during thread exit, after the cache is gone, go to the global heap.
+        inline static thread_local bool _destroyed = false;
+
+        static Cache& LocalCache() noexcept
+        {
+            thread_local Cache cache;
+            return cache;
+        }
+
+        static std::size_t SizeClass(const std::size_t size) noexcept
+        {
+            return size == 0 ? 0 : (size - 1) / GRANULARITY;
+        }
+    };
+}
+
+#endif
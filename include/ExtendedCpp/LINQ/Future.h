@@ -3,6 +3,11 @@
 
 #include <coroutine>
 #include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <ExtendedCpp/LINQ/FramePool.h>
 
 /// @brief 
 namespace ExtendedCpp::LINQ
@@ -23,9 +28,26 @@ namespace ExtendedCpp::LINQ
         /// @brief 
         using handle_type = std::coroutine_handle<promise_type>;
 
-        /// @brief 
+        /// @brief Keeps a pointer to the yielded value, which stays alive in the coroutine frame
+        /// or in the yield expression until the coroutine is resumed
         struct promise_type final
         {
+            /// @brief Coroutine frames are taken from the frame pool of the thread
+            /// @param size 
+            /// @return 
+            static void* operator new(const std::size_t size)
+            {
+                return FramePool::Allocate(size);
+            }
+
+            /// @brief 
+            /// @param frame 
+            /// @param size 
+            static void operator delete(void* frame, const std::size_t size) noexcept
+            {
+                FramePool::Deallocate(frame, size);
+            }
+
             /// @brief 
             /// @return 
             std::suspend_never initial_suspend() noexcept { return {}; }
@@ -33,7 +55,7 @@ namespace ExtendedCpp::LINQ
             /// @brief 
             /// @return 
             std::suspend_always final_suspend() noexcept { return {}; }
-            
+
             /// @brief 
             void return_void() noexcept {}
 
@@ -43,13 +65,35 @@ namespace ExtendedCpp::LINQ
                 std::rethrow_exception(std::current_exception());
             }
 
-            /// @brief 
+            /// @brief Yields a value, which may be moved out by the consumer
             /// @param value 
             /// @return 
-            std::suspend_always yield_value(TSource value) 
-            noexcept(std::is_nothrow_move_assignable_v<TSource>)
+            std::suspend_always yield_value(std::remove_cvref_t<TSource>&& value) noexcept
+            {
+                _value = std::addressof(value);
+                _movable = true;
+                return {};
+            }
+
+            /// @brief Yields a value, which is copied by the consumer
+            /// @param value 
+            /// @return 
+            std::suspend_always yield_value(const std::remove_cvref_t<TSource>& value) noexcept
+            {
+                _value = std::addressof(value);
+                _movable = false;
+                return {};
+            }
+
+            /// @brief Passes on the current value of another generator without copying it,
+            /// the other generator must not be resumed until this coroutine is resumed
+            /// @param source 
+            /// @return 
+            std::suspend_always yield_value(const Future& source) noexcept
             {
-                _value = std::move(value);
+                const promise_type& promise = source._handle.promise();
+                _value = promise._value;
+                _movable = promise._movable;
                 return {};
             }
 
@@ -61,14 +105,25 @@ namespace ExtendedCpp::LINQ
             }
 
             /// @brief 
-            /// @return 
-            TSource Value() const noexcept
+            /// @return Reference to the yielded value, valid until the coroutine is resumed
+            const TSource& Value() const noexcept
+            {
+                return *_value;
+            }
+
+            /// @brief 
+            /// @return Yielded value, moved if it was yielded as rvalue
+            TSource Take()
             {
-                return _value;
+                if constexpr (!std::is_trivially_copyable_v<TSource>)
+                    if (_movable)
+                        return std::move(*const_cast<TSource*>(_value));
+                return *_value;
             }
 
         private:
-            TSource _value;
+            const TSource* _value = nullptr;
+            bool _movable = false;
         };
 
         /// @brief 
@@ -76,6 +131,25 @@ namespace ExtendedCpp::LINQ
         explicit Future(handle_type handle) noexcept :
             _handle(handle) {}
 
+        /// @brief 
+        /// @param other 
+        Future(Future&& other) noexcept :
+            _handle(std::exchange(other._handle, nullptr)) {}
+
+        /// @brief 
+        /// @param other 
+        /// @return 
+        Future& operator=(Future&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (_handle)
+                    _handle.destroy();
+                _handle = std::exchange(other._handle, nullptr);
+            }
+            return *this;
+        }
+
         /// @brief 
         ~Future()
         {
@@ -91,31 +165,45 @@ namespace ExtendedCpp::LINQ
         }
 
         /// @brief 
-        /// @return 
+        /// @return Copy of the current value
         TSource Value() const noexcept
         {
-            if (!_handle.done())
+            if (*this)
                 return _handle.promise().Value();
             else
                 return {};
         }
 
         /// @brief 
-        /// @return 
+        /// @return Reference to the current value, valid until the next call of Next. Must not be called after the end
+        const TSource& Current() const noexcept
+        {
+            return _handle.promise().Value();
+        }
+
+        /// @brief Takes the current value and resumes the coroutine
+        /// @return Current value, moved out of the coroutine when possible
         TSource Next() noexcept
         {
-            if (!_handle.done())
+            if (*this)
             {
-                TSource value = _handle.promise().Value();
+                TSource value = _handle.promise().Take();
                 _handle.resume();
                 return value;
             }
             else return {};
         }
 
+        /// @brief Resumes the coroutine without taking the current value
+        void Skip() noexcept
+        {
+            if (*this)
+                _handle.resume();
+        }
+
     private:
         handle_type _handle;
     };
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,565 @@
+#ifndef LINQ_IncrementalQuery_H
+#define LINQ_IncrementalQuery_H
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <stdexcept>
+#include <type_traits>
+#include <concepts>
+#include <utility>
+
+#include <ExtendedCpp/Events/IEventHandler.h>
+#include <ExtendedCpp/LINQ/Concepts.h>
+#include <ExtendedCpp/LINQ/ObservableCollection.h>
+
+/// @brief
+namespace ExtendedCpp::LINQ
+{
+    /// @brief Sum, which is updated by every inserted and erased value
+    /// @tparam TValue
+    template<typename TValue>
+    requires Concepts::Summarize<TValue> && Concepts::Subtractable<TValue> && std::default_initializable<TValue>
+    class SumReducer final
+    {
+    public:
+        /// @brief
+        using value_type = TValue;
+
+        /// @brief
+        /// @param value
+        void Insert(const TValue& value)
+        {
+            _sum = _sum + value;
+        }
+
+        /// @brief
+        /// @param value
+        void Erase(const TValue& value)
+        {
+            _sum = _sum - value;
+        }
+
+        /// @brief
+        /// @return
+        const TValue& Result() const noexcept
+        {
+            return _sum;
+        }
+
+    private:
+        TValue _sum {};
+    };
+
+    /// @brief Number of values, which is updated by every inserted and erased value
+    /// @tparam TValue
+    template<typename TValue>
+    class CountReducer final
+    {
+    public:
+        /// @brief
+        using value_type = TValue;
+
+        /// @brief
+        void Insert(const TValue&) noexcept
+        {
+            ++_count;
+        }
+
+        /// @brief
+        void Erase(const TValue&) noexcept
+        {
+            --_count;
+        }
+
+        /// @brief
+        /// @return
+        std::size_t Result() const noexcept
+        {
+            return _count;
+        }
+
+    private:
+        std::size_t _count = 0;
+    };
+
+    /// @brief Average, which is updated by every inserted and erased value
+    /// @tparam TValue
+    template<typename TValue>
+    requires Concepts::Summarize<TValue> && Concepts::Subtractable<TValue> &&
+             Concepts::Divisible<TValue> && std::default_initializable<TValue>
+    class AverageReducer final
+    {
+    public:
+        /// @brief
+        using value_type = TValue;
+
+        /// @brief
+        /// @param value
+        void Insert(const TValue& value)
+        {
+            _sum.Insert(value);
+            _count.Insert(value);
+        }
+
+        /// @brief
+        /// @param value
+        void Erase(const TValue& value)
+        {
+            _sum.Erase(value);
+            _count.Erase(value);
+        }
+
+        /// @brief
+        /// @return Default value if there are no values
+        TValue Result() const
+        {
+            if (_count.Result() == 0)
+                return TValue {};
+            // A negative sum divided by std::size_t would be converted to unsigned.
+            if constexpr (std::is_arithmetic_v<TValue>)
+                return static_cast<TValue>(_sum.Result() / static_cast<TValue>(_count.Result()));
+            else
+                return static_cast<TValue>(_sum.Result() / _count.Result());
+        }
+
+    private:
+        SumReducer<TValue> _sum;
+        CountReducer<TValue> _count;
+    };
+
+    /// @brief Values in no particular order, each inserted and erased value is found by hash
+    /// @tparam TValue
+    template<typename TValue>
+    requires Concepts::Hashable<TValue> && Concepts::Equatable<TValue>
+    class BagReducer final
+    {
+    public:
+        /// @brief
+        using value_type = TValue;
+
+        /// @brief
+        /// @param value
+        void Insert(const TValue& value)
+        {
+            _values.insert(value);
+        }
+
+        /// @brief
+        /// @param value
+        void Erase(const TValue& value)
+        {
+            const auto position = _values.find(value);
+            if (position != _values.end())
+                _values.erase(position);
+        }
+
+        /// @brief
+        /// @return
+        const std::unordered_multiset<TValue>& Result() const noexcept
+        {
+            return _values;
+        }
+
+    private:
+        std::unordered_multiset<TValue> _values;
+    };
+
+    /// @brief Reducer per key, a group is removed with its last value
+    /// @tparam TKey
+    /// @tparam TReducer Reducer of values of one group
+    template<typename TKey, typename TReducer>
+    requires Concepts::Hashable<TKey> && Concepts::Equatable<TKey>
+    class GroupReducer final
+    {
+    public:
+        /// @brief
+        using value_type = std::pair<TKey, typename TReducer::value_type>;
+
+        /// @brief
+        using result_type = std::decay_t<decltype(std::declval<const TReducer&>().Result())>;
+
+        /// @brief
+        /// @param value
+        void Insert(const value_type& value)
+        {
+            Group& group = _groups[value.first];
+            group.Reducer.Insert(value.second);
+            ++group.Count;
+        }
+
+        /// @brief
+        /// @param value
+        void Erase(const value_type& value)
+        {
+            const auto position = _groups.find(value.first);
+            if (position == _groups.end())
+                return;
+
+            position->second.Reducer.Erase(value.second);
+            if (--position->second.Count == 0)
+                _groups.erase(position);
+        }
+
+        /// @brief
+        /// @return Number of groups
+        [[nodiscard]]
+        std::size_t size() const noexcept
+        {
+            return _groups.size();
+        }
+
+        /// @brief
+        /// @param key
+        /// @return
+        bool Contains(const TKey& key) const
+        {
+            return _groups.contains(key);
+        }
+
+        /// @brief
+        /// @param key
+        /// @return Result of the group
+        result_type At(const TKey& key) const
+        {
+            const auto position = _groups.find(key);
+            if (position == _groups.end())
+                throw std::out_of_range("There is no group with the key");
+            return position->second.Reducer.Result();
+        }
+
+        /// @brief Collects results of all groups, it takes O(number of groups)
+        /// @return
+        std::unordered_map<TKey, result_type> Result() const
+        {
+            std::unordered_map<TKey, result_type> result;
+            result.reserve(_groups.size());
+            for (const auto& [key, group] : _groups)
+                result.emplace(key, group.Reducer.Result());
+            return result;
+        }
+
+    private:
+        struct Group final
+        {
+            TReducer Reducer;
+            std::size_t Count = 0;
+        };
+
+        std::unordered_map<TKey, Group> _groups;
+    };
+
+    /// @brief Result of a query over the observable collection, which is kept up to date by its events.
+    /// Every inserted or erased element passes the filters and the selectors of the query once and changes
+    /// the reducer in place, so an update costs O(1) instead of O(n) of the new query. Selectors must give
+    /// the same result for the same element, otherwise erased elements are not found in the result.
+    /// The collection must outlive the query and must not be changed concurrently with it
+    /// @tparam TSource
+    /// @tparam TReducer
+    template<std::copyable TSource, typename TReducer>
+    class MaterializedQuery final
+    {
+    public:
+        /// @brief
+        using value_type = typename TReducer::value_type;
+
+        /// @brief Folds the elements, which are already in the collection, and subscribes to its changes
+        /// @param source
+        /// @param map Filters and selectors of the query, std::nullopt means that the element is filtered out
+        /// @param reducer
+        MaterializedQuery(ObservableCollection<TSource>& source,
+                          std::function<std::optional<value_type>(const TSource&)> map,
+                          TReducer reducer = TReducer()) :
+            _source(source),
+            _map(std::move(map)),
+            _reducer(std::move(reducer))
+        {
+            for (const TSource& element : _source)
+                OnInserted(element);
+
+            _insertedHandler = std::make_shared<DeltaHandler>([this](const TSource& element) { OnInserted(element); });
+            _erasedHandler = std::make_shared<DeltaHandler>([this](const TSource& element) { OnErased(element); });
+            _source.Inserted += _insertedHandler;
+            _source.Erased += _erasedHandler;
+        }
+
+        /// @brief Handlers refer to this query
+        MaterializedQuery(const MaterializedQuery&) = delete;
+
+        /// @brief Handlers refer to this query
+        MaterializedQuery& operator=(const MaterializedQuery&) = delete;
+
+        /// @brief Unsubscribes from the collection
+        ~MaterializedQuery()
+        {
+            _source.Inserted -= _insertedHandler;
+            _source.Erased -= _erasedHandler;
+        }
+
+        /// @brief
+        /// @return Current result of the query
+        decltype(auto) Result() const
+        {
+            return _reducer.Result();
+        }
+
+        /// @brief
+        /// @return Reducer for the access to parts of the result, such as a single group
+        const TReducer& Reducer() const noexcept
+        {
+            return _reducer;
+        }
+
+    private:
+        // Identity of the handler is its address, so handlers of different queries never replace each other.
+        class DeltaHandler final : public Events::IEventHandler<const TSource&>
+        {
+        public:
+            explicit DeltaHandler(std::function<void(const TSource&)> function) noexcept :
+                _function(std::move(function)) {}
+
+            void Call(const TSource& element) const override
+            {
+                _function(element);
+            }
+
+        protected:
+            bool IsEquals(const Events::IEventHandler<const TSource&>& other) const noexcept override
+            {
+                return this == &other;
+            }
+
+        private:
+            std::function<void(const TSource&)> _function;
+        };
+
+        ObservableCollection<TSource>& _source;
+        std::function<std::optional<value_type>(const TSource&)> _map;
+        TReducer _reducer;
+        std::shared_ptr<Events::IEventHandler<const TSource&>> _insertedHandler;
+        std::shared_ptr<Events::IEventHandler<const TSource&>> _erasedHandler;
+
+        void OnInserted(const TSource& element)
+        {
+            if (std::optional<value_type> value = _map(element))
+                _reducer.Insert(*value);
+        }
+
+        void OnErased(const TSource& element)
+        {
+            if (std::optional<value_type> value = _map(element))
+                _reducer.Erase(*value);
+        }
+    };
+
+    template<std::copyable TSource, typename TKey, typename TValue>
+    class IncrementalGroupBy;
+
+    /// @brief Description of a query over the observable collection. Filters and selectors are composed
+    /// into one function of an element, the final aggregate creates the materialized query
+    /// @tparam TSource
+    /// @tparam TResult
+    template<std::copyable TSource, typename TResult = TSource>
+    class IncrementalQuery final
+    {
+    public:
+        /// @brief
+        using value_type = TResult;
+
+        /// @brief
+        /// @param source
+        explicit IncrementalQuery(ObservableCollection<TSource>& source)
+        requires std::same_as<TSource, TResult> :
+            _source(&source),
+            _map([](const TSource& element) { return std::optional<TSource>(element); }) {}
+
+        /// @brief
+        /// @param source
+        /// @param map
+        IncrementalQuery(ObservableCollection<TSource>& source,
+                         std::function<std::optional<TResult>(const TSource&)> map) noexcept :
+            _source(&source),
+            _map(std::move(map)) {}
+
+        /// @brief
+        /// @tparam TPredicate
+        /// @param predicate
+        /// @return
+        template<Concepts::IsPredicate<TResult> TPredicate>
+        IncrementalQuery Where(TPredicate&& predicate) const
+        {
+            return IncrementalQuery(*_source, [map = _map, predicate = std::forward<TPredicate>(predicate)]
+                (const TSource& element) -> std::optional<TResult>
+            {
+                std::optional<TResult> value = map(element);
+                if (value && !predicate(*value))
+                    return std::nullopt;
+                return value;
+            });
+        }
+
+        /// @brief
+        /// @tparam TSelector
+        /// @tparam TNext
+        /// @param selector
+        /// @return
+        template<std::invocable<TResult> TSelector,
+                 typename TNext = std::decay_t<std::invoke_result_t<TSelector, TResult>>>
+        IncrementalQuery<TSource, TNext> Select(TSelector&& selector) const
+        {
+            return IncrementalQuery<TSource, TNext>(*_source, [map = _map, selector = std::forward<TSelector>(selector)]
+                (const TSource& element) -> std::optional<TNext>
+            {
+                std::optional<TResult> value = map(element);
+                if (!value)
+                    return std::nullopt;
+                return std::optional<TNext>(selector(*value));
+            });
+        }
+
+        /// @brief
+        /// @tparam TKeySelector
+        /// @tparam TKey
+        /// @param keySelector
+        /// @return
+        template<std::invocable<TResult> TKeySelector,
+                 typename TKey = std::decay_t<std::invoke_result_t<TKeySelector, TResult>>>
+        requires Concepts::Hashable<TKey> && Concepts::Equatable<TKey>
+        IncrementalGroupBy<TSource, TKey, TResult> GroupBy(TKeySelector&& keySelector) const
+        {
+            return IncrementalGroupBy<TSource, TKey, TResult>(*_source,
+                [map = _map, keySelector = std::forward<TKeySelector>(keySelector)]
+                (const TSource& element) -> std::optional<std::pair<TKey, TResult>>
+            {
+                std::optional<TResult> value = map(element);
+                if (!value)
+                    return std::nullopt;
+                return std::optional<std::pair<TKey, TResult>>(std::in_place, keySelector(*value), std::move(*value));
+            });
+        }
+
+        /// @brief
+        /// @return
+        auto Sum() const
+        requires Concepts::Summarize<TResult> && Concepts::Subtractable<TResult> && std::default_initializable<TResult>
+        {
+            return MaterializedQuery<TSource, SumReducer<TResult>>(*_source, _map);
+        }
+
+        /// @brief
+        /// @tparam TSelector
+        /// @param selector
+        /// @return
+        template<std::invocable<TResult> TSelector>
+        auto Sum(TSelector&& selector) const
+        {
+            return Select(std::forward<TSelector>(selector)).Sum();
+        }
+
+        /// @brief
+        /// @return
+        MaterializedQuery<TSource, CountReducer<TResult>> Count() const
+        {
+            return MaterializedQuery<TSource, CountReducer<TResult>>(*_source, _map);
+        }
+
+        /// @brief
+        /// @return
+        auto Average() const
+        requires Concepts::Summarize<TResult> && Concepts::Subtractable<TResult> &&
+                 Concepts::Divisible<TResult> && std::default_initializable<TResult>
+        {
+            return MaterializedQuery<TSource, AverageReducer<TResult>>(*_source, _map);
+        }
+
+        /// @brief
+        /// @tparam TSelector
+        /// @param selector
+        /// @return
+        template<std::invocable<TResult> TSelector>
+        auto Average(TSelector&& selector) const
+        {
+            return Select(std::forward<TSelector>(selector)).Average();
+        }
+
+        /// @brief
+        /// @return Filtered and projected elements in no particular order
+        auto ToBag() const
+        requires Concepts::Hashable<TResult> && Concepts::Equatable<TResult>
+        {
+            return MaterializedQuery<TSource, BagReducer<TResult>>(*_source, _map);
+        }
+
+    private:
+        ObservableCollection<TSource>* _source;
+        std::function<std::optional<TResult>(const TSource&)> _map;
+    };
+
+    /// @brief Description of a grouped query over the observable collection, the aggregate of every group
+    /// is maintained by its own reducer
+    /// @tparam TSource
+    /// @tparam TKey
+    /// @tparam TValue
+    template<std::copyable TSource, typename TKey, typename TValue>
+    class IncrementalGroupBy final
+    {
+    public:
+        /// @brief
+        /// @param source
+        /// @param map
+        IncrementalGroupBy(ObservableCollection<TSource>& source,
+                           std::function<std::optional<std::pair<TKey, TValue>>(const TSource&)> map) noexcept :
+            _source(&source),
+            _map(std::move(map)) {}
+
+        /// @brief
+        /// @tparam TSelector
+        /// @param selector
+        /// @return Sum of selected values per key
+        template<std::invocable<TValue> TSelector,
+                 typename TResult = std::decay_t<std::invoke_result_t<TSelector, TValue>>>
+        MaterializedQuery<TSource, GroupReducer<TKey, SumReducer<TResult>>> Sum(TSelector&& selector) const
+        {
+            return MaterializedQuery<TSource, GroupReducer<TKey, SumReducer<TResult>>>(*_source, Project(std::forward<TSelector>(selector)));
+        }
+
+        /// @brief
+        /// @return Number of values per key
+        MaterializedQuery<TSource, GroupReducer<TKey, CountReducer<TValue>>> Count() const
+        {
+            return MaterializedQuery<TSource, GroupReducer<TKey, CountReducer<TValue>>>(*_source, _map);
+        }
+
+        /// @brief
+        /// @tparam TSelector
+        /// @param selector
+        /// @return Average of selected values per key
+        template<std::invocable<TValue> TSelector,
+                 typename TResult = std::decay_t<std::invoke_result_t<TSelector, TValue>>>
+        MaterializedQuery<TSource, GroupReducer<TKey, AverageReducer<TResult>>> Average(TSelector&& selector) const
+        {
+            return MaterializedQuery<TSource, GroupReducer<TKey, AverageReducer<TResult>>>(*_source, Project(std::forward<TSelector>(selector)));
+        }
+
+    private:
+        ObservableCollection<TSource>* _source;
+        std::function<std::optional<std::pair<TKey, TValue>>(const TSource&)> _map;
+
+        template<typename TSelector, typename TResult = std::decay_t<std::invoke_result_t<TSelector, TValue>>>
+        std::function<std::optional<std::pair<TKey, TResult>>(const TSource&)> Project(TSelector&& selector) const
+        {
+            return [map = _map, selector = std::forward<TSelector>(selector)]
+                (const TSource& element) -> std::optional<std::pair<TKey, TResult>>
+            {
+                std::optional<std::pair<TKey, TValue>> value = map(element);
+                if (!value)
+                    return std::nullopt;
+                return std::optional<std::pair<TKey, TResult>>(std::in_place, std::move(value->first), selector(value->second));
+            };
+        }
+    };
+}
+
+#endif
@@ -2,7 +2,12 @@
 #define LINQ_Iterators_H
 
 #include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
 #include <optional>
+#include <ranges>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -11,775 +16,1302 @@
 /// @brief
 namespace ExtendedCpp::LINQ
 {
-	/// @brief 
-	/// @tparam TInIterator 
-	template<std::forward_iterator TInIterator>
-	struct OptionalIterator final
+	/// @brief Function object stored in an iterator. Lambdas are not copy assignable,
+	/// so the box is reconstructed on assignment to keep the iterator std::semiregular
+	/// @tparam TFunction
+	template<typename TFunction>
+	struct FunctionBox final
 	{
 	private:
-		TInIterator _inIterator;
+		std::optional<std::decay_t<TFunction>> _function;
 
 	public:
-		/// @brief 
-		using value_type = TInIterator::value_type;
-
-		/// @brief 
-		/// @param inIterator 
-		explicit OptionalIterator(TInIterator inIterator) noexcept :
-			_inIterator(inIterator) {}
-
-		/// @brief 
-		/// @return 
-		std::optional<value_type> operator*() const 
-		noexcept(std::is_nothrow_invocable_v<decltype(&TInIterator::operator*)>)
-		{
-			return *_inIterator;
-		}
-
-		/// @brief 
-		/// @return 
-		OptionalIterator& operator++() noexcept
+		/// @brief
+		FunctionBox() noexcept = default;
+
+		/// @brief
+		/// @param function
+		explicit FunctionBox(TFunction&& function) :
+			_function(std::in_place, std::forward<TFunction>(function)) {}
+
+		/// @brief
+		/// @param other
+		FunctionBox(const FunctionBox& other) = default;
+
+		/// @brief
+		/// @param other
+		FunctionBox(FunctionBox&& other) noexcept = default;
+
+		/// @brief
+		/// @param other
+		/// @return
+		FunctionBox& operator=(const FunctionBox& other)
 		{
-			++_inIterator;
+			if (this != &other)
+			{
+				if (other._function.has_value())
+					_function.emplace(*other._function);
+				else
+					_function.reset();
+			}
 			return *this;
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
-		bool operator!=(const OptionalIterator& other) const noexcept
+		/// @brief
+		/// @param other
+		/// @return
+		FunctionBox& operator=(FunctionBox&& other) noexcept(std::is_nothrow_move_constructible_v<std::decay_t<TFunction>>)
 		{
-			return _inIterator != other._inIterator;
+			if (this != &other)
+			{
+				if (other._function.has_value())
+					_function.emplace(std::move(*other._function));
+				else
+					_function.reset();
+			}
+			return *this;
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
-		bool operator==(const OptionalIterator& other) const noexcept
+		/// @brief
+		/// @tparam TArgs
+		/// @param args
+		/// @return
+		template<typename... TArgs>
+		decltype(auto) operator()(TArgs&&... args) const
+		noexcept(std::is_nothrow_invocable_v<const std::decay_t<TFunction>&, TArgs...>)
 		{
-			return _inIterator == other._inIterator;
+			return std::invoke(*_function, std::forward<TArgs>(args)...);
 		}
 	};
 
-	/// @brief 
-	/// @tparam TOut 
-	/// @tparam TInIterator 
-	/// @tparam TSelector 
+	/// @brief Standard iterator category of the source, limited by TMaxCategory
+	/// @tparam TInIterator
+	/// @tparam TMaxCategory
+	template<std::forward_iterator TInIterator, typename TMaxCategory>
+	using IteratorCategory = std::conditional_t<
+		std::derived_from<typename std::iterator_traits<TInIterator>::iterator_category, TMaxCategory>,
+		TMaxCategory, typename std::iterator_traits<TInIterator>::iterator_category>;
+
+	/// @brief Iterator concept of the source, limited to random access
+	/// @tparam TInIterator
+	template<std::forward_iterator TInIterator>
+	using IteratorConcept = std::conditional_t<std::random_access_iterator<TInIterator>, std::random_access_iterator_tag,
+		std::conditional_t<std::bidirectional_iterator<TInIterator>, std::bidirectional_iterator_tag,
+						   std::forward_iterator_tag>>;
+
+	/// @brief
+	/// @tparam TOut
+	/// @tparam TInIterator
+	/// @tparam TSelector
 	template<typename TOut,
-			 Concepts::OptionalIter TInIterator,
-			 std::invocable<typename TInIterator::value_type> TSelector>
-	requires std::same_as<TOut, std::invoke_result_t<TSelector, typename TInIterator::value_type>>
+			 std::forward_iterator TInIterator,
+			 std::invocable<std::iter_reference_t<TInIterator>> TSelector>
+	requires std::convertible_to<std::invoke_result_t<TSelector, std::iter_reference_t<TInIterator>>, TOut>
 	struct SelectorIterator final
 	{
 	private:
 		TInIterator _inIterator;
-		TSelector _selector;
+		FunctionBox<TSelector> _selector;
 
 	public:
-		/// @brief 
-		using value_type = TOut;
+		/// @brief
+		using value_type = std::remove_cvref_t<TOut>;
+
+		/// @brief
+		using difference_type = std::iter_difference_t<TInIterator>;
+
+		/// @brief
+		using iterator_concept = IteratorConcept<TInIterator>;
+
+		/// @brief Legacy algorithms require a reference from forward iterators, so a selector
+		/// returning a value makes the iterator a legacy input iterator. Such an iterator is accepted
+		/// by the std::ranges algorithms, but not by the overloads taking an execution policy
+		using iterator_category = std::conditional_t<std::is_reference_v<TOut>,
+			IteratorCategory<TInIterator, std::random_access_iterator_tag>, std::input_iterator_tag>;
+
+		/// @brief
+		SelectorIterator() = default;
 
-		/// @brief 
-		/// @param inIterator 
-		/// @param selector 
-		SelectorIterator(TInIterator inIterator, TSelector&& selector) noexcept :
+		/// @brief
+		/// @param inIterator
+		/// @param selector
+		SelectorIterator(TInIterator inIterator, TSelector&& selector) :
 			_inIterator(inIterator),
 			_selector(std::forward<TSelector>(selector)) {}
 
-		/// @brief 
-		/// @param inIterator 
-		SelectorIterator(TInIterator inIterator) noexcept :
+		/// @brief
+		/// @param inIterator
+		explicit SelectorIterator(TInIterator inIterator) noexcept :
 			_inIterator(inIterator) {}
 
-		/// @brief 
-		/// @return 
-		std::optional<value_type> operator*() const 
-		noexcept(std::is_nothrow_invocable_v<TSelector, typename TInIterator::value_type> &&
-				 std::is_nothrow_invocable_v<decltype(&TInIterator::operator*)>)
+		/// @brief
+		/// @return
+		TOut operator*() const
+		noexcept(std::is_nothrow_invocable_v<TSelector, std::iter_reference_t<TInIterator>>)
 		{
-			if ((*_inIterator).has_value())
-				return _selector((*_inIterator).value());
-			else
-				return std::nullopt;
+			return _selector(*_inIterator);
 		}
 
-		/// @brief 
-		/// @return 
+		/// @brief
+		/// @return
 		SelectorIterator& operator++() noexcept
 		{
 			++_inIterator;
 			return *this;
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
+		/// @brief
+		/// @return
+		SelectorIterator operator++(int) noexcept
+		{
+			SelectorIterator copy = *this;
+			++*this;
+			return copy;
+		}
+
+		/// @brief
+		/// @return
+		SelectorIterator& operator--() noexcept
+		requires std::bidirectional_iterator<TInIterator>
+		{
+			--_inIterator;
+			return *this;
+		}
+
+		/// @brief
+		/// @return
+		SelectorIterator operator--(int) noexcept
+		requires std::bidirectional_iterator<TInIterator>
+		{
+			SelectorIterator copy = *this;
+			--*this;
+			return copy;
+		}
+
+		/// @brief
+		/// @param offset
+		/// @return
+		SelectorIterator& operator+=(const difference_type offset) noexcept
+		requires std::random_access_iterator<TInIterator>
+		{
+			_inIterator += offset;
+			return *this;
+		}
+
+		/// @brief
+		/// @param offset
+		/// @return
+		SelectorIterator& operator-=(const difference_type offset) noexcept
+		requires std::random_access_iterator<TInIterator>
+		{
+			_inIterator -= offset;
+			return *this;
+		}
+
+		/// @brief
+		/// @param offset
+		/// @return
+		SelectorIterator operator+(const difference_type offset) const noexcept
+		requires std::random_access_iterator<TInIterator>
+		{
+			SelectorIterator result = *this;
+			return result += offset;
+		}
+
+		/// @brief
+		/// @param offset
+		/// @param iterator
+		/// @return
+		friend SelectorIterator operator+(const difference_type offset, const SelectorIterator& iterator) noexcept
+		requires std::random_access_iterator<TInIterator>
+		{
+			return iterator + offset;
+		}
+
+		/// @brief
+		/// @param offset
+		/// @return
+		SelectorIterator operator-(const difference_type offset) const noexcept
+		requires std::random_access_iterator<TInIterator>
+		{
+			SelectorIterator result = *this;
+			return result -= offset;
+		}
+
+		/// @brief
+		/// @param other
+		/// @return
+		difference_type operator-(const SelectorIterator& other) const noexcept
+		requires std::random_access_iterator<TInIterator>
+		{
+			return _inIterator - other._inIterator;
+		}
+
+		/// @brief
+		/// @param offset
+		/// @return
+		decltype(auto) operator[](const difference_type offset) const
+		requires std::random_access_iterator<TInIterator>
+		{
+			return *(*this + offset);
+		}
+
+		/// @brief
+		/// @param other
+		/// @return
+		auto operator<=>(const SelectorIterator& other) const noexcept
+		requires std::random_access_iterator<TInIterator>
+		{
+			return _inIterator <=> other._inIterator;
+		}
+
+		/// @brief
+		/// @param other
+		/// @return
 		bool operator!=(const SelectorIterator& other) const noexcept
 		{
 			return _inIterator != other._inIterator;
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
+		/// @brief
+		/// @param other
+		/// @return
 		bool operator==(const SelectorIterator& other) const noexcept
 		{
 			return _inIterator == other._inIterator;
 		}
 	};
 
-	/// @brief 
-	/// @tparam TInIterator 
-	/// @tparam TTransform 
-	template<Concepts::OptionalIter TInIterator,
-			 std::invocable<typename TInIterator::value_type&> TTransform>
-	requires std::same_as<std::invoke_result_t<TTransform, typename TInIterator::value_type&>, void>
+	/// @brief Applies the transform to a copy of every element, the source is not changed
+	/// @tparam TInIterator
+	/// @tparam TTransform
+	template<std::forward_iterator TInIterator,
+			 std::invocable<std::iter_value_t<TInIterator>&> TTransform>
+	requires std::same_as<std::invoke_result_t<TTransform, std::iter_value_t<TInIterator>&>, void>
 	struct TransformIterator final
 	{
 	private:
 		TInIterator _inIterator;
-		TTransform _transform;
+		FunctionBox<TTransform> _transform;
 
 	public:
-		/// @brief 
-		using value_type = typename TInIterator::value_type;
+		/// @brief
+		using value_type = std::iter_value_t<TInIterator>;
+
+		/// @brief
+		using difference_type = std::iter_difference_t<TInIterator>;
 
-		/// @brief 
-		/// @param inIterator 
-		/// @param transform 
-		TransformIterator(TInIterator inIterator, TTransform&& transform) noexcept :
+		/// @brief
+		using iterator_concept = IteratorConcept<TInIterator>;
+
+		/// @brief Legacy input iterator, like a SelectorIterator returning a value
+		using iterator_category = std::input_iterator_tag;
+
+		/// @brief
+		TransformIterator() = default;
+
+		/// @brief
+		/// @param inIterator
+		/// @param transform
+		TransformIterator(TInIterator inIterator, TTransform&& transform) :
 			_inIterator(inIterator),
 			_transform(std::forward<TTransform>(transform)) {}
 
-		/// @brief 
-		/// @param inIterator 
-		TransformIterator(TInIterator inIterator) noexcept :
+		/// @brief
+		/// @param inIterator
+		explicit TransformIterator(TInIterator inIterator) noexcept :
 			_inIterator(inIterator) {}
 
-		/// @brief 
-		/// @return 
-		std::optional<value_type> operator*() const 
-		noexcept(std::is_nothrow_invocable_v<TTransform, typename TInIterator::value_type&> &&
-				 std::is_nothrow_invocable_v<decltype(&TInIterator::operator*)>)
+		/// @brief
+		/// @return
+		value_type operator*() const
+		noexcept(std::is_nothrow_invocable_v<TTransform, value_type&> &&
+				 std::is_nothrow_copy_constructible_v<value_type>)
 		{
-			if ((*_inIterator).has_value())
-			{
-				auto value = (*_inIterator).value();
-				_transform(value);
-				return value;
-			}
-			else
-				return std::nullopt;
+			value_type value = *_inIterator;
+			_transform(value);
+			return value;
 		}
 
-		/// @brief 
-		/// @return 
+		/// @brief
+		/// @return
 		TransformIterator& operator++() noexcept
 		{
 			++_inIterator;
 			return *this;
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
-		bool operator!=(const TransformIterator& other) const noexcept
+		/// @brief
+		/// @return
+		TransformIterator operator++(int) noexcept
 		{
-			return _inIterator != other._inIterator;
+			TransformIterator copy = *this;
+			++*this;
+			return copy;
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
-		bool operator==(const TransformIterator& other) const noexcept
+		/// @brief
+		/// @return
+		TransformIterator& operator--() noexcept
+		requires std::bidirectional_iterator<TInIterator>
 		{
-			return _inIterator == other._inIterator;
+			--_inIterator;
+			return *this;
 		}
-	};
 
-	/// @brief 
-	/// @tparam TInIterator 
-	/// @tparam TPredicate 
-	template<Concepts::OptionalIter TInIterator,
-			 Concepts::IsPredicate<typename TInIterator::value_type> TPredicate>
-	struct WhereIterator final
-	{
-	private:
-		TInIterator _inIterator;
-		TPredicate _predicate;
+		/// @brief
+		/// @return
+		TransformIterator operator--(int) noexcept
+		requires std::bidirectional_iterator<TInIterator>
+		{
+			TransformIterator copy = *this;
+			--*this;
+			return copy;
+		}
 
-	public:
-		/// @brief 
-		using value_type = TInIterator::value_type;
+		/// @brief
+		/// @param offset
+		/// @return
+		TransformIterator& operator+=(const difference_type offset) noexcept
+		requires std::random_access_iterator<TInIterator>
+		{
+			_inIterator += offset;
+			return *this;
+		}
 
-		/// @brief 
-		/// @param inIterator 
-		/// @param predicate 
-		WhereIterator(TInIterator inIterator, TPredicate&& predicate) noexcept :
-			_inIterator(inIterator),
-			_predicate(std::forward<TPredicate>(predicate)) {}
+		/// @brief
+		/// @param offset
+		/// @return
+		TransformIterator& operator-=(const difference_type offset) noexcept
+		requires std::random_access_iterator<TInIterator>
+		{
+			_inIterator -= offset;
+			return *this;
+		}
 
-		/// @brief 
-		/// @param inIterator 
-		WhereIterator(TInIterator inIterator) noexcept :
-			_inIterator(inIterator) {}
+		/// @brief
+		/// @param offset
+		/// @return
+		TransformIterator operator+(const difference_type offset) const noexcept
+		requires std::random_access_iterator<TInIterator>
+		{
+			TransformIterator result = *this;
+			return result += offset;
+		}
 
-		std::optional<value_type> operator*() const 
-		noexcept(std::is_nothrow_invocable_v<TPredicate, typename TInIterator::value_type> &&
-				 std::is_nothrow_invocable_v<decltype(&TInIterator::operator*)>)
+		/// @brief
+		/// @param offset
+		/// @param iterator
+		/// @return
+		friend TransformIterator operator+(const difference_type offset, const TransformIterator& iterator) noexcept
+		requires std::random_access_iterator<TInIterator>
 		{
-			if ((*_inIterator).has_value() && _predicate((*_inIterator).value()))
-				return (*_inIterator).value();
-			else
-				return std::nullopt;
+			return iterator + offset;
 		}
 
-		/// @brief 
-		/// @return 
-		WhereIterator& operator++() noexcept
+		/// @brief
+		/// @param offset
+		/// @return
+		TransformIterator operator-(const difference_type offset) const noexcept
+		requires std::random_access_iterator<TInIterator>
 		{
-			++_inIterator;
-			return *this;
+			TransformIterator result = *this;
+			return result -= offset;
+		}
+
+		/// @brief
+		/// @param other
+		/// @return
+		difference_type operator-(const TransformIterator& other) const noexcept
+		requires std::random_access_iterator<TInIterator>
+		{
+			return _inIterator - other._inIterator;
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
-		bool operator!=(const WhereIterator& other) const noexcept
+		/// @brief
+		/// @param offset
+		/// @return
+		decltype(auto) operator[](const difference_type offset) const
+		requires std::random_access_iterator<TInIterator>
+		{
+			return *(*this + offset);
+		}
+
+		/// @brief
+		/// @param other
+		/// @return
+		auto operator<=>(const TransformIterator& other) const noexcept
+		requires std::random_access_iterator<TInIterator>
+		{
+			return _inIterator <=> other._inIterator;
+		}
+
+		/// @brief
+		/// @param other
+		/// @return
+		bool operator!=(const TransformIterator& other) const noexcept
 		{
 			return _inIterator != other._inIterator;
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
-		bool operator==(const WhereIterator& other) const noexcept
+		/// @brief
+		/// @param other
+		/// @return
+		bool operator==(const TransformIterator& other) const noexcept
 		{
 			return _inIterator == other._inIterator;
 		}
 	};
 
-	/// @brief 
-	/// @tparam TInIterator 
-	/// @tparam TPredicate 
-	template<Concepts::OptionalIter TInIterator,
-			 Concepts::IsPredicate<typename TInIterator::value_type> TPredicate>
-	struct RemoveWhereIterator final
+	/// @brief Stops only on elements for which the predicate returns EXPECTED,
+	/// so every element is read and tested once
+	/// @tparam TInIterator
+	/// @tparam TPredicate
+	/// @tparam EXPECTED
+	template<std::forward_iterator TInIterator,
+			 Concepts::IsPredicate<std::iter_value_t<TInIterator>> TPredicate,
+			 bool EXPECTED>
+	struct FilterIterator final
 	{
 	private:
 		TInIterator _inIterator;
-		TPredicate _predicate;
+		TInIterator _inEnd;
+		FunctionBox<TPredicate> _predicate;
+
+		void Satisfy() noexcept(std::is_nothrow_invocable_v<TPredicate, std::iter_reference_t<TInIterator>>)
+		{
+			while (_inIterator != _inEnd && static_cast<bool>(_predicate(*_inIterator)) != EXPECTED)
+				++_inIterator;
+		}
 
 	public:
-		/// @brief 
-		using value_type = TInIterator::value_type;
+		/// @brief
+		using value_type = std::iter_value_t<TInIterator>;
+
+		/// @brief
+		using difference_type = std::iter_difference_t<TInIterator>;
+
+		/// @brief
+		using iterator_concept = std::forward_iterator_tag;
 
-		/// @brief 
-		/// @param inIterator 
-		/// @param predicate 
-		RemoveWhereIterator(TInIterator inIterator, TPredicate&& predicate) noexcept :
+		/// @brief
+		using iterator_category = IteratorCategory<TInIterator, std::forward_iterator_tag>;
+
+		/// @brief
+		FilterIterator() = default;
+
+		/// @brief
+		/// @param inIterator
+		/// @param inEnd
+		/// @param predicate
+		FilterIterator(TInIterator inIterator, TInIterator inEnd, TPredicate&& predicate) :
 			_inIterator(inIterator),
-			_predicate(std::forward<TPredicate>(predicate)) {}
+			_inEnd(inEnd),
+			_predicate(std::forward<TPredicate>(predicate))
+		{
+			Satisfy();
+		}
 
-		/// @brief 
-		/// @param inIterator 
-		RemoveWhereIterator(TInIterator inIterator) noexcept :
-			_inIterator(inIterator) {}
+		/// @brief
+		/// @param inEnd
+		explicit FilterIterator(TInIterator inEnd) noexcept :
+			_inIterator(inEnd),
+			_inEnd(inEnd) {}
 
-		/// @brief 
-		/// @return 
-		std::optional<value_type> operator*() const 
-		noexcept(std::is_nothrow_invocable_v<TPredicate, typename TInIterator::value_type> &&
-				 std::is_nothrow_invocable_v<decltype(&TInIterator::operator*)>)
+		/// @brief
+		/// @return
+		std::iter_reference_t<TInIterator> operator*() const noexcept(noexcept(*_inIterator))
 		{
-			if ((*_inIterator).has_value() && !_predicate((*_inIterator).value()))
-				return (*_inIterator).value();
-			else
-				return std::nullopt;
+			return *_inIterator;
 		}
 
-		/// @brief 
-		/// @return 
-		RemoveWhereIterator& operator++() noexcept
+		/// @brief
+		/// @return
+		FilterIterator& operator++() noexcept(std::is_nothrow_invocable_v<TPredicate, std::iter_reference_t<TInIterator>>)
 		{
 			++_inIterator;
+			Satisfy();
 			return *this;
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
-		bool operator!=(const RemoveWhereIterator& other) const noexcept
+		/// @brief
+		/// @return
+		FilterIterator operator++(int) noexcept(std::is_nothrow_invocable_v<TPredicate, std::iter_reference_t<TInIterator>>)
+		{
+			FilterIterator copy = *this;
+			++*this;
+			return copy;
+		}
+
+		/// @brief
+		/// @param other
+		/// @return
+		bool operator!=(const FilterIterator& other) const noexcept
 		{
 			return _inIterator != other._inIterator;
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
-		bool operator==(const RemoveWhereIterator& other) const noexcept
+		/// @brief
+		/// @param other
+		/// @return
+		bool operator==(const FilterIterator& other) const noexcept
 		{
 			return _inIterator == other._inIterator;
 		}
 	};
 
-	/// @brief 
-	/// @tparam TResult 
-	/// @tparam TInIterator 
-	/// @tparam TOtherCollection 
-	/// @tparam TInnerKeySelector 
-	/// @tparam TOtherKeySelector 
-	/// @tparam TResultSelector 
-	template<Concepts::OptionalIter TInIterator,
+	/// @brief
+	/// @tparam TInIterator
+	/// @tparam TPredicate
+	template<std::forward_iterator TInIterator,
+			 Concepts::IsPredicate<std::iter_value_t<TInIterator>> TPredicate>
+	using WhereIterator = FilterIterator<TInIterator, TPredicate, true>;
+
+	/// @brief
+	/// @tparam TInIterator
+	/// @tparam TPredicate
+	template<std::forward_iterator TInIterator,
+			 Concepts::IsPredicate<std::iter_value_t<TInIterator>> TPredicate>
+	using RemoveWhereIterator = FilterIterator<TInIterator, TPredicate, false>;
+
+	/// @brief Nested loop join, stops only on pairs with equal keys
+	/// @tparam TResult
+	/// @tparam TInIterator
+	/// @tparam TOtherCollection
+	/// @tparam TInnerKeySelector
+	/// @tparam TOtherKeySelector
+	/// @tparam TResultSelector
+	template<std::forward_iterator TInIterator,
 			 Concepts::ConstIterable TOtherCollection,
-			 std::invocable<typename TInIterator::value_type> TInnerKeySelector,
+			 std::invocable<std::iter_value_t<TInIterator>> TInnerKeySelector,
 			 std::invocable<typename std::decay_t<TOtherCollection>::value_type> TOtherKeySelector,
-			 std::invocable<typename TInIterator::value_type,
+			 std::invocable<std::iter_value_t<TInIterator>,
 							typename std::decay_t<TOtherCollection>::value_type> TResultSelector,
 			 typename TResult = std::invoke_result_t<TResultSelector,
-													 typename TInIterator::value_type,
+													 std::iter_value_t<TInIterator>,
 													 typename std::decay_t<TOtherCollection>::value_type>,
-			 std::forward_iterator TOtherIterator = typename TOtherCollection::const_iterator>
-	requires std::same_as<std::invoke_result_t<TInnerKeySelector, typename TInIterator::value_type>,
+			 std::forward_iterator TOtherIterator = typename std::decay_t<TOtherCollection>::const_iterator>
+	requires std::same_as<std::invoke_result_t<TInnerKeySelector, std::iter_value_t<TInIterator>>,
 						  std::invoke_result_t<TOtherKeySelector, typename std::decay_t<TOtherCollection>::value_type>> &&
-			 Concepts::Equatable<std::invoke_result_t<TInnerKeySelector, typename TInIterator::value_type>>
+			 Concepts::Equatable<std::invoke_result_t<TInnerKeySelector, std::iter_value_t<TInIterator>>>
 	struct JoinIterator final
 	{
 	private:
 		TInIterator _inIterator;
+		TInIterator _inEnd;
 		TOtherIterator _otherBegin;
+		TOtherIterator _otherIterator;
 		TOtherIterator _otherEnd;
-		TInnerKeySelector _innerKeySelector;
-		TOtherKeySelector _otherKeySelector;
-		TResultSelector _resultSelector;
-		std::size_t _otherPosition = 0;
+		FunctionBox<TInnerKeySelector> _innerKeySelector;
+		FunctionBox<TOtherKeySelector> _otherKeySelector;
+		FunctionBox<TResultSelector> _resultSelector;
+
+		void Satisfy()
+		{
+			for (; _inIterator != _inEnd; ++_inIterator, _otherIterator = _otherBegin)
+			{
+				if (_otherIterator == _otherEnd)
+					continue;
+				const auto innerKey = _innerKeySelector(*_inIterator);
+				for (; _otherIterator != _otherEnd; ++_otherIterator)
+					if (innerKey == _otherKeySelector(*_otherIterator))
+						return;
+			}
+		}
 
 	public:
-		/// @brief 
-		using value_type = TResult;
-
-		/// @brief 
-		/// @param inIterator 
-		/// @param otherCollection 
-		/// @param innerKeySelector 
-		/// @param otherKeySelector 
-		/// @param resultSelector 
+		/// @brief
+		using value_type = std::remove_cvref_t<TResult>;
+
+		/// @brief
+		using difference_type = std::iter_difference_t<TInIterator>;
+
+		/// @brief
+		using iterator_concept = std::forward_iterator_tag;
+
+		/// @brief Legacy input iterator, like a SelectorIterator returning a value
+		using iterator_category = std::input_iterator_tag;
+
+		/// @brief
+		JoinIterator() = default;
+
+		/// @brief
+		/// @param inIterator
+		/// @param inEnd
+		/// @param otherCollection
+		/// @param innerKeySelector
+		/// @param otherKeySelector
+		/// @param resultSelector
 		JoinIterator(TInIterator inIterator,
+					 TInIterator inEnd,
 					 const TOtherCollection& otherCollection,
 					 TInnerKeySelector&& innerKeySelector,
 					 TOtherKeySelector&& otherKeySelector,
-					 TResultSelector&& resultSelector) noexcept :
+					 TResultSelector&& resultSelector) :
 			_inIterator(inIterator),
+			_inEnd(inEnd),
 			_otherBegin(otherCollection.cbegin()),
+			_otherIterator(otherCollection.cbegin()),
 			_otherEnd(otherCollection.cend()),
 			_innerKeySelector(std::forward<TInnerKeySelector>(innerKeySelector)),
 			_otherKeySelector(std::forward<TOtherKeySelector>(otherKeySelector)),
-			_resultSelector(std::forward<TResultSelector>(resultSelector)) {}
+			_resultSelector(std::forward<TResultSelector>(resultSelector))
+		{
+			Satisfy();
+		}
 
-		/// @brief 
-		/// @param inIterator 
-		JoinIterator(TInIterator inIterator) noexcept :
-			_inIterator(inIterator) {}
+		/// @brief
+		/// @param inEnd
+		explicit JoinIterator(TInIterator inEnd) noexcept :
+			_inIterator(inEnd),
+			_inEnd(inEnd) {}
 
-		/// @brief 
-		/// @return 
-		std::optional<value_type> operator*() const 
-		noexcept(std::is_nothrow_invocable_v<TInnerKeySelector, typename TInIterator::value_type> &&
-				 std::is_nothrow_invocable_v<TOtherKeySelector, typename std::decay_t<TOtherCollection>::value_type> &&
-				 std::is_nothrow_invocable_v<TResultSelector, typename TInIterator::value_type,
-											 typename std::decay_t<TOtherCollection>::value_type> && 
-				 std::is_nothrow_invocable_v<decltype(&TInIterator::operator*)>)
-		{
-			const auto& opt = *_inIterator;
-			if (!opt.has_value() || (_otherBegin + _otherPosition) == _otherEnd)
-				return std::nullopt;
-			if (_innerKeySelector(opt.value()) == _otherKeySelector(*(_otherBegin + _otherPosition)))
-				return _resultSelector(opt.value(), *(_otherBegin + _otherPosition));
-			else
-				return std::nullopt;
+		/// @brief
+		/// @return
+		TResult operator*() const
+		{
+			return _resultSelector(*_inIterator, *_otherIterator);
 		}
 
-		/// @brief 
-		/// @return 
-		JoinIterator& operator++() noexcept
+		/// @brief
+		/// @return
+		JoinIterator& operator++()
 		{
-			if ((_otherBegin + _otherPosition) != _otherEnd)
-				++_otherPosition;
-			if ((_otherBegin + _otherPosition) == _otherEnd)
-			{
-				_otherPosition = 0;
-				++_inIterator;
-				return *this;
-			}
-			else
-				return *this;
+			++_otherIterator;
+			for (; _otherIterator != _otherEnd; ++_otherIterator)
+				if (_innerKeySelector(*_inIterator) == _otherKeySelector(*_otherIterator))
+					return *this;
+
+			++_inIterator;
+			_otherIterator = _otherBegin;
+			Satisfy();
+			return *this;
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
+		/// @brief
+		/// @return
+		JoinIterator operator++(int)
+		{
+			JoinIterator copy = *this;
+			++*this;
+			return copy;
+		}
+
+		/// @brief
+		/// @param other
+		/// @return
 		bool operator!=(const JoinIterator& other) const noexcept
 		{
-			return _inIterator != other._inIterator;
+			return !(*this == other);
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
+		/// @brief The end iterator has no position in the other collection
+		/// @param other
+		/// @return
 		bool operator==(const JoinIterator& other) const noexcept
 		{
-			return _inIterator == other._inIterator;
+			return _inIterator == other._inIterator &&
+				   (_inIterator == _inEnd || other._inIterator == other._inEnd || _otherIterator == other._otherIterator);
 		}
 	};
 
-	/// @brief 
-	/// @tparam TLeft 
-	/// @tparam TRight 
-	/// @tparam TLeftIterator 
-	/// @tparam TOtherCollection 
-	template<Concepts::OptionalIter TLeftIterator,
+	/// @brief Ends with the shorter of the two sequences
+	/// @tparam TLeft
+	/// @tparam TRight
+	/// @tparam TLeftIterator
+	/// @tparam TOtherCollection
+	template<std::forward_iterator TLeftIterator,
 			 Concepts::ConstIterable TOtherCollection,
-			 typename TLeft = typename std::decay_t<TLeftIterator>::value_type,
+			 typename TLeft = std::iter_value_t<TLeftIterator>,
 			 typename TRight = typename std::decay_t<TOtherCollection>::value_type,
-			 std::forward_iterator TOtherIterator = typename TOtherCollection::const_iterator>
+			 std::forward_iterator TOtherIterator = typename std::decay_t<TOtherCollection>::const_iterator>
 	struct ZipIterator final
 	{
 	private:
 		TLeftIterator _leftIterator;
-		TOtherIterator _otherBegin;
+		TLeftIterator _leftEnd;
+		TOtherIterator _otherIterator;
 		TOtherIterator _otherEnd;
-		std::size_t _otherPosition = 0;
 
 	public:
-		/// @brief 
+		/// @brief
 		using value_type = std::pair<TLeft, TRight>;
 
-		/// @brief 
-		/// @param leftIterator 
-		/// @param otherCollection 
-		ZipIterator(TLeftIterator leftIterator, const TOtherCollection& otherCollection) noexcept :
-			_leftIterator(leftIterator), 
-			_otherBegin(otherCollection.cbegin()),
-			_otherEnd(otherCollection.cend()) {}
+		/// @brief
+		using difference_type = std::iter_difference_t<TLeftIterator>;
+
+		/// @brief
+		using iterator_concept = std::forward_iterator_tag;
 
-		/// @brief 
-		/// @param leftIterator 
-		ZipIterator(TLeftIterator leftIterator) noexcept :
-			_leftIterator(leftIterator) {}
+		/// @brief Legacy input iterator, like a SelectorIterator returning a value
+		using iterator_category = std::input_iterator_tag;
 
-		/// @brief 
-		/// @return 
-		std::optional<value_type> operator*() const 
-		noexcept(std::is_nothrow_invocable_v<decltype(&TLeftIterator::operator*)> &&
-				 std::is_nothrow_invocable_v<decltype(&std::decay_t<TOtherCollection>::const_iterator::operator*)>)
+		/// @brief
+		ZipIterator() = default;
+
+		/// @brief
+		/// @param leftIterator
+		/// @param leftEnd
+		/// @param otherCollection
+		ZipIterator(TLeftIterator leftIterator, TLeftIterator leftEnd, const TOtherCollection& otherCollection) noexcept :
+			_leftIterator(leftIterator),
+			_leftEnd(leftEnd),
+			_otherIterator(otherCollection.cbegin()),
+			_otherEnd(otherCollection.cend())
 		{
-			if ((*_leftIterator).has_value() && _otherBegin + _otherPosition != _otherEnd)
-				return std::make_pair((*_leftIterator).value(), *(_otherBegin + _otherPosition));
-			else
-				return std::nullopt;
+			if (_otherIterator == _otherEnd)
+				_leftIterator = _leftEnd;
+		}
+
+		/// @brief
+		/// @param leftEnd
+		explicit ZipIterator(TLeftIterator leftEnd) noexcept :
+			_leftIterator(leftEnd),
+			_leftEnd(leftEnd) {}
+
+		/// @brief
+		/// @return
+		value_type operator*() const
+		noexcept(std::is_nothrow_copy_constructible_v<TLeft> && std::is_nothrow_copy_constructible_v<TRight>)
+		{
+			return value_type(*_leftIterator, *_otherIterator);
 		}
 
-		/// @brief 
-		/// @return 
+		/// @brief
+		/// @return
 		ZipIterator& operator++() noexcept
 		{
 			++_leftIterator;
-			++_otherPosition;
+			if (++_otherIterator == _otherEnd)
+				_leftIterator = _leftEnd;
 			return *this;
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
+		/// @brief
+		/// @return
+		ZipIterator operator++(int) noexcept
+		{
+			ZipIterator copy = *this;
+			++*this;
+			return copy;
+		}
+
+		/// @brief
+		/// @param other
+		/// @return
 		bool operator!=(const ZipIterator& other) const noexcept
 		{
 			return _leftIterator != other._leftIterator;
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
+		/// @brief
+		/// @param other
+		/// @return
 		bool operator==(const ZipIterator& other) const noexcept
 		{
 			return _leftIterator == other._leftIterator;
 		}
 	};
 
-	/// @brief 
-	/// @tparam TInIterator 
-	template<Concepts::OptionalIter TInIterator>
+	/// @brief Skips the first elements on the first access to the iterator, not when the view is created.
+	/// A copy taken before the first access skips them again
+	/// @tparam TInIterator
+	template<std::forward_iterator TInIterator>
 	struct SkipIterator final
 	{
 	private:
-		TInIterator _inIterator;
+		mutable TInIterator _inIterator;
+		TInIterator _inEnd;
 		mutable std::size_t _count = 0;
 
+		void Start() const noexcept
+		{
+			if (_count == 0)
+				return;
+
+			_inIterator = std::ranges::next(_inIterator, static_cast<std::iter_difference_t<TInIterator>>(_count), _inEnd);
+			_count = 0;
+		}
+
 	public:
-		/// @brief 
-		using value_type = TInIterator::value_type;
+		/// @brief
+		using value_type = std::iter_value_t<TInIterator>;
 
-		/// @brief 
-		/// @param inIterator 
-		/// @param count 
-		SkipIterator(TInIterator inIterator, std::size_t count) noexcept :
+		/// @brief
+		using difference_type = std::iter_difference_t<TInIterator>;
+
+		/// @brief
+		using iterator_concept = std::forward_iterator_tag;
+
+		/// @brief
+		using iterator_category = IteratorCategory<TInIterator, std::forward_iterator_tag>;
+
+		/// @brief
+		SkipIterator() = default;
+
+		/// @brief
+		/// @param inIterator
+		/// @param inEnd
+		/// @param count
+		SkipIterator(TInIterator inIterator, TInIterator inEnd, const std::size_t count) noexcept :
 			_inIterator(inIterator),
+			_inEnd(inEnd),
 			_count(count) {}
 
-		/// @brief 
-		/// @param inIterator 
-		/// @param count 
-		SkipIterator(TInIterator inIterator) noexcept :
-			_inIterator(inIterator) {}
+		/// @brief
+		/// @param inEnd
+		explicit SkipIterator(TInIterator inEnd) noexcept :
+			_inIterator(inEnd),
+			_inEnd(inEnd) {}
 
-		/// @brief 
-		/// @return 
-		std::optional<value_type> operator*() const
-		noexcept(std::is_nothrow_invocable_v<decltype(&TInIterator::operator*)>)
+		/// @brief
+		/// @return
+		std::iter_reference_t<TInIterator> operator*() const noexcept(noexcept(*_inIterator))
 		{
-			if (!(*_inIterator).has_value())
-				return std::nullopt;
-
-			if (_count)
-			{
-				--_count;
-				return std::nullopt;
-			}
-			
-			return (*_inIterator).value();
+			Start();
+			return *_inIterator;
 		}
 
-		/// @brief 
-		/// @return 
+		/// @brief
+		/// @return
 		SkipIterator& operator++() noexcept
 		{
+			Start();
 			++_inIterator;
 			return *this;
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
+		/// @brief
+		/// @return
+		SkipIterator operator++(int) noexcept
+		{
+			SkipIterator copy = *this;
+			++*this;
+			return copy;
+		}
+
+		/// @brief
+		/// @param other
+		/// @return
 		bool operator!=(const SkipIterator& other) const noexcept
 		{
-			return _inIterator != other._inIterator;
+			return !(*this == other);
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
+		/// @brief
+		/// @param other
+		/// @return
 		bool operator==(const SkipIterator& other) const noexcept
 		{
+			Start();
+			other.Start();
 			return _inIterator == other._inIterator;
 		}
 	};
 
-	/// @brief 
-	/// @tparam TInIterator 
-	/// @tparam TPredicate 
-	template<Concepts::OptionalIter TInIterator,
-			 Concepts::IsPredicate<typename TInIterator::value_type> TPredicate>
+	/// @brief Skips the elements satisfying the predicate on the first access to the iterator,
+	/// not when the view is created. A copy taken before the first access tests them again
+	/// @tparam TInIterator
+	/// @tparam TPredicate
+	template<std::forward_iterator TInIterator,
+			 Concepts::IsPredicate<std::iter_value_t<TInIterator>> TPredicate>
 	struct SkipWhileIterator final
 	{
 	private:
-		TInIterator _inIterator;
-		TPredicate _predicate;
-		mutable bool _predicateFailed = false;
+		mutable TInIterator _inIterator;
+		TInIterator _inEnd;
+		FunctionBox<TPredicate> _predicate;
+		mutable bool _started = true;
+
+		void Start() const noexcept(std::is_nothrow_invocable_v<TPredicate, std::iter_reference_t<TInIterator>>)
+		{
+			if (_started)
+				return;
+
+			while (_inIterator != _inEnd && _predicate(*_inIterator))
+				++_inIterator;
+			_started = true;
+		}
 
 	public:
-		/// @brief 
-		using value_type = TInIterator::value_type;
+		/// @brief
+		using value_type = std::iter_value_t<TInIterator>;
 
-		/// @brief 
-		/// @param inIterator 
-		/// @param predicate 
-		SkipWhileIterator(TInIterator inIterator, TPredicate&& predicate) noexcept :
-			_inIterator(inIterator),
-			_predicate(std::forward<TPredicate>(predicate)) {}
+		/// @brief
+		using difference_type = std::iter_difference_t<TInIterator>;
 
-		/// @brief 
-		/// @param inIterator
-		SkipWhileIterator(TInIterator inIterator) noexcept :
-			_inIterator(inIterator) {}
+		/// @brief
+		using iterator_concept = std::forward_iterator_tag;
 
-		/// @brief 
-		/// @return 
-		std::optional<value_type> operator*() const
-		noexcept(std::is_nothrow_invocable_v<decltype(&TInIterator::operator*)> &&
-				 std::is_nothrow_invocable_v<TPredicate, value_type>)
-		{
-			if (!(*_inIterator).has_value())
-				return std::nullopt;
-			else if (_predicateFailed)
-				return (*_inIterator).value();
+		/// @brief
+		using iterator_category = IteratorCategory<TInIterator, std::forward_iterator_tag>;
 
-			if (_predicate((*_inIterator).value()))
-				return std::nullopt;
-			else
-			{
-				_predicateFailed = true;
-				return (*_inIterator).value();
-			}
+		/// @brief
+		SkipWhileIterator() = default;
+
+		/// @brief
+		/// @param inIterator
+		/// @param inEnd
+		/// @param predicate
+		SkipWhileIterator(TInIterator inIterator, TInIterator inEnd, TPredicate&& predicate) :
+			_inIterator(inIterator),
+			_inEnd(inEnd),
+			_predicate(std::forward<TPredicate>(predicate)),
+			_started(false) {}
+
+		/// @brief
+		/// @param inEnd
+		explicit SkipWhileIterator(TInIterator inEnd) noexcept :
+			_inIterator(inEnd),
+			_inEnd(inEnd) {}
+
+		/// @brief
+		/// @return
+		std::iter_reference_t<TInIterator> operator*() const
+		noexcept(noexcept(*_inIterator) && std::is_nothrow_invocable_v<TPredicate, std::iter_reference_t<TInIterator>>)
+		{
+			Start();
+			return *_inIterator;
 		}
 
-		/// @brief 
-		/// @return 
-		SkipWhileIterator& operator++() noexcept
+		/// @brief
+		/// @return
+		SkipWhileIterator& operator++() noexcept(std::is_nothrow_invocable_v<TPredicate, std::iter_reference_t<TInIterator>>)
 		{
+			Start();
 			++_inIterator;
 			return *this;
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
-		bool operator!=(const SkipWhileIterator& other) const noexcept
+		/// @brief
+		/// @return
+		SkipWhileIterator operator++(int) noexcept(std::is_nothrow_invocable_v<TPredicate, std::iter_reference_t<TInIterator>>)
 		{
-			return _inIterator != other._inIterator;
+			SkipWhileIterator copy = *this;
+			++*this;
+			return copy;
+		}
+
+		/// @brief
+		/// @param other
+		/// @return
+		bool operator!=(const SkipWhileIterator& other) const
+		noexcept(std::is_nothrow_invocable_v<TPredicate, std::iter_reference_t<TInIterator>>)
+		{
+			return !(*this == other);
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
-		bool operator==(const SkipWhileIterator& other) const noexcept
+		/// @brief
+		/// @param other
+		/// @return
+		bool operator==(const SkipWhileIterator& other) const
+		noexcept(std::is_nothrow_invocable_v<TPredicate, std::iter_reference_t<TInIterator>>)
 		{
+			Start();
+			other.Start();
 			return _inIterator == other._inIterator;
 		}
 	};
 
-	/// @brief 
-	/// @tparam TInIterator 
-	template<Concepts::OptionalIter TInIterator>
+	/// @brief Jumps to the end after the last taken element
+	/// @tparam TInIterator
+	template<std::forward_iterator TInIterator>
 	struct TakeIterator final
 	{
 	private:
 		TInIterator _inIterator;
-		mutable std::size_t _count = 0;
+		TInIterator _inEnd;
+		std::size_t _count = 0;
 
 	public:
-		/// @brief 
-		using value_type = TInIterator::value_type;
+		/// @brief
+		using value_type = std::iter_value_t<TInIterator>;
 
-		/// @brief 
-		/// @param inIterator 
-		/// @param count 
-		TakeIterator(TInIterator inIterator, std::size_t count) noexcept :
-			_inIterator(inIterator),
+		/// @brief
+		using difference_type = std::iter_difference_t<TInIterator>;
+
+		/// @brief
+		using iterator_concept = std::forward_iterator_tag;
+
+		/// @brief
+		using iterator_category = IteratorCategory<TInIterator, std::forward_iterator_tag>;
+
+		/// @brief
+		TakeIterator() = default;
+
+		/// @brief
+		/// @param inIterator
+		/// @param inEnd
+		/// @param count
+		TakeIterator(TInIterator inIterator, TInIterator inEnd, const std::size_t count) noexcept :
+			_inIterator(count == 0 ? inEnd : inIterator),
+			_inEnd(inEnd),
 			_count(count) {}
 
-		/// @brief 
-		/// @param inIterator 
-		TakeIterator(TInIterator inIterator) noexcept :
-			_inIterator(inIterator) {}
+		/// @brief
+		/// @param inEnd
+		explicit TakeIterator(TInIterator inEnd) noexcept :
+			_inIterator(inEnd),
+			_inEnd(inEnd) {}
 
-		/// @brief 
-		/// @return 
-		std::optional<value_type> operator*() const
-		noexcept(std::is_nothrow_invocable_v<decltype(&TInIterator::operator*)>)
+		/// @brief
+		/// @return
+		std::iter_reference_t<TInIterator> operator*() const noexcept(noexcept(*_inIterator))
 		{
-			if (!(*_inIterator).has_value())
-				return std::nullopt;
-
-			if (_count)
-			{
-				--_count;
-				return (*_inIterator).value();
-			}
-			return std::nullopt;
+			return *_inIterator;
 		}
 
-		/// @brief 
-		/// @return 
+		/// @brief
+		/// @return
 		TakeIterator& operator++() noexcept
 		{
-			++_inIterator;
+			if (--_count == 0)
+				_inIterator = _inEnd;
+			else
+				++_inIterator;
 			return *this;
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
+		/// @brief
+		/// @return
+		TakeIterator operator++(int) noexcept
+		{
+			TakeIterator copy = *this;
+			++*this;
+			return copy;
+		}
+
+		/// @brief
+		/// @param other
+		/// @return
 		bool operator!=(const TakeIterator& other) const noexcept
 		{
 			return _inIterator != other._inIterator;
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
+		/// @brief
+		/// @param other
+		/// @return
 		bool operator==(const TakeIterator& other) const noexcept
 		{
 			return _inIterator == other._inIterator;
 		}
 	};
 
-	/// @brief 
-	/// @tparam TInIterator 
-	/// @tparam TPredicate 
-	template<Concepts::OptionalIter TInIterator,
-			 Concepts::IsPredicate<typename TInIterator::value_type> TPredicate>
+	/// @brief Jumps to the end at the first element that does not satisfy the predicate
+	/// @tparam TInIterator
+	/// @tparam TPredicate
+	template<std::forward_iterator TInIterator,
+			 Concepts::IsPredicate<std::iter_value_t<TInIterator>> TPredicate>
 	struct TakeWhileIterator final
 	{
 	private:
 		TInIterator _inIterator;
-		TPredicate _predicate;
-		mutable bool _predicateFailed = false;
+		TInIterator _inEnd;
+		FunctionBox<TPredicate> _predicate;
+
+		void Satisfy() noexcept(std::is_nothrow_invocable_v<TPredicate, std::iter_reference_t<TInIterator>>)
+		{
+			if (_inIterator != _inEnd && !_predicate(*_inIterator))
+				_inIterator = _inEnd;
+		}
 
 	public:
-		/// @brief 
-		using value_type = TInIterator::value_type;
+		/// @brief
+		using value_type = std::iter_value_t<TInIterator>;
 
-		/// @brief 
-		/// @param inIterator 
-		/// @param predicate 
-		TakeWhileIterator(TInIterator inIterator, TPredicate&& predicate) noexcept :
-			_inIterator(inIterator),
-			_predicate(std::forward<TPredicate>(predicate)) {}
+		/// @brief
+		using difference_type = std::iter_difference_t<TInIterator>;
 
-		/// @brief 
-		/// @param inIterator 
-		TakeWhileIterator(TInIterator inIterator) noexcept :
-			_inIterator(inIterator) {}
+		/// @brief
+		using iterator_concept = std::forward_iterator_tag;
+
+		/// @brief
+		using iterator_category = IteratorCategory<TInIterator, std::forward_iterator_tag>;
 
-		/// @brief 
-		/// @return 
-		std::optional<value_type> operator*() const
-		noexcept(std::is_nothrow_invocable_v<decltype(&TInIterator::operator*)> &&
-				 std::is_nothrow_invocable_v<TPredicate, value_type>)
+		/// @brief
+		TakeWhileIterator() = default;
+
+		/// @brief
+		/// @param inIterator
+		/// @param inEnd
+		/// @param predicate
+		TakeWhileIterator(TInIterator inIterator, TInIterator inEnd, TPredicate&& predicate) :
+			_inIterator(inIterator),
+			_inEnd(inEnd),
+			_predicate(std::forward<TPredicate>(predicate))
 		{
-			if (!(*_inIterator).has_value() || _predicateFailed)
-				return std::nullopt;
+			Satisfy();
+		}
+
+		/// @brief
+		/// @param inEnd
+		explicit TakeWhileIterator(TInIterator inEnd) noexcept :
+			_inIterator(inEnd),
+			_inEnd(inEnd) {}
 
-			if (_predicate((*_inIterator).value()))
-				return (*_inIterator).value();
-			
-			_predicateFailed = true;
-			return std::nullopt;
+		/// @brief
+		/// @return
+		std::iter_reference_t<TInIterator> operator*() const noexcept(noexcept(*_inIterator))
+		{
+			return *_inIterator;
 		}
 
-		/// @brief 
-		/// @return 
-		TakeWhileIterator& operator++() noexcept
+		/// @brief
+		/// @return
+		TakeWhileIterator& operator++() noexcept(std::is_nothrow_invocable_v<TPredicate, std::iter_reference_t<TInIterator>>)
 		{
 			++_inIterator;
+			Satisfy();
 			return *this;
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
+		/// @brief
+		/// @return
+		TakeWhileIterator operator++(int) noexcept(std::is_nothrow_invocable_v<TPredicate, std::iter_reference_t<TInIterator>>)
+		{
+			TakeWhileIterator copy = *this;
+			++*this;
+			return copy;
+		}
+
+		/// @brief
+		/// @param other
+		/// @return
 		bool operator!=(const TakeWhileIterator& other) const noexcept
 		{
 			return _inIterator != other._inIterator;
 		}
 
-		/// @brief 
-		/// @param other 
-		/// @return 
+		/// @brief
+		/// @param other
+		/// @return
 		bool operator==(const TakeWhileIterator& other) const noexcept
 		{
 			return _inIterator == other._inIterator;
 		}
 	};
+
+	/// @brief Range of consecutive source elements: span over contiguous storage, subrange otherwise
+	/// @tparam TInIterator
+	template<std::forward_iterator TInIterator>
+	using WindowRange = std::conditional_t<std::contiguous_iterator<TInIterator>,
+		std::span<std::remove_reference_t<std::iter_reference_t<TInIterator>>>,
+		std::ranges::subrange<TInIterator>>;
+
+	/// @brief Gives ranges of size elements over the source without copying them, each next range starts step elements
+	/// after the previous one. With partial the last range may be shorter, otherwise only full ranges are given
+	/// @tparam TInIterator
+	template<std::forward_iterator TInIterator>
+	struct WindowIterator final
+	{
+	private:
+		TInIterator _inIterator;
+		TInIterator _windowEnd;
+		TInIterator _inEnd;
+		std::size_t _size = 0;
+		std::size_t _step = 0;
+		bool _partial = false;
+
+		void FindWindowEnd() noexcept
+		{
+			_windowEnd = _inIterator;
+			const auto missing = std::ranges::advance(_windowEnd, static_cast<std::iter_difference_t<TInIterator>>(_size), _inEnd);
+			if (missing != 0 && !_partial)
+				_inIterator = _windowEnd = _inEnd;
+		}
+
+	public:
+		/// @brief
+		using value_type = WindowRange<TInIterator>;
+
+		/// @brief
+		using difference_type = std::iter_difference_t<TInIterator>;
+
+		/// @brief
+		using iterator_concept = std::forward_iterator_tag;
+
+		/// @brief Windows are returned by value, see SelectorIterator
+		using iterator_category = std::input_iterator_tag;
+
+		/// @brief
+		WindowIterator() = default;
+
+		/// @brief
+		/// @param inIterator
+		/// @param inEnd
+		/// @param size
+		/// @param step
+		/// @param partial
+		WindowIterator(TInIterator inIterator, TInIterator inEnd, const std::size_t size, const std::size_t step,
+					   const bool partial) noexcept :
+			_inIterator(inIterator),
+			_inEnd(inEnd),
+			_size(size),
+			_step(step),
+			_partial(partial)
+		{
+			FindWindowEnd();
+		}
+
+		/// @brief
+		/// @param inEnd
+		explicit WindowIterator(TInIterator inEnd) noexcept :
+			_inIterator(inEnd),
+			_windowEnd(inEnd),
+			_inEnd(inEnd) {}
+
+		/// @brief
+		/// @return
+		value_type operator*() const noexcept
+		{
+			if constexpr (std::contiguous_iterator<TInIterator>)
+				return value_type(std::to_address(_inIterator), static_cast<std::size_t>(_windowEnd - _inIterator));
+			else
+				return value_type(_inIterator, _windowEnd);
+		}
+
+		/// @brief
+		/// @return
+		WindowIterator& operator++() noexcept
+		{
+			if (_step == _size)
+				_inIterator = _windowEnd;
+			else
+				std::ranges::advance(_inIterator, static_cast<std::iter_difference_t<TInIterator>>(_step), _inEnd);
+
+			if (_inIterator == _inEnd)
+				_windowEnd = _inEnd;
+			else
+				FindWindowEnd();
+			return *this;
+		}
+
+		/// @brief
+		/// @return
+		WindowIterator operator++(int) noexcept
+		{
+			WindowIterator copy = *this;
+			++*this;
+			return copy;
+		}
+
+		/// @brief
+		/// @param other
+		/// @return
+		bool operator!=(const WindowIterator& other) const noexcept
+		{
+			return _inIterator != other._inIterator;
+		}
+
+		/// @brief
+		/// @param other
+		/// @return
+		bool operator==(const WindowIterator& other) const noexcept
+		{
+			return _inIterator == other._inIterator;
+		}
+	};
 }
 
-#endif
\ No newline at end of file
+#endif
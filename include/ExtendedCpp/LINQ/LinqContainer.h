@@ -18,39 +18,49 @@
 #include <concepts>
 #include <utility>
 #include <locale>
+#include <span>
+#include <algorithm>
+#include <numeric>
 
 #include <ExtendedCpp/LINQ/Algorithm.h>
 #include <ExtendedCpp/LINQ/Sort.h>
 #include <ExtendedCpp/LINQ/Concepts.h>
 #include <ExtendedCpp/LINQ/TypeTraits.h>
 #include <ExtendedCpp/LINQ/OrderType.h>
+#include <ExtendedCpp/LINQ/Parallel.h>
+#include <ExtendedCpp/LINQ/CowVector.h>
+#include <ExtendedCpp/LINQ/BloomFilter.h>
+#include <ExtendedCpp/LINQ/SummationType.h>
 
 /// @brief 
 namespace ExtendedCpp::LINQ
 {
-    /// @brief Owning thread-safe container
+    /// @brief Container, which owns its elements or borrows contiguous storage of the caller
+    /// until the first mutable access. Copies share elements until one of them is changed, iterators and pointers
+    /// follow the invalidation rules of CowVector. Different containers may be used from different threads,
+    /// one container may not be changed concurrently with any other access to it
     /// @tparam TSource any copyable type
     template<std::copyable TSource>
     class LinqContainer final
     {
     private:
-        std::vector<TSource> _collection;
+        CowVector<TSource> _collection;
 
     public:
         /// @brief 
         using value_type = TSource;
 
         /// @brief 
-        using iterator = std::vector<TSource>::iterator;
+        using iterator = CowVector<TSource>::iterator;
 
         /// @brief 
-        using const_iterator = std::vector<TSource>::const_iterator;
+        using const_iterator = CowVector<TSource>::const_iterator;
 
         /// @brief 
-        using reverse_iterator = std::vector<TSource>::reverse_iterator;
+        using reverse_iterator = CowVector<TSource>::reverse_iterator;
 
         /// @brief 
-        using const_reverse_iterator = std::vector<TSource>::const_reverse_iterator;
+        using const_reverse_iterator = CowVector<TSource>::const_reverse_iterator;
 
         /// @brief Copy data from vector into LINQ conainer
         /// @param collection 
@@ -66,18 +76,28 @@ namespace ExtendedCpp::LINQ
             _collection = std::move(collection);
         }
 
-        /// @brief Copy constructor
+        /// @brief Move data from vector into LINQ conainer, the next containers are allocated from its memory resource
+        /// @param collection 
+        explicit LinqContainer(std::pmr::vector<TSource>&& collection) noexcept :
+            _collection(std::move(collection)) {}
+
+        /// @brief Borrow contiguous storage, which must outlive the container and every copy of it
+        /// @param storage 
+        explicit LinqContainer(const std::span<const TSource> storage) noexcept :
+            _collection(storage) {}
+
+        /// @brief Copy constructor, a borrowing container stays borrowing
         /// @param container 
         LinqContainer(const LinqContainer& container) noexcept
         {
-            _collection = container.ToVector();
+            _collection = container._collection;
         }
 
         /// @brief Move constructor
         /// @param container 
         LinqContainer(LinqContainer&& container) noexcept
         {
-            _collection = std::move(container.ToVector());
+            _collection = std::move(container._collection);
         }
 
         /// @brief Default destructor
@@ -107,7 +127,7 @@ namespace ExtendedCpp::LINQ
         LinqContainer& operator=(const LinqContainer& container) noexcept
         {
             if (this == &container) return *this;
-            _collection = container.ToVector();
+            _collection = container._collection;
             return *this;
         }
 
@@ -116,7 +136,7 @@ namespace ExtendedCpp::LINQ
         /// @return 
         LinqContainer& operator=(LinqContainer&& container) noexcept
         {
-            _collection = std::move(container.ToVector());
+            _collection = std::move(container._collection);
             return *this;
         }
 
@@ -136,9 +156,17 @@ namespace ExtendedCpp::LINQ
             return _collection.empty();
         }
 
-        /// @brief Get iterator of implemented vector<T>
+        /// @brief Check whether elements are read from the storage of the caller
+        /// @return true until the first mutable access to a container created by Borrow
+        [[nodiscard]]
+        bool IsBorrowed() const noexcept
+        {
+            return _collection.IsBorrowed();
+        }
+
+        /// @brief Get iterator of implemented vector<T>, borrowed storage is copied first
         /// @return Random access iterator
-        iterator begin() noexcept
+        iterator begin()
         {
             return _collection.begin();
         }
@@ -150,9 +178,9 @@ namespace ExtendedCpp::LINQ
             return _collection.cbegin();
         }
 
-        /// @brief Get iterator of implemented vector<T>
+        /// @brief Get iterator of implemented vector<T>, borrowed storage is copied first
         /// @return Random access iterator
-        iterator end() noexcept
+        iterator end()
         {
             return _collection.end();
         }
@@ -178,9 +206,9 @@ namespace ExtendedCpp::LINQ
             return _collection.cend();
         }
 
-        /// @brief Get iterator of implemented vector<T>
+        /// @brief Get iterator of implemented vector<T>, borrowed storage is copied first
         /// @return Random access iterator
-        reverse_iterator rbegin() noexcept
+        reverse_iterator rbegin()
         {
             return _collection.rbegin();
         }
@@ -192,9 +220,9 @@ namespace ExtendedCpp::LINQ
             return _collection.crbegin();
         }
 
-        /// @brief Get iterator of implemented vector<T>
+        /// @brief Get iterator of implemented vector<T>, borrowed storage is copied first
         /// @return Random access iterator
-        reverse_iterator rend() noexcept
+        reverse_iterator rend()
         {
             return _collection.rend();
         }
@@ -220,9 +248,9 @@ namespace ExtendedCpp::LINQ
             return _collection.crend();
         }
 
-        /// @brief Get pointer to first element of container data
+        /// @brief Get pointer to first element of container data, borrowed storage is copied first
         /// @return Pointer to first element
-        TSource* data() noexcept
+        TSource* data()
         {
             return _collection.data();
         }
@@ -238,7 +266,7 @@ namespace ExtendedCpp::LINQ
         /// @return Copy of implemented vector<T>
         std::vector<TSource> ToVector() const noexcept
         {
-            return _collection;
+            return _collection.ToVector();
         }
 
         /// @brief Get copy of collection data
@@ -361,10 +389,10 @@ namespace ExtendedCpp::LINQ
         /// @return 
         template<std::invocable<TSource> TMap>
         requires std::same_as<std::invoke_result_t<TMap, TSource>, TSource>
-        LinqContainer Map(TMap&& mapFunction) const
+        LinqContainer Map(TMap&& mapFunction) const&
         noexcept(std::is_nothrow_invocable_v<TMap, TSource>)
         {
-            std::vector<TSource> newCollection;
+            std::pmr::vector<TSource> newCollection(_collection.Resource());
             newCollection.reserve(_collection.size());
 
             for (const TSource& element : _collection)
@@ -373,16 +401,33 @@ namespace ExtendedCpp::LINQ
             return LinqContainer(std::move(newCollection));
         }
 
+        /// @brief Maps the elements in place, reusing the storage of the expiring container
+        /// @tparam TMap 
+        /// @param mapFunction 
+        /// @return 
+        template<std::invocable<TSource> TMap>
+        requires std::same_as<std::invoke_result_t<TMap, TSource>, TSource>
+        LinqContainer Map(TMap&& mapFunction) &&
+        noexcept(std::is_nothrow_invocable_v<TMap, TSource>)
+        {
+            _collection.Modify([&](auto& newCollection)
+            {
+                for (TSource& element : newCollection)
+                    element = mapFunction(std::move(element));
+            });
+            return LinqContainer(std::move(_collection));
+        }
+
         /// @brief Applies an action to each item in the collection
         /// @tparam TTransform Any functional object with TSource argument
         /// @param transform Any functional object with TSource argument
         /// @return New collection LinqContainer<TSource>
         template<std::invocable<TSource&> TTransform>
         requires std::same_as<std::invoke_result_t<TTransform, TSource&>, void>
-        LinqContainer Transform(TTransform&& transform) const
+        LinqContainer Transform(TTransform&& transform) const&
         noexcept(std::is_nothrow_invocable_v<TTransform, TSource&>)
         {
-            std::vector<TSource> newCollection(_collection);
+            std::pmr::vector<TSource> newCollection(_collection.cbegin(), _collection.cend(), _collection.Resource());
 
             for (TSource& element : newCollection)
                 transform(element);
@@ -390,6 +435,23 @@ namespace ExtendedCpp::LINQ
             return LinqContainer(std::move(newCollection));
         }
 
+        /// @brief Applies an action to each item in place, reusing the storage of the expiring container
+        /// @tparam TTransform Any functional object with TSource argument
+        /// @param transform Any functional object with TSource argument
+        /// @return New collection LinqContainer<TSource>
+        template<std::invocable<TSource&> TTransform>
+        requires std::same_as<std::invoke_result_t<TTransform, TSource&>, void>
+        LinqContainer Transform(TTransform&& transform) &&
+        noexcept(std::is_nothrow_invocable_v<TTransform, TSource&>)
+        {
+            _collection.Modify([&](auto& newCollection)
+            {
+                for (TSource& element : newCollection)
+                    transform(element);
+            });
+            return LinqContainer(std::move(_collection));
+        }
+
         /// @brief Iterates through all elements and applies a selector to each
         /// @tparam TResult Result of selector invoke
         /// @tparam TSelector Any functional object with TSource argument
@@ -400,7 +462,7 @@ namespace ExtendedCpp::LINQ
         LinqContainer<TResult> Select(TSelector&& selector) const 
         noexcept(std::is_nothrow_invocable_v<TSelector, TSource>)
         {
-            std::vector<TResult> newCollection;
+            std::pmr::vector<TResult> newCollection(_collection.Resource());
             newCollection.reserve(_collection.size());
 
             for (const TSource& element : _collection)
@@ -419,7 +481,7 @@ namespace ExtendedCpp::LINQ
         LinqContainer<TResult> SelectMany(TSelector&& selector) const 
         noexcept(std::is_nothrow_invocable_v<TSelector, TSource>)
         {
-            std::vector<TResult> newCollection;
+            std::pmr::vector<TResult> newCollection(_collection.Resource());
 
             for (const TSource& element : _collection)
             {
@@ -449,7 +511,7 @@ namespace ExtendedCpp::LINQ
         noexcept(std::is_nothrow_invocable_v<TCollectionSelector, TSource> &&
                  std::is_nothrow_invocable_v<TCollectionSelector, TSource, TCollectionValueType>)
         {
-            std::vector<TResult> newCollection;
+            std::pmr::vector<TResult> newCollection(_collection.Resource());
 
             for (const TSource& element : _collection)
             {
@@ -467,9 +529,9 @@ namespace ExtendedCpp::LINQ
         /// @return 
         template<Concepts::IsPredicate<TSource> TPredicate>
         LinqContainer Where(TPredicate&& predicate)
-        const noexcept(std::is_nothrow_invocable_v<TPredicate, TSource>)
+        const& noexcept(std::is_nothrow_invocable_v<TPredicate, TSource>)
         {
-            std::vector<TSource> newCollection;
+            std::pmr::vector<TSource> newCollection(_collection.Resource());
 
             for (const TSource& element : _collection)
                 if (predicate(element))
@@ -478,15 +540,30 @@ namespace ExtendedCpp::LINQ
             return LinqContainer(std::move(newCollection));
         }
 
+        /// @brief Select elements by condition, compacting the storage of the expiring container
+        /// @tparam TPredicate 
+        /// @param predicate 
+        /// @return 
+        template<Concepts::IsPredicate<TSource> TPredicate>
+        LinqContainer Where(TPredicate&& predicate)
+        && noexcept(std::is_nothrow_invocable_v<TPredicate, TSource>)
+        {
+            _collection.Modify([&](auto& newCollection)
+            {
+                std::erase_if(newCollection, [&predicate](const TSource& element) { return !predicate(element); });
+            });
+            return LinqContainer(std::move(_collection));
+        }
+
         /// @brief Remove elements from some set by condition
         /// @tparam TPredicate 
         /// @param predicate 
         /// @return 
         template<Concepts::IsPredicate<TSource> TPredicate>
         LinqContainer RemoveWhere(TPredicate&& predicate)
-        const noexcept(std::is_nothrow_invocable_v<TPredicate, TSource>)
+        const& noexcept(std::is_nothrow_invocable_v<TPredicate, TSource>)
         {
-            std::vector<TSource> newCollection;
+            std::pmr::vector<TSource> newCollection(_collection.Resource());
 
             for (const TSource& element : _collection)
             {
@@ -498,44 +575,318 @@ namespace ExtendedCpp::LINQ
             return LinqContainer(std::move(newCollection));
         }
 
+        /// @brief Remove elements by condition, compacting the storage of the expiring container
+        /// @tparam TPredicate 
+        /// @param predicate 
+        /// @return 
+        template<Concepts::IsPredicate<TSource> TPredicate>
+        LinqContainer RemoveWhere(TPredicate&& predicate)
+        && noexcept(std::is_nothrow_invocable_v<TPredicate, TSource>)
+        {
+            _collection.Modify([&](auto& newCollection)
+            {
+                std::erase_if(newCollection, [&predicate](const TSource& element) { return predicate(element); });
+            });
+            return LinqContainer(std::move(_collection));
+        }
+
         /// @brief Sorts the elements of a collection
         /// @param orderType 
         /// @return 
-        LinqContainer Order(OrderType orderType = OrderType::ASC) const noexcept
+        LinqContainer Order(OrderType orderType = OrderType::ASC) const& noexcept
         requires Concepts::Comparable<TSource>
         {
             if (_collection.empty())
                 return *this;
-            std::vector<TSource> newCollection(_collection.cbegin(), _collection.cend());
+            std::pmr::vector<TSource> newCollection(_collection.cbegin(), _collection.cend(), _collection.Resource());
             Sort::QuickSort(newCollection.data(), 0, _collection.size() - 1, orderType);
             return LinqContainer(std::move(newCollection));
         }
 
-        /// @brief Sorts the elements of a collection with selector
+        /// @brief Sorts the elements in the storage of the expiring container
+        /// @param orderType 
+        /// @return 
+        LinqContainer Order(OrderType orderType = OrderType::ASC) && noexcept
+        requires Concepts::Comparable<TSource>
+        {
+            _collection.Modify([&](auto& newCollection)
+            {
+                if (!newCollection.empty())
+                    Sort::QuickSort(newCollection.data(), 0, newCollection.size() - 1, orderType);
+            });
+            return LinqContainer(std::move(_collection));
+        }
+
+        /// @brief Stably sorts the elements of a collection with selector, which is invoked once per element
         /// @tparam TSelector 
         /// @param selector 
         /// @param orderType 
         /// @return 
         template<std::invocable<TSource> TSelector>
         requires Concepts::Comparable<std::invoke_result_t<TSelector, TSource>>
-        LinqContainer OrderBy(TSelector&& selector, OrderType orderType = OrderType::ASC) const 
-        noexcept(std::is_nothrow_invocable_v<TSelector, TSource>)
+        LinqContainer OrderBy(TSelector&& selector, OrderType orderType = OrderType::ASC) const&
+        {
+            if (_collection.empty())
+                return *this;
+            std::pmr::vector<TSource> newCollection(_collection.cbegin(), _collection.cend(), _collection.Resource());
+            Sort::SchwartzianSort(newCollection.data(), 0, _collection.size() - 1, std::forward<TSelector>(selector), orderType);
+            return LinqContainer(std::move(newCollection));
+        }
+
+        /// @brief Stably sorts the elements with selector in the storage of the expiring container
+        /// @tparam TSelector 
+        /// @param selector 
+        /// @param orderType 
+        /// @return 
+        template<std::invocable<TSource> TSelector>
+        requires Concepts::Comparable<std::invoke_result_t<TSelector, TSource>>
+        LinqContainer OrderBy(TSelector&& selector, OrderType orderType = OrderType::ASC) &&
+        {
+            _collection.Modify([&](auto& newCollection)
+            {
+                if (!newCollection.empty())
+                    Sort::SchwartzianSort(newCollection.data(), 0, newCollection.size() - 1, std::forward<TSelector>(selector), orderType);
+            });
+            return LinqContainer(std::move(_collection));
+        }
+
+        /// @brief Sorts the elements of a collection on several threads
+        /// @param orderType 
+        /// @param parallel Number of threads and whether the sort must be stable
+        /// @return 
+        LinqContainer Order(OrderType orderType, Parallel parallel) const&
+        requires Concepts::Comparable<TSource>
+        {
+            if (_collection.empty())
+                return *this;
+            std::pmr::vector<TSource> newCollection(_collection.cbegin(), _collection.cend(), _collection.Resource());
+            if (parallel.Stable)
+                Sort::ParallelStableSort(newCollection.data(), 0, _collection.size() - 1, orderType, parallel.Threads());
+            else
+                Sort::ParallelSort(newCollection.data(), 0, _collection.size() - 1, orderType, parallel.Threads());
+            return LinqContainer(std::move(newCollection));
+        }
+
+        /// @brief Sorts the elements in the storage of the expiring container on several threads
+        /// @param orderType 
+        /// @param parallel Number of threads and whether the sort must be stable
+        /// @return 
+        LinqContainer Order(OrderType orderType, Parallel parallel) &&
+        requires Concepts::Comparable<TSource>
+        {
+            if (_collection.empty())
+                return LinqContainer(std::move(_collection));
+            _collection.Modify([&](auto& newCollection)
+            {
+                if (parallel.Stable)
+                    Sort::ParallelStableSort(newCollection.data(), 0, newCollection.size() - 1, orderType, parallel.Threads());
+                else
+                    Sort::ParallelSort(newCollection.data(), 0, newCollection.size() - 1, orderType, parallel.Threads());
+            });
+            return LinqContainer(std::move(_collection));
+        }
+
+        /// @brief Sorts the elements of a collection with selector on several threads
+        /// @tparam TSelector Must be safe to invoke concurrently
+        /// @param selector 
+        /// @param orderType 
+        /// @param parallel Number of threads and whether the sort must be stable
+        /// @return 
+        template<std::invocable<TSource> TSelector>
+        requires Concepts::Comparable<std::invoke_result_t<TSelector, TSource>>
+        LinqContainer OrderBy(TSelector&& selector, OrderType orderType, Parallel parallel) const&
         {
             if (_collection.empty())
                 return *this;
-            std::vector<TSource> newCollection(_collection.cbegin(), _collection.cend());
-            Sort::QuickSort(newCollection.data(), 0, _collection.size() - 1, std::forward<TSelector>(selector), orderType);
+            std::pmr::vector<TSource> newCollection(_collection.cbegin(), _collection.cend(), _collection.Resource());
+            if (parallel.Stable)
+                Sort::ParallelStableSort(newCollection.data(), 0, _collection.size() - 1,
+                                         std::forward<TSelector>(selector), orderType, parallel.Threads());
+            else
+                Sort::ParallelSort(newCollection.data(), 0, _collection.size() - 1,
+                                   std::forward<TSelector>(selector), orderType, parallel.Threads());
             return LinqContainer(std::move(newCollection));
         }
 
+        /// @brief Sorts the elements with selector in the storage of the expiring container on several threads
+        /// @tparam TSelector Must be safe to invoke concurrently
+        /// @param selector 
+        /// @param orderType 
+        /// @param parallel Number of threads and whether the sort must be stable
+        /// @return 
+        template<std::invocable<TSource> TSelector>
+        requires Concepts::Comparable<std::invoke_result_t<TSelector, TSource>>
+        LinqContainer OrderBy(TSelector&& selector, OrderType orderType, Parallel parallel) &&
+        {
+            if (_collection.empty())
+                return LinqContainer(std::move(_collection));
+            _collection.Modify([&](auto& newCollection)
+            {
+                if (parallel.Stable)
+                    Sort::ParallelStableSort(newCollection.data(), 0, newCollection.size() - 1,
+                                             std::forward<TSelector>(selector), orderType, parallel.Threads());
+                else
+                    Sort::ParallelSort(newCollection.data(), 0, newCollection.size() - 1,
+                                       std::forward<TSelector>(selector), orderType, parallel.Threads());
+            });
+            return LinqContainer(std::move(_collection));
+        }
+
+        /// @brief Retrieves the count first elements of the sorted collection without sorting the whole collection,
+        /// only the retrieved elements are copied and equal elements keep their relative order
+        /// @param count 
+        /// @param orderType 
+        /// @return 
+        LinqContainer TopK(const std::size_t count, OrderType orderType = OrderType::ASC) const&
+        requires Concepts::Comparable<TSource>
+        {
+            return TopKByKeys(count, _collection, orderType, 1);
+        }
+
+        /// @brief Retrieves the count first elements of the sorted expiring container, selecting them in its storage
+        /// @param count 
+        /// @param orderType 
+        /// @return 
+        LinqContainer TopK(const std::size_t count, OrderType orderType = OrderType::ASC) &&
+        requires Concepts::Comparable<TSource>
+        {
+            if (_collection.empty())
+                return LinqContainer(std::move(_collection));
+            _collection.Modify([&](auto& newCollection)
+            {
+                Sort::TopK(newCollection.data(), 0, newCollection.size() - 1, count, orderType);
+                newCollection.resize(std::min(count, newCollection.size()));
+            });
+            return LinqContainer(std::move(_collection));
+        }
+
+        /// @brief Retrieves the count first elements of the collection stably sorted with selector,
+        /// which is invoked once per element
+        /// @tparam TSelector 
+        /// @param count 
+        /// @param selector 
+        /// @param orderType 
+        /// @return 
+        template<std::invocable<TSource> TSelector>
+        requires Concepts::Comparable<std::invoke_result_t<TSelector, TSource>>
+        LinqContainer TopK(const std::size_t count, TSelector&& selector, OrderType orderType = OrderType::ASC) const&
+        {
+            std::pmr::vector<std::decay_t<std::invoke_result_t<TSelector, TSource>>> keys(_collection.Resource());
+            keys.reserve(_collection.size());
+            for (const TSource& element : _collection)
+                keys.push_back(selector(element));
+            return TopKByKeys(count, keys, orderType, 1);
+        }
+
+        /// @brief Retrieves the count first elements of the expiring container stably sorted with selector
+        /// @tparam TSelector 
+        /// @param count 
+        /// @param selector 
+        /// @param orderType 
+        /// @return 
+        template<std::invocable<TSource> TSelector>
+        requires Concepts::Comparable<std::invoke_result_t<TSelector, TSource>>
+        LinqContainer TopK(const std::size_t count, TSelector&& selector, OrderType orderType = OrderType::ASC) &&
+        {
+            if (_collection.empty())
+                return LinqContainer(std::move(_collection));
+            _collection.Modify([&](auto& newCollection)
+            {
+                Sort::TopK(newCollection.data(), 0, newCollection.size() - 1, count, std::forward<TSelector>(selector), orderType);
+                newCollection.resize(std::min(count, newCollection.size()));
+            });
+            return LinqContainer(std::move(_collection));
+        }
+
+        /// @brief Retrieves the count first elements of the sorted collection, each thread selects
+        /// from its own part of the collection and the winners are selected once more
+        /// @param count 
+        /// @param orderType 
+        /// @param parallel Number of threads
+        /// @return 
+        LinqContainer TopK(const std::size_t count, OrderType orderType, Parallel parallel) const&
+        requires Concepts::Comparable<TSource>
+        {
+            return TopKByKeys(count, _collection, orderType, parallel.Threads());
+        }
+
+        /// @brief Retrieves the count first elements of the sorted expiring container on several threads
+        /// @param count 
+        /// @param orderType 
+        /// @param parallel Number of threads
+        /// @return 
+        LinqContainer TopK(const std::size_t count, OrderType orderType, Parallel parallel) &&
+        requires Concepts::Comparable<TSource>
+        {
+            if (_collection.empty())
+                return LinqContainer(std::move(_collection));
+            _collection.Modify([&](auto& newCollection)
+            {
+                Sort::ParallelTopK(newCollection.data(), 0, newCollection.size() - 1, count, orderType, parallel.Threads());
+                newCollection.resize(std::min(count, newCollection.size()));
+            });
+            return LinqContainer(std::move(_collection));
+        }
+
+        /// @brief Retrieves the count first elements of the collection stably sorted with selector on several threads
+        /// @tparam TSelector Must be safe to invoke concurrently
+        /// @param count 
+        /// @param selector 
+        /// @param orderType 
+        /// @param parallel Number of threads
+        /// @return 
+        template<std::invocable<TSource> TSelector>
+        requires Concepts::Comparable<std::invoke_result_t<TSelector, TSource>>
+        LinqContainer TopK(const std::size_t count, TSelector&& selector, OrderType orderType, Parallel parallel) const&
+        {
+            std::pmr::vector<std::decay_t<std::invoke_result_t<TSelector, TSource>>> keys(_collection.Resource());
+            keys.reserve(_collection.size());
+            for (const TSource& element : _collection)
+                keys.push_back(selector(element));
+            return TopKByKeys(count, keys, orderType, parallel.Threads());
+        }
+
+        /// @brief Retrieves the count first elements of the expiring container stably sorted with selector on several threads
+        /// @tparam TSelector Must be safe to invoke concurrently
+        /// @param count 
+        /// @param selector 
+        /// @param orderType 
+        /// @param parallel Number of threads
+        /// @return 
+        template<std::invocable<TSource> TSelector>
+        requires Concepts::Comparable<std::invoke_result_t<TSelector, TSource>>
+        LinqContainer TopK(const std::size_t count, TSelector&& selector, OrderType orderType, Parallel parallel) &&
+        {
+            if (_collection.empty())
+                return LinqContainer(std::move(_collection));
+            _collection.Modify([&](auto& newCollection)
+            {
+                Sort::ParallelTopK(newCollection.data(), 0, newCollection.size() - 1, count,
+                                   std::forward<TSelector>(selector), orderType, parallel.Threads());
+                newCollection.resize(std::min(count, newCollection.size()));
+            });
+            return LinqContainer(std::move(_collection));
+        }
+
         /// @brief Reverse the collection
         /// @return 
-        LinqContainer Reverse() const noexcept
+        LinqContainer Reverse() const& noexcept
         {
-            std::vector<TSource> newCollection(_collection.crbegin(), _collection.crend());
+            std::pmr::vector<TSource> newCollection(_collection.crbegin(), _collection.crend(), _collection.Resource());
             return LinqContainer(std::move(newCollection));
         }
 
+        /// @brief Reverse the storage of the expiring container
+        /// @return 
+        LinqContainer Reverse() && noexcept
+        {
+            _collection.Modify([&](auto& newCollection)
+            {
+                std::reverse(newCollection.begin(), newCollection.end());
+            });
+            return LinqContainer(std::move(_collection));
+        }
+
         /// @brief Get the difference of two sequences
         /// @tparam TOtherCollection 
         /// @param otherCollection 
@@ -547,7 +898,7 @@ namespace ExtendedCpp::LINQ
                  std::same_as<typename std::decay_t<TOtherCollection>::value_type, TSource>
         LinqContainer Except(const TOtherCollection& otherCollection) const noexcept
         {
-            std::set<TSource> newCollection;
+            std::pmr::set<TSource> newCollection(_collection.Resource());
 
             for (const TSource& element : _collection)
             {
@@ -562,7 +913,7 @@ namespace ExtendedCpp::LINQ
                 }
             }
 
-            std::vector<TSource> assignCollection;
+            std::pmr::vector<TSource> assignCollection(_collection.Resource());
             assignCollection.assign(newCollection.cbegin(), newCollection.cend());
             return LinqContainer(std::move(assignCollection));
         }
@@ -578,7 +929,7 @@ namespace ExtendedCpp::LINQ
                  std::same_as<typename std::decay_t<TOtherCollection>::value_type, TSource>
         LinqContainer Except(TOtherCollection&& otherCollection) const noexcept
         {
-            std::set<TSource> newCollection;
+            std::pmr::set<TSource> newCollection(_collection.Resource());
 
             for (const TSource& element : _collection)
             {
@@ -593,7 +944,7 @@ namespace ExtendedCpp::LINQ
                 }
             }
 
-            std::vector<TSource> assignCollection;
+            std::pmr::vector<TSource> assignCollection(_collection.Resource());
             assignCollection.assign(newCollection.cbegin(), newCollection.cend());
             return LinqContainer(std::move(assignCollection));
         }
@@ -607,7 +958,7 @@ namespace ExtendedCpp::LINQ
                  std::same_as<typename std::decay_t<TOtherCollection>::value_type, TSource>
         LinqContainer Intersect(const TOtherCollection& otherCollection) const noexcept
         {
-            std::set<TSource> newCollection;
+            std::pmr::set<TSource> newCollection(_collection.Resource());
 
             for (const TSource& element : _collection)
                 for (const TSource& otherElement : otherCollection)
@@ -617,7 +968,7 @@ namespace ExtendedCpp::LINQ
                         break;
                     }
 
-            std::vector<TSource> assignCollection;
+            std::pmr::vector<TSource> assignCollection(_collection.Resource());
             assignCollection.assign(newCollection.cbegin(), newCollection.cend());
             return LinqContainer(std::move(assignCollection));
         }
@@ -631,7 +982,7 @@ namespace ExtendedCpp::LINQ
                  std::same_as<typename std::decay_t<TOtherCollection>::value_type, TSource>
         LinqContainer Intersect(TOtherCollection&& otherCollection) const noexcept
         {
-            std::set<TSource> newCollection;
+            std::pmr::set<TSource> newCollection(_collection.Resource());
 
             for (const TSource& element : _collection)
                 for (TSource&& otherElement : otherCollection)
@@ -641,7 +992,7 @@ namespace ExtendedCpp::LINQ
                         break;
                     }
 
-            std::vector<TSource> assignCollection;
+            std::pmr::vector<TSource> assignCollection(_collection.Resource());
             assignCollection.assign(newCollection.cbegin(), newCollection.cend());
             return LinqContainer(std::move(assignCollection));
         }
@@ -651,11 +1002,11 @@ namespace ExtendedCpp::LINQ
         LinqContainer Distinct() const noexcept
         requires Concepts::Equatable<TSource>
         {
-            std::set<TSource> newCollection;
+            std::pmr::set<TSource> newCollection(_collection.Resource());
             for (const TSource& element : _collection)
                 newCollection.insert(element);
 
-            std::vector<TSource> assignCollection;
+            std::pmr::vector<TSource> assignCollection(_collection.Resource());
             assignCollection.assign(newCollection.cbegin(), newCollection.cend());
             return LinqContainer(std::move(assignCollection));
         }
@@ -669,7 +1020,7 @@ namespace ExtendedCpp::LINQ
                  std::same_as<typename std::decay_t<TOtherCollection>::value_type, TSource>
         LinqContainer Union(const TOtherCollection& otherCollection) const noexcept
         {
-            std::set<TSource> newCollection;
+            std::pmr::set<TSource> newCollection(_collection.Resource());
 
             for (const TSource& element : _collection)
                 newCollection.insert(element);
@@ -677,7 +1028,7 @@ namespace ExtendedCpp::LINQ
             for (const TSource& element : otherCollection)
                 newCollection.insert(element);
 
-            std::vector<TSource> assignCollection;
+            std::pmr::vector<TSource> assignCollection(_collection.Resource());
             assignCollection.assign(newCollection.cbegin(), newCollection.cend());
             return LinqContainer(std::move(assignCollection));
         }
@@ -691,7 +1042,7 @@ namespace ExtendedCpp::LINQ
                  std::same_as<typename std::decay_t<TOtherCollection>::value_type, TSource>
         LinqContainer Union(TOtherCollection&& otherCollection) const noexcept
         {
-            std::set<TSource> newCollection;
+            std::pmr::set<TSource> newCollection(_collection.Resource());
 
             for (const TSource& element : _collection)
                 newCollection.insert(element);
@@ -699,7 +1050,7 @@ namespace ExtendedCpp::LINQ
             for (TSource&& element : otherCollection)
                 newCollection.insert(std::move(element));
 
-            std::vector<TSource> assignCollection;
+            std::pmr::vector<TSource> assignCollection(_collection.Resource());
             assignCollection.assign(newCollection.cbegin(), newCollection.cend());
             return LinqContainer(std::move(assignCollection));
         }
@@ -763,6 +1114,35 @@ namespace ExtendedCpp::LINQ
             return Aggregate::Sum(_collection.data(), 0, _collection.size() - 1, std::forward<TSelector>(selector));
         }
 
+        /// @brief Get the sum of floating point values with the given order of additions
+        /// @param summationType 
+        /// @param parallel Execution options of PARALLEL_PAIRWISE
+        /// @return 
+        TSource Sum(const SummationType summationType, const Parallel parallel = {}) const
+        requires std::floating_point<TSource>
+        {
+            if (_collection.empty())
+                throw std::out_of_range("Collection is empty");
+            return Aggregate::Sum(_collection.data(), 0, _collection.size() - 1, summationType, parallel.ThreadCount);
+        }
+
+        /// @brief Get the sum of floating point values with the given order of additions
+        /// @tparam TSelector Must be safe to invoke concurrently for PARALLEL_PAIRWISE
+        /// @tparam TResult 
+        /// @param selector 
+        /// @param summationType 
+        /// @param parallel Execution options of PARALLEL_PAIRWISE
+        /// @return 
+        template<std::invocable<TSource> TSelector,
+                 std::floating_point TResult = std::invoke_result_t<TSelector, TSource>>
+        TResult Sum(TSelector&& selector, const SummationType summationType, const Parallel parallel = {}) const
+        {
+            if (_collection.empty())
+                throw std::out_of_range("Collection is empty");
+            return Aggregate::Sum(_collection.data(), 0, _collection.size() - 1, std::forward<TSelector>(selector),
+                                  summationType, parallel.ThreadCount);
+        }
+
         /// @brief Find element with the minimum value
         /// @return 
         TSource Min() const
@@ -812,6 +1192,30 @@ namespace ExtendedCpp::LINQ
             return Aggregate::Max(_collection.data(), 0, _collection.size() - 1, std::forward<TSelector>(selector));
         }
 
+        /// @brief Find elements with the minimum and the maximum value in one pass
+        /// @return Minimum and maximum
+        std::pair<TSource, TSource> MinMax() const
+        requires Concepts::Comparable<TSource>
+        {
+            if (_collection.empty())
+                throw std::out_of_range("Collection is empty");
+            return Aggregate::MinMax(_collection.data(), 0, _collection.size() - 1);
+        }
+
+        /// @brief Find the minimum and the maximum value in one pass
+        /// @tparam TSelector 
+        /// @tparam TResult 
+        /// @param selector 
+        /// @return Minimum and maximum
+        template<std::invocable<TSource> TSelector,
+                 Concepts::Comparable TResult = std::invoke_result_t<TSelector, TSource>>
+        std::pair<TResult, TResult> MinMax(TSelector&& selector) const
+        {
+            if (_collection.empty())
+                throw std::out_of_range("Collection is empty");
+            return Aggregate::MinMax(_collection.data(), 0, _collection.size() - 1, std::forward<TSelector>(selector));
+        }
+
         /// @brief Find the average value of the collection
         /// @return 
         TSource Average() const
@@ -836,6 +1240,35 @@ namespace ExtendedCpp::LINQ
             return Aggregate::Average(_collection.data(), 0, _collection.size() - 1, std::forward<TSelector>(selector));
         }
 
+        /// @brief Find the average value of floating point values with the given order of additions
+        /// @param summationType 
+        /// @param parallel Execution options of PARALLEL_PAIRWISE
+        /// @return 
+        TSource Average(const SummationType summationType, const Parallel parallel = {}) const
+        requires std::floating_point<TSource>
+        {
+            if (_collection.empty())
+                throw std::out_of_range("Collection is empty");
+            return Aggregate::Average(_collection.data(), 0, _collection.size() - 1, summationType, parallel.ThreadCount);
+        }
+
+        /// @brief Find the average value of floating point values with the given order of additions
+        /// @tparam TSelector Must be safe to invoke concurrently for PARALLEL_PAIRWISE
+        /// @tparam TResult 
+        /// @param selector 
+        /// @param summationType 
+        /// @param parallel Execution options of PARALLEL_PAIRWISE
+        /// @return 
+        template<std::invocable<TSource> TSelector,
+                 std::floating_point TResult = std::invoke_result_t<TSelector, TSource>>
+        TResult Average(TSelector&& selector, const SummationType summationType, const Parallel parallel = {}) const
+        {
+            if (_collection.empty())
+                throw std::out_of_range("Collection is empty");
+            return Aggregate::Average(_collection.data(), 0, _collection.size() - 1, std::forward<TSelector>(selector),
+                                      summationType, parallel.ThreadCount);
+        }
+
         /// @brief Get first element of collection
         /// @return 
         TSource First() const
@@ -1020,39 +1453,41 @@ namespace ExtendedCpp::LINQ
             return _collection.empty();
         }
 
-        /// @brief Skips a certain number of elements
+        /// @brief Skips a certain number of elements. The result is a slice of the same storage,
+        /// elements are copied only by the first mutable access
         /// @param count 
         /// @return 
-        LinqContainer Skip(const std::size_t count) const noexcept
+        LinqContainer Skip(const std::size_t count) const& noexcept
         {
-            std::vector<TSource> newCollection;
-
-            if (count >= _collection.size())
-                return LinqContainer(std::move(newCollection));
-
-            newCollection.reserve(_collection.size() - count);
-            for (std::size_t i = count; i < _collection.size(); ++i)
-                newCollection.push_back(_collection[i]);
-
-            return LinqContainer(std::move(newCollection));
+            const std::size_t skipped = std::min(count, _collection.size());
+            return LinqContainer(_collection.Slice(skipped, _collection.size() - skipped));
         }
 
-        /// @brief Skips a certain number of elements from the end of the collection
+        /// @brief Skips a certain number of elements of the expiring container without copying the rest
         /// @param count 
         /// @return 
-        LinqContainer SkipLast(const std::size_t count) const noexcept
+        LinqContainer Skip(const std::size_t count) && noexcept
         {
-            std::vector<TSource> newCollection;
-
-            if (count >= _collection.size())
-                return LinqContainer(std::move(newCollection));
-
-            newCollection.reserve(_collection.size() - count);
+            const std::size_t skipped = std::min(count, _collection.size());
+            const std::size_t size = _collection.size() - skipped;
+            return LinqContainer(std::move(_collection).Slice(skipped, size));
+        }
 
-            for (std::size_t i = 0; i < _collection.size() - count; ++i)
-                newCollection.push_back(_collection[i]);
+        /// @brief Skips a certain number of elements from the end of the collection, the result is a slice
+        /// @param count 
+        /// @return 
+        LinqContainer SkipLast(const std::size_t count) const& noexcept
+        {
+            return LinqContainer(_collection.Slice(0, _collection.size() - std::min(count, _collection.size())));
+        }
 
-            return LinqContainer(std::move(newCollection));
+        /// @brief Skips a certain number of elements from the end of the expiring container
+        /// @param count 
+        /// @return 
+        LinqContainer SkipLast(const std::size_t count) && noexcept
+        {
+            const std::size_t size = _collection.size() - std::min(count, _collection.size());
+            return LinqContainer(std::move(_collection).Slice(0, size));
         }
 
         /// @brief Skips a chain of elements, starting with the first element, as long as they satisfy a certain condition
@@ -1061,73 +1496,183 @@ namespace ExtendedCpp::LINQ
         /// @return 
         template<Concepts::IsPredicate<TSource> TPredicate>
         LinqContainer SkipWhile(TPredicate&& predicate)
-        const noexcept(std::is_nothrow_invocable_v<TPredicate, TSource>)
+        const& noexcept(std::is_nothrow_invocable_v<TPredicate, TSource>)
         {
-            std::vector<TSource> newCollection;
-
             std::size_t i = 0;
             for (; i < _collection.size(); ++i)
                 if(!predicate(_collection[i]))
                     break;
 
-            for (; i < _collection.size(); ++i)
-                newCollection.push_back(_collection[i]);
-
-            return LinqContainer(std::move(newCollection));
+            return LinqContainer(_collection.Slice(i, _collection.size() - i));
         }
 
-        /// @brief Retrieves a certain number of elements
-        /// @param count 
+        /// @brief Skips a chain of elements of the expiring container as long as they satisfy a certain condition
+        /// @tparam TPredicate 
+        /// @param predicate 
         /// @return 
-        LinqContainer Take(const std::size_t count) const noexcept
-        {
-            std::vector<TSource> newCollection;
+        template<Concepts::IsPredicate<TSource> TPredicate>
+        LinqContainer SkipWhile(TPredicate&& predicate)
+        && noexcept(std::is_nothrow_invocable_v<TPredicate, TSource>)
+        {
+            std::size_t i = 0;
+            for (; i < _collection.size(); ++i)
+                if(!predicate(_collection[i]))
+                    break;
 
-            if (count >= _collection.size())
-                return LinqContainer(std::move(newCollection));
+            const std::size_t size = _collection.size() - i;
+            return LinqContainer(std::move(_collection).Slice(i, size));
+        }
 
-            newCollection.reserve(count);
-            for (std::size_t i = 0; i < count; ++i)
-                newCollection.push_back(_collection[i]);
+        /// @brief Retrieves a certain number of elements, all of them if there are fewer. The result is a slice
+        /// of the same storage, elements are copied only by the first mutable access
+        /// @param count 
+        /// @return 
+        LinqContainer Take(const std::size_t count) const& noexcept
+        {
+            return LinqContainer(_collection.Slice(0, std::min(count, _collection.size())));
+        }
 
-            return LinqContainer(std::move(newCollection));
+        /// @brief Retrieves a certain number of elements of the expiring container without copying them
+        /// @param count 
+        /// @return 
+        LinqContainer Take(const std::size_t count) && noexcept
+        {
+            const std::size_t size = std::min(count, _collection.size());
+            return LinqContainer(std::move(_collection).Slice(0, size));
         }
 
-        /// @brief Retrieves a certain number of elements from the end of the collection
+        /// @brief Retrieves a certain number of elements from the end of the collection, the result is a slice
         /// @param count 
         /// @return 
-        LinqContainer TakeLast(const std::size_t count) const noexcept
+        LinqContainer TakeLast(const std::size_t count) const& noexcept
         {
-            std::vector<TSource> newCollection;
+            const std::size_t size = std::min(count, _collection.size());
+            return LinqContainer(_collection.Slice(_collection.size() - size, size));
+        }
 
-            if (count >= _collection.size())
-                return LinqContainer(std::move(newCollection));
+        /// @brief Retrieves a certain number of elements from the end of the expiring container
+        /// @param count 
+        /// @return 
+        LinqContainer TakeLast(const std::size_t count) && noexcept
+        {
+            const std::size_t size = std::min(count, _collection.size());
+            const std::size_t offset = _collection.size() - size;
+            return LinqContainer(std::move(_collection).Slice(offset, size));
+        }
 
-            newCollection.reserve(count);
-            for (std::size_t i = _collection.size() - count; i < _collection.size(); ++i)
-                newCollection.push_back(_collection[i]);
+        /// @brief Selects a chain of elements, starting with the first element, as long as they satisfy a certain condition
+        /// @tparam TPredicate 
+        /// @param predicate 
+        /// @return 
+        template<Concepts::IsPredicate<TSource> TPredicate>
+        LinqContainer TakeWhile(TPredicate&& predicate)
+        const& noexcept(std::is_nothrow_invocable_v<TPredicate, TSource>)
+        {
+            std::size_t size = 0;
+            for (; size < _collection.size(); ++size)
+                if (!predicate(_collection[size]))
+                    break;
 
-            return LinqContainer(std::move(newCollection));
+            return LinqContainer(_collection.Slice(0, size));
         }
 
-        /// @brief Selects a chain of elements, starting with the first element, as long as they satisfy a certain condition
+        /// @brief Selects a chain of elements of the expiring container as long as they satisfy a certain condition
         /// @tparam TPredicate 
         /// @param predicate 
         /// @return 
         template<Concepts::IsPredicate<TSource> TPredicate>
         LinqContainer TakeWhile(TPredicate&& predicate)
-        const noexcept(std::is_nothrow_invocable_v<TPredicate, TSource>)
+        && noexcept(std::is_nothrow_invocable_v<TPredicate, TSource>)
         {
-            std::vector<TSource> newCollection;
+            std::size_t size = 0;
+            for (; size < _collection.size(); ++size)
+                if (!predicate(_collection[size]))
+                    break;
 
-            for (const TSource& element : _collection)
+            return LinqContainer(std::move(_collection).Slice(0, size));
+        }
+
+        /// @brief Split the collection into consecutive spans of size elements, the last span may be shorter.
+        /// Spans point into the storage of this container, elements are not copied
+        /// @param size 
+        /// @return 
+        LinqContainer<std::span<const TSource>> Chunk(const std::size_t size) const&
+        {
+            if (size == 0)
+                throw std::invalid_argument("Chunk size must be greater than zero");
+
+            std::pmr::vector<std::span<const TSource>> chunks(_collection.Resource());
+            chunks.reserve((_collection.size() + size - 1) / size);
+            for (std::size_t i = 0; i < _collection.size(); i += size)
+                chunks.emplace_back(_collection.data() + i, std::min(size, _collection.size() - i));
+
+            return LinqContainer<std::span<const TSource>>(std::move(chunks));
+        }
+
+        /// @brief Spans would point into the expiring container. Ownership is known only at run time,
+        /// so a borrowing temporary is rejected too: Borrow(collection).Chunk(size) does not compile,
+        /// the borrowing container is stored in a variable or Batch is used instead
+        LinqContainer<std::span<const TSource>> Chunk(std::size_t size) && = delete;
+
+        /// @brief Sliding spans of exactly size elements, each next span starts step elements after the previous one.
+        /// Spans point into the storage of this container, elements are not copied
+        /// @param size 
+        /// @param step 
+        /// @return 
+        LinqContainer<std::span<const TSource>> Window(const std::size_t size, const std::size_t step = 1) const&
+        {
+            if (size == 0 || step == 0)
+                throw std::invalid_argument("Window size and step must be greater than zero");
+
+            std::pmr::vector<std::span<const TSource>> windows(_collection.Resource());
+            if (_collection.size() >= size)
             {
-                if (!predicate(element))
-                    break;
-                newCollection.push_back(element);
+                windows.reserve((_collection.size() - size) / step + 1);
+                for (std::size_t i = 0; i + size <= _collection.size(); i += step)
+                    windows.emplace_back(_collection.data() + i, size);
             }
 
-            return LinqContainer(std::move(newCollection));
+            return LinqContainer<std::span<const TSource>>(std::move(windows));
+        }
+
+        /// @brief Spans would point into the expiring container. A borrowing temporary is rejected too, see Chunk
+        LinqContainer<std::span<const TSource>> Window(std::size_t size, std::size_t step = 1) && = delete;
+
+        /// @brief Split the collection into vectors of size elements, the last vector may be shorter.
+        /// Unlike Chunk every vector owns copies of its elements
+        /// @param size 
+        /// @return 
+        LinqContainer<std::vector<TSource>> Batch(const std::size_t size) const&
+        {
+            if (size == 0)
+                throw std::invalid_argument("Batch size must be greater than zero");
+
+            std::pmr::vector<std::vector<TSource>> batches(_collection.Resource());
+            batches.reserve((_collection.size() + size - 1) / size);
+            for (std::size_t i = 0; i < _collection.size(); i += size)
+                batches.emplace_back(_collection.begin() + i,
+                                     _collection.begin() + i + std::min(size, _collection.size() - i));
+
+            return LinqContainer<std::vector<TSource>>(std::move(batches));
+        }
+
+        /// @brief Split the expiring container into vectors of size elements, which are moved into them
+        /// @param size 
+        /// @return 
+        LinqContainer<std::vector<TSource>> Batch(const std::size_t size) &&
+        {
+            if (size == 0)
+                throw std::invalid_argument("Batch size must be greater than zero");
+
+            std::pmr::vector<std::vector<TSource>> batches(_collection.Resource());
+            std::vector<TSource> collection = std::move(_collection).ToVector();
+            batches.reserve((collection.size() + size - 1) / size);
+            for (std::size_t i = 0; i < collection.size(); i += size)
+                batches.emplace_back(std::make_move_iterator(collection.begin() + i),
+                                     std::make_move_iterator(collection.begin() + i +
+                                                             std::min(size, collection.size() - i)));
+
+            return LinqContainer<std::vector<TSource>>(std::move(batches));
         }
 
         /// @brief Group data by certain parameters
@@ -1152,6 +1697,41 @@ namespace ExtendedCpp::LINQ
             return result;
         }
 
+        /// @brief Count elements with equal keys
+        /// @tparam TKeySelector 
+        /// @tparam TKey 
+        /// @param keySelector 
+        /// @return Keys with the numbers of their elements in the order of first occurrence
+        template<std::invocable<TSource> TKeySelector,
+                 typename TKey = std::decay_t<std::invoke_result_t<TKeySelector, TSource>>>
+        requires Concepts::Hashable<TKey> && Concepts::Equatable<TKey> && std::copyable<TKey>
+        LinqContainer<std::pair<TKey, std::size_t>> CountBy(TKeySelector&& keySelector) const
+        {
+            if (_collection.empty())
+                return LinqContainer<std::pair<TKey, std::size_t>>(std::vector<std::pair<TKey, std::size_t>>());
+            return LinqContainer<std::pair<TKey, std::size_t>>(
+                Algorithm::Histogram(_collection.data(), 0, _collection.size() - 1,
+                                     std::forward<TKeySelector>(keySelector)).ToVector());
+        }
+
+        /// @brief Count elements with equal keys by several threads
+        /// @tparam TKeySelector Must be safe to invoke concurrently
+        /// @tparam TKey 
+        /// @param keySelector 
+        /// @param parallel 
+        /// @return Keys with the numbers of their elements in the order of first occurrence
+        template<std::invocable<TSource> TKeySelector,
+                 typename TKey = std::decay_t<std::invoke_result_t<TKeySelector, TSource>>>
+        requires Concepts::Hashable<TKey> && Concepts::Equatable<TKey> && std::copyable<TKey>
+        LinqContainer<std::pair<TKey, std::size_t>> CountBy(TKeySelector&& keySelector, Parallel parallel) const
+        {
+            if (_collection.empty())
+                return LinqContainer<std::pair<TKey, std::size_t>>(std::vector<std::pair<TKey, std::size_t>>());
+            return LinqContainer<std::pair<TKey, std::size_t>>(
+                Algorithm::ParallelHistogram(_collection.data(), 0, _collection.size() - 1,
+                                             std::forward<TKeySelector>(keySelector), parallel.ThreadCount).ToVector());
+        }
+
         /// @brief Merge two different types of sets into one
         /// @tparam TResult 
         /// @tparam TOtherCollection 
@@ -1179,7 +1759,7 @@ namespace ExtendedCpp::LINQ
                  std::is_nothrow_invocable_v<TOtherKeySelector, typename TOtherCollection::value_type> &&
                  std::is_nothrow_invocable_v<TResultSelector, TSource, typename TOtherCollection::value_type>)
         {
-            std::vector<TResult> newCollection;
+            std::pmr::vector<TResult> newCollection(_collection.Resource());
 
             if (otherCollection.empty())
                 return LinqContainer<TResult>(std::move(newCollection));
@@ -1219,7 +1799,7 @@ namespace ExtendedCpp::LINQ
                  std::is_nothrow_invocable_v<TOtherKeySelector, typename TOtherCollection::value_type> &&
                  std::is_nothrow_invocable_v<TResultSelector, TSource, typename TOtherCollection::value_type>)
         {
-            std::vector<TResult> newCollection;
+            std::pmr::vector<TResult> newCollection(_collection.Resource());
 
             if (otherCollection.empty())
                 return LinqContainer<TResult>(std::move(newCollection));
@@ -1242,14 +1822,14 @@ namespace ExtendedCpp::LINQ
         /// @param otherCollection 
         /// @param innerKeySelector 
         /// @param otherKeySelector 
-        /// @param resultSelector 
+        /// @param resultSelector Receives a group allocated from the memory resource of the container, a selector taking a std::vector receives a copy of it
         /// @return 
         template<Concepts::ConstIterable TOtherCollection,
                  std::invocable<TSource> TInnerKeySelector,
                  Concepts::Equatable TKey = std::invoke_result_t<TInnerKeySelector, TSource>,
                  std::invocable<typename TOtherCollection::value_type> TOtherKeySelector,
-                 std::invocable<const std::vector<TSource>&, typename TOtherCollection::value_type> TResultSelector,
-                 typename TResult = std::invoke_result_t<TResultSelector, const std::vector<TSource>&, typename TOtherCollection::value_type>>
+                 Concepts::GroupSelector<TSource, typename TOtherCollection::value_type> TResultSelector,
+                 typename TResult = GroupSelectorTraits<TResultSelector, TSource, typename TOtherCollection::value_type>::ResultType>
         requires std::same_as<TKey, std::invoke_result_t<TOtherKeySelector, typename TOtherCollection::value_type>>
         LinqContainer<TResult> GroupJoin(const TOtherCollection& otherCollection,
                                          TInnerKeySelector&& innerKeySelector,
@@ -1257,19 +1837,26 @@ namespace ExtendedCpp::LINQ
                                          TResultSelector&& resultSelector) const 
         noexcept(std::is_nothrow_invocable_v<TInnerKeySelector, TSource> &&
                  std::is_nothrow_invocable_v<TOtherKeySelector, typename TOtherCollection::value_type> &&
-                 std::is_nothrow_invocable_v<TResultSelector, const std::vector<TSource>&, typename TOtherCollection::value_type>)
+                 std::is_nothrow_invocable_v<TResultSelector,
+                     const typename GroupSelectorTraits<TResultSelector, TSource, typename TOtherCollection::value_type>::GroupType&, typename TOtherCollection::value_type>)
         {
-            std::vector<TResult> newCollection;
+            std::pmr::vector<TResult> newCollection(_collection.Resource());
 
             if (otherCollection.empty())
                 return LinqContainer<TResult>(std::move(newCollection));
 
-            std::map<TKey, std::vector<TSource>> groups = GroupBy(std::forward<TInnerKeySelector>(innerKeySelector));
+            using TGroup = GroupSelectorTraits<TResultSelector, TSource, typename TOtherCollection::value_type>::GroupType;
+            const std::pmr::map<TKey, std::pmr::vector<TSource>> groups = GroupByKey<TKey>(innerKeySelector);
 
             for (const auto& [key, group] : groups)
                 for (const auto& element : otherCollection)
                     if (key == otherKeySelector(element))
-                        newCollection.push_back(resultSelector(group, element));
+                    {
+                        if constexpr (std::same_as<TGroup, std::pmr::vector<TSource>>)
+                            newCollection.push_back(resultSelector(group, element));
+                        else
+                            newCollection.push_back(resultSelector(TGroup(group.cbegin(), group.cend()), element));
+                    }
 
             return LinqContainer<TResult>(std::move(newCollection));
         }
@@ -1284,14 +1871,14 @@ namespace ExtendedCpp::LINQ
         /// @param otherCollection 
         /// @param innerKeySelector 
         /// @param otherKeySelector 
-        /// @param resultSelector 
+        /// @param resultSelector Receives a group allocated from the memory resource of the container, a selector taking a std::vector receives a copy of it
         /// @return 
         template<Concepts::Iterable TOtherCollection,
                  std::invocable<TSource> TInnerKeySelector,
                  Concepts::Equatable TKey = std::invoke_result_t<TInnerKeySelector, TSource>,
                  std::invocable<typename TOtherCollection::value_type> TOtherKeySelector,
-                 std::invocable<const std::vector<TSource>&, typename TOtherCollection::value_type> TResultSelector,
-                 typename TResult = std::invoke_result_t<TResultSelector, const std::vector<TSource>&, typename TOtherCollection::value_type>>
+                 Concepts::GroupSelector<TSource, typename TOtherCollection::value_type> TResultSelector,
+                 typename TResult = GroupSelectorTraits<TResultSelector, TSource, typename TOtherCollection::value_type>::ResultType>
         requires std::same_as<TKey, std::invoke_result_t<TOtherKeySelector, typename TOtherCollection::value_type>>
         LinqContainer<TResult> GroupJoin(TOtherCollection&& otherCollection,
                                          TInnerKeySelector&& innerKeySelector,
@@ -1299,19 +1886,26 @@ namespace ExtendedCpp::LINQ
                                          TResultSelector&& resultSelector) const 
         noexcept(std::is_nothrow_invocable_v<TInnerKeySelector, TSource> &&
                  std::is_nothrow_invocable_v<TOtherKeySelector, typename TOtherCollection::value_type> &&
-                 std::is_nothrow_invocable_v<TResultSelector, const std::vector<TSource>&, typename TOtherCollection::value_type>)
+                 std::is_nothrow_invocable_v<TResultSelector,
+                     const typename GroupSelectorTraits<TResultSelector, TSource, typename TOtherCollection::value_type>::GroupType&, typename TOtherCollection::value_type>)
         {
-            std::vector<TResult> newCollection;
+            std::pmr::vector<TResult> newCollection(_collection.Resource());
 
             if (otherCollection.empty())
                 return LinqContainer<TResult>(std::move(newCollection));
 
-            std::map<TKey, std::vector<TSource>> groups = GroupBy(innerKeySelector);
+            using TGroup = GroupSelectorTraits<TResultSelector, TSource, typename TOtherCollection::value_type>::GroupType;
+            const std::pmr::map<TKey, std::pmr::vector<TSource>> groups = GroupByKey<TKey>(innerKeySelector);
 
             for (const auto& [key, group] : groups)
                 for (auto& element : otherCollection)
                     if (key == otherKeySelector(element))
-                        newCollection.push_back(resultSelector(group, std::move(element)));
+                    {
+                        if constexpr (std::same_as<TGroup, std::pmr::vector<TSource>>)
+                            newCollection.push_back(resultSelector(group, std::move(element)));
+                        else
+                            newCollection.push_back(resultSelector(TGroup(group.cbegin(), group.cend()), std::move(element)));
+                    }
 
             return LinqContainer<TResult>(std::move(newCollection));
         }
@@ -1326,7 +1920,7 @@ namespace ExtendedCpp::LINQ
         requires Concepts::ConstIterable<TOtherCollection> && Concepts::HasSize<TOtherCollection>
         LinqContainer<std::pair<TSource, TOtherCollectionValueType>> Zip(const TOtherCollection& otherCollection) const noexcept
         {
-            std::vector<std::pair<TSource, TOtherCollectionValueType>> newCollection;
+            std::pmr::vector<std::pair<TSource, TOtherCollectionValueType>> newCollection(_collection.Resource());
 
             if (otherCollection.empty())
                 return LinqContainer<std::pair<TSource, TOtherCollectionValueType>>(std::move(newCollection));
@@ -1353,7 +1947,7 @@ namespace ExtendedCpp::LINQ
         requires Concepts::Iterable<TOtherCollection> && Concepts::HasSize<TOtherCollection>
         LinqContainer<std::pair<TSource, TOtherCollectionValueType>> Zip(TOtherCollection&& otherCollection) const noexcept
         {
-            std::vector<std::pair<TSource, TOtherCollectionValueType>> newCollection;
+            std::pmr::vector<std::pair<TSource, TOtherCollectionValueType>> newCollection(_collection.Resource());
 
             if (otherCollection.empty())
                 return LinqContainer<std::pair<TSource, TOtherCollectionValueType>>(std::move(newCollection));
@@ -1370,6 +1964,153 @@ namespace ExtendedCpp::LINQ
             return LinqContainer<std::pair<TSource, TOtherCollectionValueType>>(std::move(newCollection));
         }
 
+        /// @brief Select elements, whose keys occur among the keys of the other collection. Keys of the other collection
+        /// are hashed once, a large set of them is guarded by a Bloom filter, so missing keys are mostly rejected
+        /// without the probe of the hash map
+        /// @tparam TOtherCollection 
+        /// @tparam TInnerKeySelector 
+        /// @tparam TOtherKeySelector 
+        /// @tparam TKey 
+        /// @param otherCollection 
+        /// @param innerKeySelector 
+        /// @param otherKeySelector 
+        /// @return 
+        template<Concepts::ConstIterable TOtherCollection,
+                 std::invocable<TSource> TInnerKeySelector,
+                 std::invocable<typename TOtherCollection::value_type> TOtherKeySelector,
+                 typename TKey = std::decay_t<std::invoke_result_t<TInnerKeySelector, TSource>>>
+        requires std::same_as<TKey, std::decay_t<std::invoke_result_t<TOtherKeySelector, typename TOtherCollection::value_type>>> &&
+                 Concepts::Hashable<TKey> && Concepts::Equatable<TKey>
+        LinqContainer SemiJoin(const TOtherCollection& otherCollection,
+                               TInnerKeySelector&& innerKeySelector,
+                               TOtherKeySelector&& otherKeySelector) const&
+        {
+            KeySet<TKey> keys(otherCollection, std::forward<TOtherKeySelector>(otherKeySelector));
+            return Where([&keys, &innerKeySelector](const TSource& element) { return keys.Contains(innerKeySelector(element)); });
+        }
+
+        /// @brief Select elements, whose keys occur among the keys of the other collection, compacting the storage
+        /// of the expiring container
+        /// @tparam TOtherCollection 
+        /// @tparam TInnerKeySelector 
+        /// @tparam TOtherKeySelector 
+        /// @tparam TKey 
+        /// @param otherCollection 
+        /// @param innerKeySelector 
+        /// @param otherKeySelector 
+        /// @return 
+        template<Concepts::ConstIterable TOtherCollection,
+                 std::invocable<TSource> TInnerKeySelector,
+                 std::invocable<typename TOtherCollection::value_type> TOtherKeySelector,
+                 typename TKey = std::decay_t<std::invoke_result_t<TInnerKeySelector, TSource>>>
+        requires std::same_as<TKey, std::decay_t<std::invoke_result_t<TOtherKeySelector, typename TOtherCollection::value_type>>> &&
+                 Concepts::Hashable<TKey> && Concepts::Equatable<TKey>
+        LinqContainer SemiJoin(const TOtherCollection& otherCollection,
+                               TInnerKeySelector&& innerKeySelector,
+                               TOtherKeySelector&& otherKeySelector) &&
+        {
+            KeySet<TKey> keys(otherCollection, std::forward<TOtherKeySelector>(otherKeySelector));
+            return std::move(*this).Where([&keys, &innerKeySelector](const TSource& element) { return keys.Contains(innerKeySelector(element)); });
+        }
+
+        /// @brief Select elements, which occur in the other collection
+        /// @tparam TOtherCollection 
+        /// @param otherCollection 
+        /// @return 
+        template<Concepts::ConstIterable TOtherCollection>
+        requires std::same_as<typename TOtherCollection::value_type, TSource> &&
+                 Concepts::Hashable<TSource> && Concepts::Equatable<TSource>
+        LinqContainer SemiJoin(const TOtherCollection& otherCollection) const&
+        {
+            return SemiJoin(otherCollection, std::identity(), std::identity());
+        }
+
+        /// @brief Select elements, which occur in the other collection, compacting the storage of the expiring container
+        /// @tparam TOtherCollection 
+        /// @param otherCollection 
+        /// @return 
+        template<Concepts::ConstIterable TOtherCollection>
+        requires std::same_as<typename TOtherCollection::value_type, TSource> &&
+                 Concepts::Hashable<TSource> && Concepts::Equatable<TSource>
+        LinqContainer SemiJoin(const TOtherCollection& otherCollection) &&
+        {
+            return std::move(*this).SemiJoin(otherCollection, std::identity(), std::identity());
+        }
+
+        /// @brief Select elements, whose keys do not occur among the keys of the other collection. Keys of the other
+        /// collection are hashed once, a large set of them is guarded by a Bloom filter, so most of the selected
+        /// elements are accepted without the probe of the hash map
+        /// @tparam TOtherCollection 
+        /// @tparam TInnerKeySelector 
+        /// @tparam TOtherKeySelector 
+        /// @tparam TKey 
+        /// @param otherCollection 
+        /// @param innerKeySelector 
+        /// @param otherKeySelector 
+        /// @return 
+        template<Concepts::ConstIterable TOtherCollection,
+                 std::invocable<TSource> TInnerKeySelector,
+                 std::invocable<typename TOtherCollection::value_type> TOtherKeySelector,
+                 typename TKey = std::decay_t<std::invoke_result_t<TInnerKeySelector, TSource>>>
+        requires std::same_as<TKey, std::decay_t<std::invoke_result_t<TOtherKeySelector, typename TOtherCollection::value_type>>> &&
+                 Concepts::Hashable<TKey> && Concepts::Equatable<TKey>
+        LinqContainer AntiJoin(const TOtherCollection& otherCollection,
+                               TInnerKeySelector&& innerKeySelector,
+                               TOtherKeySelector&& otherKeySelector) const&
+        {
+            KeySet<TKey> keys(otherCollection, std::forward<TOtherKeySelector>(otherKeySelector));
+            return RemoveWhere([&keys, &innerKeySelector](const TSource& element) { return keys.Contains(innerKeySelector(element)); });
+        }
+
+        /// @brief Select elements, whose keys do not occur among the keys of the other collection, compacting
+        /// the storage of the expiring container
+        /// @tparam TOtherCollection 
+        /// @tparam TInnerKeySelector 
+        /// @tparam TOtherKeySelector 
+        /// @tparam TKey 
+        /// @param otherCollection 
+        /// @param innerKeySelector 
+        /// @param otherKeySelector 
+        /// @return 
+        template<Concepts::ConstIterable TOtherCollection,
+                 std::invocable<TSource> TInnerKeySelector,
+                 std::invocable<typename TOtherCollection::value_type> TOtherKeySelector,
+                 typename TKey = std::decay_t<std::invoke_result_t<TInnerKeySelector, TSource>>>
+        requires std::same_as<TKey, std::decay_t<std::invoke_result_t<TOtherKeySelector, typename TOtherCollection::value_type>>> &&
+                 Concepts::Hashable<TKey> && Concepts::Equatable<TKey>
+        LinqContainer AntiJoin(const TOtherCollection& otherCollection,
+                               TInnerKeySelector&& innerKeySelector,
+                               TOtherKeySelector&& otherKeySelector) &&
+        {
+            KeySet<TKey> keys(otherCollection, std::forward<TOtherKeySelector>(otherKeySelector));
+            return std::move(*this).RemoveWhere([&keys, &innerKeySelector](const TSource& element) { return keys.Contains(innerKeySelector(element)); });
+        }
+
+        /// @brief Select elements, which do not occur in the other collection
+        /// @tparam TOtherCollection 
+        /// @param otherCollection 
+        /// @return 
+        template<Concepts::ConstIterable TOtherCollection>
+        requires std::same_as<typename TOtherCollection::value_type, TSource> &&
+                 Concepts::Hashable<TSource> && Concepts::Equatable<TSource>
+        LinqContainer AntiJoin(const TOtherCollection& otherCollection) const&
+        {
+            return AntiJoin(otherCollection, std::identity(), std::identity());
+        }
+
+        /// @brief Select elements, which do not occur in the other collection, compacting the storage
+        /// of the expiring container
+        /// @tparam TOtherCollection 
+        /// @param otherCollection 
+        /// @return 
+        template<Concepts::ConstIterable TOtherCollection>
+        requires std::same_as<typename TOtherCollection::value_type, TSource> &&
+                 Concepts::Hashable<TSource> && Concepts::Equatable<TSource>
+        LinqContainer AntiJoin(const TOtherCollection& otherCollection) &&
+        {
+            return std::move(*this).AntiJoin(otherCollection, std::identity(), std::identity());
+        }
+
         /// @brief Checks if all elements match a condition. If all elements match the condition, then true is returned
         /// @tparam TPredicate 
         /// @param predicate 
@@ -1403,6 +2144,9 @@ namespace ExtendedCpp::LINQ
         /// @return 
         bool Contains(const TSource& target) const noexcept
         {
+            if constexpr (Concepts::BitwiseEquatable<TSource>)
+                return Algorithm::Find(_collection.data(), _collection.size(), target) != NPOS;
+
             for (const TSource& element : _collection)
                 if (element == target)
                     return true;
@@ -1442,6 +2186,9 @@ namespace ExtendedCpp::LINQ
         std::size_t IndexAt(const TSource& target) const noexcept
         requires Concepts::Equatable<TSource>
         {
+            if constexpr (Concepts::BitwiseEquatable<TSource>)
+                return Algorithm::Find(_collection.data(), _collection.size(), target);
+
             for (std::size_t i = 0; i < _collection.size(); ++i)
                 if (_collection[i] == target)
                     return i;
@@ -1481,7 +2228,7 @@ namespace ExtendedCpp::LINQ
         {
             if (_collection.empty())
                 return NPOS;
-            return Algorithm::BinarySearch(std::forward<TSource>(element), _collection.data(), 0, _collection.size() - 1);
+            return Algorithm::BinarySearch(element, _collection.data(), 0, _collection.size() - 1);
         }
 
         /// @brief 
@@ -1496,15 +2243,26 @@ namespace ExtendedCpp::LINQ
         {
             if (_collection.empty())
                 return NPOS;
-            return Algorithm::BinarySearch(std::forward<TSource>(element), _collection.data(), 0, _collection.size() - 1, std::forward<TSelector>(selector));
+            return Algorithm::BinarySearch(selector(element), _collection.data(), 0, _collection.size() - 1, selector);
+        }
+
+        /// @brief Collection must be sorted
+        /// @param element 
+        /// @return Index of the first element that is not less than the element, or size of the collection
+        std::size_t LowerBound(const TSource& element) const noexcept
+        requires Concepts::Comparable<TSource>
+        {
+            if (_collection.empty())
+                return 0;
+            return Algorithm::LowerBound(element, _collection.data(), 0, _collection.size() - 1);
         }
 
         /// @brief 
         /// @param element 
         /// @return 
-        LinqContainer PushBack(const TSource& element) const noexcept
+        LinqContainer PushBack(const TSource& element) const& noexcept
         {
-            std::vector<TSource> newCollection;
+            std::pmr::vector<TSource> newCollection(_collection.Resource());
             newCollection.reserve(_collection.size() + 1);
 
             std::copy(_collection.cbegin(), _collection.cend(),
@@ -1518,9 +2276,21 @@ namespace ExtendedCpp::LINQ
         /// @brief 
         /// @param element 
         /// @return 
-        LinqContainer PushBack(TSource&& element) const noexcept
+        LinqContainer PushBack(const TSource& element) && noexcept
         {
-            std::vector<TSource> newCollection;
+            _collection.Modify([&](auto& newCollection)
+            {
+                newCollection.push_back(element);
+            });
+            return LinqContainer(std::move(_collection));
+        }
+
+        /// @brief 
+        /// @param element 
+        /// @return 
+        LinqContainer PushBack(TSource&& element) const& noexcept
+        {
+            std::pmr::vector<TSource> newCollection(_collection.Resource());
             newCollection.reserve(_collection.size() + 1);
 
             std::copy(_collection.cbegin(), _collection.cend(),
@@ -1531,15 +2301,27 @@ namespace ExtendedCpp::LINQ
             return LinqContainer(std::move(newCollection));
         }
 
+        /// @brief 
+        /// @param element 
+        /// @return 
+        LinqContainer PushBack(TSource&& element) && noexcept
+        {
+            _collection.Modify([&](auto& newCollection)
+            {
+                newCollection.push_back(std::move(element));
+            });
+            return LinqContainer(std::move(_collection));
+        }
+
         /// @brief 
         /// @tparam TCollection 
         /// @param otherCollection 
         /// @return 
         template<typename TCollection>
         requires Concepts::ConstIterable<TCollection> && Concepts::HasSize<TCollection>
-        LinqContainer PushBack(const TCollection& otherCollection) const noexcept
+        LinqContainer PushBack(const TCollection& otherCollection) const& noexcept
         {
-            std::vector<TSource> newCollection;
+            std::pmr::vector<TSource> newCollection(_collection.Resource());
             newCollection.reserve(_collection.size() + otherCollection.size());
 
             std::copy(_collection.cbegin(), _collection.cend(),
@@ -1551,10 +2333,25 @@ namespace ExtendedCpp::LINQ
             return LinqContainer(std::move(newCollection));
         }
 
+        /// @brief 
+        /// @tparam TCollection 
+        /// @param otherCollection 
+        /// @return 
+        template<typename TCollection>
+        requires Concepts::ConstIterable<TCollection> && Concepts::HasSize<TCollection>
+        LinqContainer PushBack(const TCollection& otherCollection) && noexcept
+        {
+            _collection.Modify([&](auto& newCollection)
+            {
+                newCollection.insert(newCollection.end(), otherCollection.cbegin(), otherCollection.cend());
+            });
+            return LinqContainer(std::move(_collection));
+        }
+
         /// @brief 
         /// @param element 
         /// @return 
-        LinqContainer PushFront(const TSource& element) const noexcept
+        LinqContainer PushFront(const TSource& element) const& noexcept
         {
             return Insert(std::forward<TSource>(element), 0);
         }
@@ -1562,29 +2359,56 @@ namespace ExtendedCpp::LINQ
         /// @brief 
         /// @param element 
         /// @return 
-        LinqContainer PushFront(TSource&& element) const noexcept
+        LinqContainer PushFront(const TSource& element) && noexcept
+        {
+            return std::move(*this).Insert(element, 0);
+        }
+
+        /// @brief 
+        /// @param element 
+        /// @return 
+        LinqContainer PushFront(TSource&& element) const& noexcept
         {
             return Insert(std::forward<TSource>(element), 0);
         }
 
+        /// @brief 
+        /// @param element 
+        /// @return 
+        LinqContainer PushFront(TSource&& element) && noexcept
+        {
+            return std::move(*this).Insert(std::move(element), 0);
+        }
+
         /// @brief 
         /// @tparam TCollection 
         /// @param otherCollection 
         /// @return 
         template<typename TCollection>
         requires Concepts::ConstIterable<TCollection> && Concepts::HasSize<TCollection>
-        LinqContainer PushFront(const TCollection& otherCollection) const noexcept
+        LinqContainer PushFront(const TCollection& otherCollection) const& noexcept
         {
             return Insert(otherCollection, 0);
         }
 
+        /// @brief 
+        /// @tparam TCollection 
+        /// @param otherCollection 
+        /// @return 
+        template<typename TCollection>
+        requires Concepts::ConstIterable<TCollection> && Concepts::HasSize<TCollection>
+        LinqContainer PushFront(const TCollection& otherCollection) && noexcept
+        {
+            return std::move(*this).Insert(otherCollection, 0);
+        }
+
         /// @brief 
         /// @param element 
         /// @param position 
         /// @return 
-        LinqContainer Insert(const TSource& element, const std::size_t position) const noexcept
+        LinqContainer Insert(const TSource& element, const std::size_t position) const& noexcept
         {
-            std::vector<TSource> newCollection;
+            std::pmr::vector<TSource> newCollection(_collection.Resource());
             newCollection.reserve(_collection.size() + 1);
 
             std::copy(_collection.cbegin(), _collection.cbegin() + position,
@@ -1602,9 +2426,22 @@ namespace ExtendedCpp::LINQ
         /// @param element 
         /// @param position 
         /// @return 
-        LinqContainer Insert(TSource&& element, const std::size_t position) const noexcept
+        LinqContainer Insert(const TSource& element, const std::size_t position) && noexcept
         {
-            std::vector<std::decay_t<TSource>> newCollection;
+            _collection.Modify([&](auto& newCollection)
+            {
+                newCollection.insert(newCollection.begin() + position, element);
+            });
+            return LinqContainer(std::move(_collection));
+        }
+
+        /// @brief 
+        /// @param element 
+        /// @param position 
+        /// @return 
+        LinqContainer Insert(TSource&& element, const std::size_t position) const& noexcept
+        {
+            std::pmr::vector<std::decay_t<TSource>> newCollection(_collection.Resource());
             newCollection.reserve(_collection.size() + 1);
 
             std::copy(_collection.cbegin(), _collection.cbegin() + position,
@@ -1618,6 +2455,19 @@ namespace ExtendedCpp::LINQ
             return LinqContainer(std::move(newCollection));
         }
 
+        /// @brief 
+        /// @param element 
+        /// @param position 
+        /// @return 
+        LinqContainer Insert(TSource&& element, const std::size_t position) && noexcept
+        {
+            _collection.Modify([&](auto& newCollection)
+            {
+                newCollection.insert(newCollection.begin() + position, std::move(element));
+            });
+            return LinqContainer(std::move(_collection));
+        }
+
         /// @brief 
         /// @tparam TCollection 
         /// @param otherCollection 
@@ -1625,9 +2475,9 @@ namespace ExtendedCpp::LINQ
         /// @return 
         template<typename TCollection>
         requires Concepts::ConstIterable<TCollection> && Concepts::HasSize<TCollection>
-        LinqContainer Insert(const TCollection& otherCollection, const std::size_t position) const noexcept
+        LinqContainer Insert(const TCollection& otherCollection, const std::size_t position) const& noexcept
         {
-            std::vector<TSource> newCollection;
+            std::pmr::vector<TSource> newCollection(_collection.Resource());
             newCollection.reserve(_collection.size() + otherCollection.size());
 
             std::copy(_collection.cbegin(), _collection.cbegin() + position,
@@ -1642,24 +2492,52 @@ namespace ExtendedCpp::LINQ
             return LinqContainer(std::move(newCollection));
         }
 
+        /// @brief 
+        /// @tparam TCollection 
+        /// @param otherCollection 
+        /// @param position 
+        /// @return 
+        template<typename TCollection>
+        requires Concepts::ConstIterable<TCollection> && Concepts::HasSize<TCollection>
+        LinqContainer Insert(const TCollection& otherCollection, const std::size_t position) && noexcept
+        {
+            _collection.Modify([&](auto& newCollection)
+            {
+                newCollection.insert(newCollection.begin() + position, otherCollection.cbegin(), otherCollection.cend());
+            });
+            return LinqContainer(std::move(_collection));
+        }
+
         /// @brief 
         /// @param position 
         /// @return 
-        LinqContainer Erase(const std::size_t position) const noexcept
+        LinqContainer Erase(const std::size_t position) const& noexcept
         {
             return Erase(position, position);
         }
 
         /// @brief 
+        /// @param position 
+        /// @return 
+        LinqContainer Erase(const std::size_t position) && noexcept
+        {
+            return std::move(*this).Erase(position, position);
+        }
+
+        /// @brief Erasing of the first or the last elements gives a slice of the same storage
         /// @param begin 
         /// @param end 
         /// @return 
-        LinqContainer Erase(const std::size_t begin, const std::size_t end) const noexcept
+        LinqContainer Erase(const std::size_t begin, const std::size_t end) const& noexcept
         {
-            std::vector<TSource> newCollection;
+            std::pmr::vector<TSource> newCollection(_collection.Resource());
 
             if (begin > end || _collection.size() <= end - begin)
                 return LinqContainer(std::move(newCollection));
+            if (begin == 0)
+                return LinqContainer(_collection.Slice(end + 1, _collection.size() - end - 1));
+            if (end + 1 == _collection.size())
+                return LinqContainer(_collection.Slice(0, begin));
 
             newCollection.reserve(_collection.size() - (end - begin));
 
@@ -1671,7 +2549,71 @@ namespace ExtendedCpp::LINQ
 
             return LinqContainer(std::move(newCollection));
         }
+
+        /// @brief 
+        /// @param begin 
+        /// @param end 
+        /// @return 
+        LinqContainer Erase(const std::size_t begin, const std::size_t end) && noexcept
+        {
+            if (begin <= end && end - begin < _collection.size())
+            {
+                if (begin == 0)
+                {
+                    const std::size_t size = _collection.size() - end - 1;
+                    return LinqContainer(std::move(_collection).Slice(end + 1, size));
+                }
+                if (end + 1 == _collection.size())
+                    return LinqContainer(std::move(_collection).Slice(0, begin));
+            }
+
+            _collection.Modify([&](auto& newCollection)
+            {
+                if (begin > end || newCollection.size() <= end - begin)
+                    newCollection.clear();
+                else
+                    newCollection.erase(newCollection.begin() + begin, newCollection.begin() + end + 1);
+            });
+            return LinqContainer(std::move(_collection));
+        }
+
+    private:
+        explicit LinqContainer(CowVector<TSource>&& collection) noexcept :
+            _collection(std::move(collection)) {}
+
+        template<typename TKey, typename TKeySelector>
+        std::pmr::map<TKey, std::pmr::vector<TSource>> GroupByKey(TKeySelector& keySelector) const
+        {
+            std::pmr::map<TKey, std::pmr::vector<TSource>> groups(_collection.Resource());
+            for (const TSource& element : _collection)
+                groups.try_emplace(keySelector(element)).first->second.push_back(element);
+
+            return groups;
+        }
+
+        template<typename TKeys>
+        LinqContainer TopKByKeys(const std::size_t count, const TKeys& keys, const OrderType orderType,
+                                 const std::size_t threadCount) const
+        {
+            std::pmr::vector<std::size_t> indexes(_collection.size(), _collection.Resource());
+            std::iota(indexes.begin(), indexes.end(), 0);
+
+            if (orderType == OrderType::ASC)
+                Sort::ParallelTopKRange(indexes, 0, indexes.size(), count, [&keys](const std::size_t left, const std::size_t right)
+                    { return keys[left] < keys[right] || (keys[left] == keys[right] && left < right); }, threadCount);
+            else
+                Sort::ParallelTopKRange(indexes, 0, indexes.size(), count, [&keys](const std::size_t left, const std::size_t right)
+                    { return keys[left] > keys[right] || (keys[left] == keys[right] && left < right); }, threadCount);
+
+            const std::size_t size = std::min(count, indexes.size());
+            std::pmr::vector<TSource> newCollection(_collection.Resource());
+            newCollection.reserve(size);
+            for (std::size_t i = 0; i < size; ++i)
+                newCollection.push_back(_collection[indexes[i]]);
+
+            return LinqContainer(std::move(newCollection));
+        }
     };
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -17,6 +17,9 @@
 #include <vector>
 #include <concepts>
 #include <locale>
+#include <algorithm>
+#include <bit>
+#include <optional>
 
 #include <ExtendedCpp/LINQ/YieldForeach.h>
 #include <ExtendedCpp/LINQ/Aggregate.h>
@@ -24,6 +27,8 @@
 #include <ExtendedCpp/LINQ/TypeTraits.h>
 #include <ExtendedCpp/LINQ/Concepts.h>
 #include <ExtendedCpp/LINQ/OrderType.h>
+#include <ExtendedCpp/LINQ/Parallel.h>
+#include <ExtendedCpp/LINQ/SummationType.h>
 #include <ExtendedCpp/LINQ/Future.h>
 
 /// @brief 
@@ -43,10 +48,8 @@ namespace ExtendedCpp::LINQ
 			Iterator(Future<TSource>& yieldContext, bool isEnd) noexcept :
 				_yieldContext(yieldContext), _isEnd(isEnd)
 			{
-				if (_yieldContext)
-					_value = _yieldContext.Value();
-				else
-					_isEnd = true;
+				if (!_isEnd)
+					++*this;
 			}
 
 			TSource& operator*() noexcept
@@ -390,7 +393,8 @@ namespace ExtendedCpp::LINQ
 						std::forward<TPredicate>(predicate));
 		}
 
-		/// @brief Sorts the elements of a collection
+		/// @brief Sorts the elements of a collection lazily: only the part of the collection
+		/// in front of the next element is partitioned, so Order().Take(k) does not sort the whole collection
 		/// @param orderType 
 		/// @return 
 		LinqGenerator Order(OrderType orderType = OrderType::ASC) noexcept
@@ -399,16 +403,24 @@ namespace ExtendedCpp::LINQ
 			std::vector<TSource> newCollection;
 			while (_yieldContext)
 				newCollection.push_back(_yieldContext.Next());
-			if (newCollection.empty())
-				return *this;
 
-			Sort::QuickSort(newCollection.data(), 0, newCollection.size() - 1, orderType);
+			constexpr bool branchless = std::is_arithmetic_v<TSource> || std::is_pointer_v<TSource>;
+			auto extract = [](TSource& element) { return std::move(element); };
 
-			return LinqGenerator([this, newCollection = std::move(newCollection)]()
-				{ return Generator(newCollection); });
+			if (orderType == OrderType::ASC)
+				return LinqGenerator([this, &newCollection, &extract]()
+					{ return OrderGenerator(std::move(newCollection),
+											[](const TSource& left, const TSource& right) { return left < right; },
+											extract, branchless); });
+			else
+				return LinqGenerator([this, &newCollection, &extract]()
+					{ return OrderGenerator(std::move(newCollection),
+											[](const TSource& left, const TSource& right) { return left > right; },
+											extract, branchless); });
 		}
 
-		/// @brief Sorts the elements of a collection with selector
+		/// @brief Stably sorts the elements of a collection with selector, which is invoked once per element.
+		/// Sorting is lazy as in Order
 		/// @tparam TSelector 
 		/// @param selector 
 		/// @param orderType 
@@ -416,19 +428,75 @@ namespace ExtendedCpp::LINQ
 		template<std::invocable<TSource> TSelector>
 		requires Concepts::Comparable<std::invoke_result_t<TSelector, TSource>>
 		LinqGenerator OrderBy(TSelector&& selector, OrderType orderType = OrderType::ASC)
-		noexcept(std::is_nothrow_invocable_v<TSelector, TSource>)
 		{
+			using TKey = std::decay_t<std::invoke_result_t<TSelector, TSource>>;
+
 			std::vector<TSource> newCollection;
+			std::vector<TKey> keys;
+			std::vector<std::size_t> indexes;
 			while (_yieldContext)
+			{
 				newCollection.push_back(_yieldContext.Next());
-			if (newCollection.empty())
-				return *this;
+				keys.push_back(selector(newCollection.back()));
+				indexes.push_back(indexes.size());
+			}
 
-			Sort::QuickSort(newCollection.data(), 0, newCollection.size() - 1,
-							std::forward<TSelector>(selector), orderType);
+			auto extract = [collection = std::move(newCollection)](const std::size_t index) mutable
+				{ return std::move(collection[index]); };
 
-			return LinqGenerator([this, newCollection = std::move(newCollection)]()
-				{ return Generator(newCollection); });
+			if (orderType == OrderType::ASC)
+				return LinqGenerator([this, &indexes, &keys, &extract]()
+					{ return OrderGenerator(std::move(indexes),
+											[keys = std::move(keys)](const std::size_t left, const std::size_t right)
+											{ return keys[left] < keys[right] || (keys[left] == keys[right] && left < right); },
+											std::move(extract), false); });
+			else
+				return LinqGenerator([this, &indexes, &keys, &extract]()
+					{ return OrderGenerator(std::move(indexes),
+											[keys = std::move(keys)](const std::size_t left, const std::size_t right)
+											{ return keys[left] > keys[right] || (keys[left] == keys[right] && left < right); },
+											std::move(extract), false); });
+		}
+
+		/// @brief Retrieves the count first elements of the sorted collection without sorting the whole collection
+		/// @param count 
+		/// @param orderType 
+		/// @return 
+		LinqGenerator TopK(const std::size_t count, OrderType orderType = OrderType::ASC) noexcept
+		requires Concepts::Comparable<TSource>
+		{
+			std::vector<TSource> newCollection;
+			while (_yieldContext)
+				newCollection.push_back(_yieldContext.Next());
+
+			if (!newCollection.empty())
+				Sort::TopK(newCollection.data(), 0, newCollection.size() - 1, count, orderType);
+			newCollection.resize(std::min(count, newCollection.size()));
+
+			return LinqGenerator(std::move(newCollection));
+		}
+
+		/// @brief Retrieves the count first elements of the collection stably sorted with selector,
+		/// which is invoked once per element
+		/// @tparam TSelector 
+		/// @param count 
+		/// @param selector 
+		/// @param orderType 
+		/// @return 
+		template<std::invocable<TSource> TSelector>
+		requires Concepts::Comparable<std::invoke_result_t<TSelector, TSource>>
+		LinqGenerator TopK(const std::size_t count, TSelector&& selector, OrderType orderType = OrderType::ASC)
+		{
+			std::vector<TSource> newCollection;
+			while (_yieldContext)
+				newCollection.push_back(_yieldContext.Next());
+
+			if (!newCollection.empty())
+				Sort::TopK(newCollection.data(), 0, newCollection.size() - 1, count,
+						   std::forward<TSelector>(selector), orderType);
+			newCollection.resize(std::min(count, newCollection.size()));
+
+			return LinqGenerator(std::move(newCollection));
 		}
 
 		/// @brief Reverse the collection
@@ -682,6 +750,45 @@ namespace ExtendedCpp::LINQ
 			return Aggregate::Sum(collection.data(), 0, collection.size() - 1, std::forward<TSelector>(selector));
 		}
 
+		/// @brief Get the sum of floating point values with the given order of additions. After this method generator became invalid
+		/// @param summationType 
+		/// @param parallel Execution options of PARALLEL_PAIRWISE
+		/// @return 
+		TSource Sum(const SummationType summationType, const Parallel parallel = {})
+		requires std::floating_point<TSource>
+		{
+			std::vector<TSource> collection;
+			while (_yieldContext)
+				collection.push_back(_yieldContext.Next());
+
+			if (collection.empty())
+				throw std::out_of_range("Collection is empty");
+
+			return Aggregate::Sum(collection.data(), 0, collection.size() - 1, summationType, parallel.ThreadCount);
+		}
+
+		/// @brief Get the sum of floating point values with the given order of additions. After this method generator became invalid
+		/// @tparam TSelector Must be safe to invoke concurrently for PARALLEL_PAIRWISE
+		/// @tparam TResult 
+		/// @param selector 
+		/// @param summationType 
+		/// @param parallel Execution options of PARALLEL_PAIRWISE
+		/// @return 
+		template<std::invocable<TSource> TSelector,
+				 std::floating_point TResult = std::invoke_result_t<TSelector, TSource>>
+		TResult Sum(TSelector&& selector, const SummationType summationType, const Parallel parallel = {})
+		{
+			std::vector<TSource> collection;
+			while (_yieldContext)
+				collection.push_back(_yieldContext.Next());
+
+			if (collection.empty())
+				throw std::out_of_range("Collection is empty");
+
+			return Aggregate::Sum(collection.data(), 0, collection.size() - 1, std::forward<TSelector>(selector),
+								  summationType, parallel.ThreadCount);
+		}
+
 		/// @brief Find element with the minimum value. After this method generator became invalid
 		/// @return 
 		TSource Min()
@@ -750,6 +857,40 @@ namespace ExtendedCpp::LINQ
 			return Aggregate::Max(collection.data(), 0, collection.size() - 1, std::forward<TSelector>(selector));
 		}
 
+		/// @brief Find elements with the minimum and the maximum value in one pass. After this method generator became invalid
+		/// @return Minimum and maximum
+		std::pair<TSource, TSource> MinMax()
+		requires Concepts::Comparable<TSource>
+		{
+			std::vector<TSource> collection;
+			while (_yieldContext)
+				collection.push_back(_yieldContext.Next());
+
+			if (collection.empty())
+				throw std::out_of_range("Collection is empty");
+
+			return Aggregate::MinMax(collection.data(), 0, collection.size() - 1);
+		}
+
+		/// @brief Find the minimum and the maximum value in one pass. After this method generator became invalid
+		/// @tparam TSelector 
+		/// @tparam TResult 
+		/// @param selector 
+		/// @return Minimum and maximum
+		template<std::invocable<TSource> TSelector,
+				 Concepts::Comparable TResult = std::invoke_result_t<TSelector, TSource>>
+		std::pair<TResult, TResult> MinMax(TSelector&& selector)
+		{
+			std::vector<TSource> collection;
+			while (_yieldContext)
+				collection.push_back(_yieldContext.Next());
+
+			if (collection.empty())
+				throw std::out_of_range("Collection is empty");
+
+			return Aggregate::MinMax(collection.data(), 0, collection.size() - 1, std::forward<TSelector>(selector));
+		}
+
 		/// @brief Find the average value of the collection. After this method generator became invalid
 		/// @return 
 		TSource Average()
@@ -785,6 +926,45 @@ namespace ExtendedCpp::LINQ
 									  std::forward<TSelector>(selector));
 		}
 
+		/// @brief Find the average of floating point values with the given order of additions. After this method generator became invalid
+		/// @param summationType 
+		/// @param parallel Execution options of PARALLEL_PAIRWISE
+		/// @return 
+		TSource Average(const SummationType summationType, const Parallel parallel = {})
+		requires std::floating_point<TSource>
+		{
+			std::vector<TSource> collection;
+			while (_yieldContext)
+				collection.push_back(_yieldContext.Next());
+
+			if (collection.empty())
+				throw std::out_of_range("Collection is empty");
+
+			return Aggregate::Average(collection.data(), 0, collection.size() - 1, summationType, parallel.ThreadCount);
+		}
+
+		/// @brief Find the average of floating point values with the given order of additions. After this method generator became invalid
+		/// @tparam TSelector Must be safe to invoke concurrently for PARALLEL_PAIRWISE
+		/// @tparam TResult 
+		/// @param selector 
+		/// @param summationType 
+		/// @param parallel Execution options of PARALLEL_PAIRWISE
+		/// @return 
+		template<std::invocable<TSource> TSelector,
+				 std::floating_point TResult = std::invoke_result_t<TSelector, TSource>>
+		TResult Average(TSelector&& selector, const SummationType summationType, const Parallel parallel = {})
+		{
+			std::vector<TSource> collection;
+			while (_yieldContext)
+				collection.push_back(_yieldContext.Next());
+
+			if (collection.empty())
+				throw std::out_of_range("Collection is empty");
+
+			return Aggregate::Average(collection.data(), 0, collection.size() - 1,
+									  std::forward<TSelector>(selector), summationType, parallel.ThreadCount);
+		}
+
 		/// @brief Skips a certain number of elements
 		/// @param count 
 		/// @return 
@@ -828,6 +1008,42 @@ namespace ExtendedCpp::LINQ
 						std::forward<TPredicate>(predicate));
 		}
 
+		/// @brief Split the sequence into vectors of size elements, the last vector may be shorter.
+		/// Generator has no storage to point into, so elements are moved into the vectors
+		/// @param size 
+		/// @return 
+		LinqGenerator<std::vector<TSource>> Chunk(const std::size_t size)
+		{
+			if (size == 0)
+				throw std::invalid_argument("Chunk size must be greater than zero");
+			return LinqGenerator<std::vector<TSource>>([this](const std::size_t size_)
+				{ return ChunkGenerator(size_); }, size);
+		}
+
+		/// @brief Sliding windows of exactly size elements, each next window starts step elements after the previous one.
+		/// Only step new elements are read for every window, elements shared by windows are copied
+		/// @param size 
+		/// @param step 
+		/// @return 
+		LinqGenerator<std::vector<TSource>> Window(const std::size_t size, const std::size_t step = 1)
+		{
+			if (size == 0 || step == 0)
+				throw std::invalid_argument("Window size and step must be greater than zero");
+			return LinqGenerator<std::vector<TSource>>([this](const std::size_t size_, const std::size_t step_)
+				{ return WindowGenerator(size_, step_); }, size, step);
+		}
+
+		/// @brief Split the sequence into vectors of size elements, the last vector may be shorter
+		/// @param size 
+		/// @return 
+		LinqGenerator<std::vector<TSource>> Batch(const std::size_t size)
+		{
+			if (size == 0)
+				throw std::invalid_argument("Batch size must be greater than zero");
+			return LinqGenerator<std::vector<TSource>>([this](const std::size_t size_)
+				{ return ChunkGenerator(size_); }, size);
+		}
+
 		/// @brief Group data by certain parameters
 		/// @tparam TKey 
 		/// @tparam TKeySelector 
@@ -1092,6 +1308,67 @@ namespace ExtendedCpp::LINQ
 				co_yield std::move(*it);
 		}
 
+		/// Incremental quicksort: the stack keeps the pivots of the unsorted suffix, the front partition is split
+		/// until it is small enough to be sorted by insertion, so k elements cost O(n + k log k)
+		template<typename TElement, typename TLess, typename TExtract>
+		Future<TSource> OrderGenerator(std::vector<TElement> collection, TLess less, TExtract extract,
+									   const bool branchless)
+		{
+			const std::size_t size = collection.size();
+			std::vector<std::size_t> bounds { size };
+			auto badAllowed = static_cast<std::size_t>(std::bit_width(size));
+			std::size_t next = 0;
+
+			// Elements in front of next may be moved out by extract, so the pivot, which bounds the front
+			// partition from below, is kept for the check of equal pivots. Move-only elements skip that check.
+			std::optional<TElement> previousPivot;
+
+			while (next < size)
+			{
+				const std::size_t last = bounds.back();
+
+				if (last - next < Sort::INSERTION_SORT_THRESHOLD)
+				{
+					Sort::PdqInsertionSort(collection, next, last, less);
+					while (next < last)
+						co_yield extract(collection[next++]);
+					bounds.pop_back();
+					if (next < size)
+					{
+						if constexpr (std::copyable<TElement>)
+							previousPivot = collection[next];
+						co_yield extract(collection[next++]);
+					}
+					continue;
+				}
+
+				Sort::PdqChoosePivot(collection, next, last, less);
+
+				if (previousPivot && !less(*previousPivot, collection[next]))
+				{
+					const std::size_t equalEnd = Sort::PdqPartitionLeft(collection, next, last, less) + 1;
+					while (next < equalEnd)
+						co_yield extract(collection[next++]);
+					continue;
+				}
+
+				const std::size_t pivotPosition = branchless
+					? Sort::PdqPartitionRightBranchless(collection, next, last, less).first
+					: Sort::PdqPartitionRight(collection, next, last, less).first;
+
+				if ((pivotPosition - next < (last - next) / 8 || last - (pivotPosition + 1) < (last - next) / 8) &&
+					--badAllowed == 0)
+				{
+					Sort::PdqSort(collection, next, size, less, branchless);
+					while (next < size)
+						co_yield extract(collection[next++]);
+					co_return;
+				}
+
+				bounds.push_back(pivotPosition);
+			}
+		}
+
 		template<std::invocable<TSource&> TTransform>
         requires std::same_as<std::invoke_result_t<TTransform, TSource&>, void>
         Future<TSource> TransformGenerator(TTransform&& transform)
@@ -1145,15 +1422,26 @@ namespace ExtendedCpp::LINQ
 			}
 		}
 
+		// Filtering operators test the current value of the source in place and pass it on
+		// by reference, the value is copied or moved once by the final consumer only.
+		template<typename TPredicate>
+		static bool Matches(TPredicate& predicate, const TSource& element)
+		{
+			if constexpr (std::is_invocable_v<TPredicate&, const TSource&>)
+				return predicate(element);
+			else
+				return predicate(TSource(element));
+		}
+
 		template<Concepts::IsPredicate<TSource> TPredicate>
 		Future<TSource> WhereGenerator(TPredicate&& predicate)
 		noexcept(std::is_nothrow_invocable_v<TPredicate, TSource>)
 		{
 			while (_yieldContext)
 			{
-				auto element = _yieldContext.Next();
-				if (predicate(element))
-					co_yield element;
+				if (Matches(predicate, _yieldContext.Current()))
+					co_yield _yieldContext;
+				_yieldContext.Skip();
 			}
 		}
 
@@ -1163,11 +1451,9 @@ namespace ExtendedCpp::LINQ
 		{
 			while (_yieldContext)
 			{
-				auto element = _yieldContext.Next();
-				if (predicate(element))
-					continue;
-				else
-					co_yield element;
+				if (!Matches(predicate, _yieldContext.Current()))
+					co_yield _yieldContext;
+				_yieldContext.Skip();
 			}
 		}
 
@@ -1176,30 +1462,29 @@ namespace ExtendedCpp::LINQ
 			std::size_t i = 0;
 			while (_yieldContext && i < count)
 			{
-				_yieldContext.Next();
+				_yieldContext.Skip();
 				++i;
 			}
 
 			while (_yieldContext)
-				co_yield _yieldContext.Next();
+			{
+				co_yield _yieldContext;
+				_yieldContext.Skip();
+			}
 		}
 
 		template<Concepts::IsPredicate<TSource> TPredicate>
 		Future<TSource> SkipWhileGenerator(TPredicate&& predicate)
 		noexcept(std::is_nothrow_invocable_v<TPredicate, TSource>)
 		{
+			while (_yieldContext && Matches(predicate, _yieldContext.Current()))
+				_yieldContext.Skip();
+
 			while (_yieldContext)
 			{
-				auto element = _yieldContext.Next();
-				if (!predicate(element))
-				{
-					co_yield std::move(element);
-					break;
-				}
+				co_yield _yieldContext;
+				_yieldContext.Skip();
 			}
-
-			while (_yieldContext)
-				co_yield _yieldContext.Next();
 		}
 
 		Future<TSource> TakeGenerator(const std::size_t count)
@@ -1207,28 +1492,67 @@ namespace ExtendedCpp::LINQ
 			std::size_t i = 0;
 			while (_yieldContext && i < count)
 			{
-				co_yield _yieldContext.Next();
+				co_yield _yieldContext;
+				_yieldContext.Skip();
 				++i;
 			}
-
-			while (_yieldContext)
-				_yieldContext.Next();
 		}
 
 		template<Concepts::IsPredicate<TSource> TPredicate>
 		Future<TSource> TakeWhileGenerator(TPredicate&& predicate)
 		noexcept(std::is_nothrow_invocable_v<TPredicate, TSource>)
 		{
-			while (_yieldContext)
+			while (_yieldContext && Matches(predicate, _yieldContext.Current()))
 			{
-				auto element = _yieldContext.Next();
-				if (!predicate(element))
-					break;
-				co_yield element;
+				co_yield _yieldContext;
+				_yieldContext.Skip();
 			}
+		}
 
+		Future<std::vector<TSource>> ChunkGenerator(const std::size_t size)
+		{
 			while (_yieldContext)
-				_yieldContext.Next();
+			{
+				std::vector<TSource> chunk;
+				chunk.reserve(size);
+				while (_yieldContext && chunk.size() < size)
+					chunk.push_back(_yieldContext.Next());
+				co_yield std::move(chunk);
+			}
+		}
+
+		/// Window is kept at the end of the buffer, which is compacted when the consumed front outgrows the window
+		Future<std::vector<TSource>> WindowGenerator(const std::size_t size, const std::size_t step)
+		{
+			std::vector<TSource> buffer;
+			std::size_t start = 0;
+
+			while (true)
+			{
+				while (_yieldContext && buffer.size() - start < size)
+					buffer.push_back(_yieldContext.Next());
+				if (buffer.size() - start < size)
+					co_return;
+
+				co_yield std::vector<TSource>(buffer.begin() + start, buffer.begin() + start + size);
+
+				if (step >= size)
+				{
+					buffer.clear();
+					start = 0;
+					for (std::size_t skipped = size; skipped < step && _yieldContext; ++skipped)
+						_yieldContext.Skip();
+				}
+				else
+				{
+					start += step;
+					if (start >= size)
+					{
+						buffer.erase(buffer.begin(), buffer.begin() + start);
+						start = 0;
+					}
+				}
+			}
 		}
 
 		template<std::invocable<TSource> TKeySelector,
@@ -13,10 +13,12 @@
 #include <unordered_map>
 #include <deque>
 #include <concepts>
-#include <optional>
+#include <iterator>
+#include <ranges>
 #include <type_traits>
 #include <utility>
 #include <locale>
+#include <stdexcept>
 
 #include <ExtendedCpp/LINQ/Iterators.h>
 #include <ExtendedCpp/LINQ/Concepts.h>
@@ -25,10 +27,15 @@
 /// @brief 
 namespace ExtendedCpp::LINQ
 {
-	/// @brief 
+	/// @brief Lazy sequence over a pair of iterators. Filtering operators skip ahead on increment
+	/// and pass elements of the source by reference, so a chain runs as a single loop.
+	/// Every view is a std::ranges::view. Algorithms taking an execution policy need legacy forward iterators,
+	/// so they accept views yielding references: the source itself, Where, Take, TakeWhile and Select
+	/// returning a reference. Select returning a value, Transform, Join, Zip, Chunk and Window produce values,
+	/// these views are passed to the std::ranges algorithms or materialized by ToVector first
 	/// @tparam TIterator 
-	template<Concepts::OptionalIter TIterator>
-	class LinqView final
+	template<std::forward_iterator TIterator>
+	class LinqView final : public std::ranges::view_interface<LinqView<TIterator>>
 	{
 	private:
 		TIterator _begin;
@@ -36,7 +43,7 @@ namespace ExtendedCpp::LINQ
 
 	public:
 		/// @brief 
-		using value_type = TIterator::value_type;
+		using value_type = std::iter_value_t<TIterator>;
 
 		/// @brief 
 		using iterator = TIterator;
@@ -44,6 +51,9 @@ namespace ExtendedCpp::LINQ
 		/// @brief 
 		using const_iterator = TIterator;
 
+		/// @brief 
+		LinqView() = default;
+
 		/// @brief 
 		/// @param begin 
 		/// @param end 
@@ -81,16 +91,13 @@ namespace ExtendedCpp::LINQ
 		/// @brief 
 		/// @return 
 		[[nodiscard]]
-		std::vector<value_type> ToVector() const 
-		noexcept(std::is_nothrow_invocable_v<decltype(&TIterator::operator*)>)
+		std::vector<value_type> ToVector() const
 		{
 			std::vector<value_type> collection;
+			if constexpr (std::random_access_iterator<TIterator>)
+				collection.reserve(static_cast<std::size_t>(_end - _begin));
 			for (TIterator it = _begin; it != _end; ++it)
-			{
-				std::optional<value_type> opt = *it;
-				if (opt.has_value())
-					collection.push_back(opt.value());
-			}
+				collection.push_back(*it);
 			return collection;
 		}
 
@@ -98,143 +105,98 @@ namespace ExtendedCpp::LINQ
 		/// @tparam SIZE 
 		/// @return 
 		template<std::size_t SIZE>
-		std::array<value_type, SIZE> ToArray() const 
-		noexcept(std::is_nothrow_invocable_v<decltype(&TIterator::operator*)>)
+		std::array<value_type, SIZE> ToArray() const
 		{
 			std::array<value_type, SIZE> array;
 			std::size_t i = 0;
 			for (TIterator it = _begin; it != _end && i < SIZE; ++it, ++i)
-			{
-				std::optional<value_type> opt = *it;
-				if (opt.has_value())
-					array[i] = opt.value();
-			}
+				array[i] = *it;
 			return array;
 		}
 
 		/// @brief 
 		/// @return 
 		[[nodiscard]]
-		std::list<value_type> ToList() const 
-		noexcept(std::is_nothrow_invocable_v<decltype(&TIterator::operator*)>)
+		std::list<value_type> ToList() const
 		{
 			std::list<value_type> collection;
 			for (TIterator it = _begin; it != _end; ++it)
-			{
-				std::optional<value_type> opt = *it;
-				if (opt.has_value())
-					collection.push_back(opt.value());
-			}
+				collection.push_back(*it);
 			return collection;
 		}
 
 		/// @brief 
 		/// @return 
 		[[nodiscard]]
-		std::forward_list<value_type> ToForwardList() const 
-		noexcept(std::is_nothrow_invocable_v<decltype(&TIterator::operator*)>)
+		std::forward_list<value_type> ToForwardList() const
 		{
 			std::forward_list<value_type> collection;
 			for (TIterator it = _begin; it != _end; ++it)
-			{
-				std::optional<value_type> opt = *it;
-				if (opt.has_value())
-					collection.push_front(opt.value());
-			}
+				collection.push_front(*it);
 			return collection;
 		}
 
 		/// @brief 
 		/// @return 
 		[[nodiscard]]
-		std::stack<value_type> ToStack() const 
-		noexcept(std::is_nothrow_invocable_v<decltype(&TIterator::operator*)>)
+		std::stack<value_type> ToStack() const
 		{
 			std::stack<value_type> stack;
 			for (TIterator it = _begin; it != _end; ++it)
-			{
-				std::optional<value_type> opt = *it;
-				if (opt.has_value())
-					stack.push(opt.value());
-			}
+				stack.push(*it);
 			return stack;
 		}
 
 		/// @brief 
 		/// @return 
 		[[nodiscard]]
-		std::queue<value_type> ToQueue() const 
-		noexcept(std::is_nothrow_invocable_v<decltype(&TIterator::operator*)>)
+		std::queue<value_type> ToQueue() const
 		{
 			std::queue<value_type> queue;
 			for (TIterator it = _begin; it != _end; ++it)
-			{
-				std::optional<value_type> opt = *it;
-				if (opt.has_value())
-					queue.push(opt.value());
-			}
+				queue.push(*it);
 			return queue;
 		}
 
 		/// @brief 
 		/// @return 
 		[[nodiscard]]
-		std::deque<value_type> ToDeque() const 
-		noexcept(std::is_nothrow_invocable_v<decltype(&TIterator::operator*)>)
+		std::deque<value_type> ToDeque() const
 		{
 			std::deque<value_type> deque;
 			for (TIterator it = _begin; it != _end; ++it)
-			{
-				std::optional<value_type> opt = *it;
-				if (opt.has_value())
-					deque.push_back(opt.value());
-			}
+				deque.push_back(*it);
 			return deque;
 		}
 
 		/// @brief 
 		/// @return 
 		[[nodiscard]]
-		std::priority_queue<value_type> ToPriorityQueue() const 
-		noexcept(std::is_nothrow_invocable_v<decltype(&TIterator::operator*)>)
+		std::priority_queue<value_type> ToPriorityQueue() const
 		{
 			std::priority_queue<value_type> priorityQueue;
 			for (TIterator it = _begin; it != _end; ++it)
-			{
-				std::optional<value_type> opt = *it;
-				if (opt.has_value())
-					priorityQueue.push(opt.value());
-			}
+				priorityQueue.push(*it);
 			return priorityQueue;
 		}
 
 		/// @brief 
 		/// @return 
-		std::set<value_type> ToSet() const 
-		noexcept(std::is_nothrow_invocable_v<decltype(&TIterator::operator*)>)
+		std::set<value_type> ToSet() const
 		{
 			std::set<value_type> set;
 			for (TIterator it = _begin; it != _end; ++it)
-			{
-				std::optional<value_type> opt = *it;
-				if (opt.has_value())
-					set.insert(opt.value());
-			}
+				set.insert(*it);
 			return set;
 		}
 
 		/// @brief 
 		/// @return 
-		std::unordered_set<value_type> ToUnorderedSet() const 
-		noexcept(std::is_nothrow_invocable_v<decltype(&TIterator::operator*)>)
+		std::unordered_set<value_type> ToUnorderedSet() const
 		{
 			std::unordered_set<value_type> unorderedSet;
 			for (TIterator it = _begin; it != _end; ++it)
-			{
-				std::optional<value_type> opt = *it;
-				if (opt.has_value())
-					unorderedSet.insert(opt.value());
-			}
+				unorderedSet.insert(*it);
 			return unorderedSet;
 		}
 
@@ -245,16 +207,11 @@ namespace ExtendedCpp::LINQ
 		template<typename TKey = typename PairTraits<value_type>::FirstType,
 				 typename TValue = typename PairTraits<value_type>::SecondType>
 		requires Concepts::IsPair<value_type>
-		std::map<TKey, TValue> ToMap() const 
-		noexcept(std::is_nothrow_invocable_v<decltype(&TIterator::operator*)>)
+		std::map<TKey, TValue> ToMap() const
 		{
 			std::map<TKey, TValue> map;
 			for (TIterator it = _begin; it != _end; ++it)
-			{
-				std::optional<std::pair<TKey, TValue>> opt = *it;
-				if (opt.has_value())
-					map.insert(opt.value());
-			}
+				map.insert(*it);
 			return map;
 		}
 
@@ -265,16 +222,11 @@ namespace ExtendedCpp::LINQ
 		template<typename TKey = typename PairTraits<value_type>::FirstType,
 				 typename TValue = typename PairTraits<value_type>::SecondType>
 		requires Concepts::IsPair<value_type>
-		std::unordered_map<TKey, TValue> ToUnorderedMap() const 
-		noexcept(std::is_nothrow_invocable_v<decltype(&TIterator::operator*)>)
+		std::unordered_map<TKey, TValue> ToUnorderedMap() const
 		{
 			std::unordered_map<TKey, TValue> unorderedMap;
 			for (TIterator it = _begin; it != _end; ++it)
-			{
-				std::optional<std::pair<TKey, TValue>> opt = *it;
-				if (opt.has_value())
-					unorderedMap.insert(opt.value());
-			}
+				unorderedMap.insert(*it);
 			return unorderedMap;
 		}
 
@@ -284,7 +236,7 @@ namespace ExtendedCpp::LINQ
 		/// @return 
 		template<std::invocable<value_type> TMap>
 		requires std::same_as<std::invoke_result_t<TMap, value_type>, value_type>
-		LinqView<SelectorIterator<value_type, TIterator, TMap>> Map(TMap&& mapFunction) const noexcept
+		LinqView<SelectorIterator<value_type, TIterator, TMap>> Map(TMap&& mapFunction) const
 		{
 			return LinqView<SelectorIterator<value_type, TIterator, TMap>>(
 				SelectorIterator<value_type, TIterator, TMap>(_begin, std::forward<TMap>(mapFunction)),
@@ -297,7 +249,7 @@ namespace ExtendedCpp::LINQ
 		/// @return 
 		template<std::invocable<value_type&> TTransform>
 		requires std::same_as<std::invoke_result_t<TTransform, value_type&>, void>
-		LinqView<TransformIterator<TIterator, TTransform>> Transform(TTransform&& transform) const noexcept
+		LinqView<TransformIterator<TIterator, TTransform>> Transform(TTransform&& transform) const
 		{
 			return LinqView<TransformIterator<TIterator, TTransform>>(
 				TransformIterator<TIterator, TTransform>(_begin, std::forward<TTransform>(transform)),
@@ -310,7 +262,7 @@ namespace ExtendedCpp::LINQ
 		/// @param selector 
 		/// @return 
 		template<std::invocable<value_type> TSelector, typename TResult = std::invoke_result_t<TSelector, value_type>>
-		LinqView<SelectorIterator<TResult, TIterator, TSelector>> Select(TSelector&& selector) const noexcept
+		LinqView<SelectorIterator<TResult, TIterator, TSelector>> Select(TSelector&& selector) const
 		{
 			return LinqView<SelectorIterator<TResult, TIterator, TSelector>>(
 				SelectorIterator<TResult, TIterator, TSelector>(_begin, std::forward<TSelector>(selector)),
@@ -322,10 +274,10 @@ namespace ExtendedCpp::LINQ
 		/// @param predicate 
 		/// @return 
 		template<Concepts::IsPredicate<value_type> TPredicate>
-		LinqView<WhereIterator<TIterator, TPredicate>> Where(TPredicate&& predicate) const noexcept
+		LinqView<WhereIterator<TIterator, TPredicate>> Where(TPredicate&& predicate) const
 		{
 			return LinqView<WhereIterator<TIterator, TPredicate>>(
-				WhereIterator<TIterator, TPredicate>(_begin, std::forward<TPredicate>(predicate)),
+				WhereIterator<TIterator, TPredicate>(_begin, _end, std::forward<TPredicate>(predicate)),
 				WhereIterator<TIterator, TPredicate>(_end));
 		}
 
@@ -334,10 +286,10 @@ namespace ExtendedCpp::LINQ
 		/// @param predicate 
 		/// @return 
 		template<Concepts::IsPredicate<value_type> TPredicate>
-		LinqView<RemoveWhereIterator<TIterator, TPredicate>> RemoveWhere(TPredicate&& predicate) const noexcept
+		LinqView<RemoveWhereIterator<TIterator, TPredicate>> RemoveWhere(TPredicate&& predicate) const
 		{
 			return LinqView<RemoveWhereIterator<TIterator, TPredicate>>(
-				RemoveWhereIterator<TIterator, TPredicate>(_begin, std::forward<TPredicate>(predicate)),
+				RemoveWhereIterator<TIterator, TPredicate>(_begin, _end, std::forward<TPredicate>(predicate)),
 				RemoveWhereIterator<TIterator, TPredicate>(_end));
 		}
 
@@ -348,21 +300,14 @@ namespace ExtendedCpp::LINQ
 		/// @return 
 		template<std::invocable<value_type> TKeySelector,
 				 typename TKey = std::invoke_result_t<TKeySelector, value_type>>
-		std::map<TKey, std::vector<value_type>> GroupBy(TKeySelector&& keySelector) const 
-		noexcept(std::is_nothrow_invocable_v<TKeySelector, value_type>)
+		std::map<TKey, std::vector<value_type>> GroupBy(TKeySelector&& keySelector) const
 		{
 			std::map<TKey, std::vector<value_type>> result;
 
 			for (TIterator it = _begin; it != _end; ++it)
 			{
-				std::optional<value_type> opt = *it;
-				if (opt.has_value())
-				{
-					value_type value = opt.value();
-					if (!result.contains(keySelector(value)))
-						result.insert(std::pair<TKey, std::vector<value_type>>(keySelector(value), std::vector<value_type>()));
-					result.at(keySelector(value)).push_back(value);
-				}
+				decltype(auto) value = *it;
+				result[keySelector(value)].push_back(value);
 			}
 
 			return result;
@@ -389,12 +334,13 @@ namespace ExtendedCpp::LINQ
 							  TOtherKeySelector, TResultSelector>> Join(const TOtherCollection& otherCollection,
 																		TInnerKeySelector&& innerKeySelector,
 																		TOtherKeySelector&& otherKeySelector,
-																		TResultSelector&& resultSelector) const noexcept
+																		TResultSelector&& resultSelector) const
 		{
 			return LinqView<JoinIterator<TIterator, TOtherCollection, TInnerKeySelector,
 										 TOtherKeySelector, TResultSelector>>(
 				JoinIterator<TIterator, TOtherCollection, TInnerKeySelector, TOtherKeySelector, TResultSelector>(
 					_begin,
+					_end,
 					otherCollection,
 					std::forward<TInnerKeySelector>(innerKeySelector),
 					std::forward<TOtherKeySelector>(otherKeySelector),
@@ -410,40 +356,47 @@ namespace ExtendedCpp::LINQ
 		LinqView<ZipIterator<TIterator, TOtherCollection>> Zip(const TOtherCollection& otherCollection) const noexcept
 		{
 			return LinqView<ZipIterator<TIterator, TOtherCollection>>(
-				ZipIterator<TIterator, TOtherCollection>(_begin, otherCollection),
+				ZipIterator<TIterator, TOtherCollection>(_begin, _end, otherCollection),
 				ZipIterator<TIterator, TOtherCollection>(_end));
 		}
 
-		/// @brief 
+		/// @brief Over random access iterators the result is a suffix of the same view type,
+		/// otherwise the elements are skipped on the first access to the view
 		/// @param count 
 		/// @return 
-		LinqView<SkipIterator<TIterator>> Skip(std::size_t count) const noexcept
+		auto Skip(std::size_t count) const noexcept
 		{
-			return LinqView<SkipIterator<TIterator>>(
-				SkipIterator<TIterator>(_begin, count),
-				SkipIterator<TIterator>(_end));
+			if constexpr (std::random_access_iterator<TIterator>)
+				return LinqView(std::ranges::next(_begin, static_cast<std::iter_difference_t<TIterator>>(count), _end), _end);
+			else
+				return LinqView<SkipIterator<TIterator>>(
+					SkipIterator<TIterator>(_begin, _end, count),
+					SkipIterator<TIterator>(_end));
 		}
 
-		/// @brief 
+		/// @brief The predicate is applied on the first access to the view
 		/// @tparam TPredicate 
 		/// @param predicate 
 		/// @return 
 		template<Concepts::IsPredicate<value_type> TPredicate>
-		LinqView<SkipWhileIterator<TIterator, TPredicate>> SkipWhile(TPredicate&& predicate) const noexcept
+		LinqView<SkipWhileIterator<TIterator, TPredicate>> SkipWhile(TPredicate&& predicate) const
 		{
 			return LinqView<SkipWhileIterator<TIterator, TPredicate>>(
-				SkipWhileIterator<TIterator, TPredicate>(_begin, std::forward<TPredicate>(predicate)),
+				SkipWhileIterator<TIterator, TPredicate>(_begin, _end, std::forward<TPredicate>(predicate)),
 				SkipWhileIterator<TIterator, TPredicate>(_end));
 		}
 
-		/// @brief 
+		/// @brief Over random access iterators the result is a prefix of the same view type
 		/// @param count 
 		/// @return 
-		LinqView<TakeIterator<TIterator>> Take(std::size_t count) const noexcept
+		auto Take(std::size_t count) const noexcept
 		{
-			return LinqView<TakeIterator<TIterator>>(
-				TakeIterator<TIterator>(_begin, count),
-				TakeIterator<TIterator>(_end));
+			if constexpr (std::random_access_iterator<TIterator>)
+				return LinqView(_begin, std::ranges::next(_begin, static_cast<std::iter_difference_t<TIterator>>(count), _end));
+			else
+				return LinqView<TakeIterator<TIterator>>(
+					TakeIterator<TIterator>(_begin, _end, count),
+					TakeIterator<TIterator>(_end));
 		}
 
 		/// @brief 
@@ -451,12 +404,49 @@ namespace ExtendedCpp::LINQ
 		/// @param predicate 
 		/// @return 
 		template<Concepts::IsPredicate<value_type> TPredicate>
-		LinqView<TakeWhileIterator<TIterator, TPredicate>> TakeWhile(TPredicate&& predicate) const noexcept
+		LinqView<TakeWhileIterator<TIterator, TPredicate>> TakeWhile(TPredicate&& predicate) const
 		{
 			return LinqView<TakeWhileIterator<TIterator, TPredicate>>(
-				TakeWhileIterator<TIterator, TPredicate>(_begin, std::forward<TPredicate>(predicate)),
+				TakeWhileIterator<TIterator, TPredicate>(_begin, _end, std::forward<TPredicate>(predicate)),
 				TakeWhileIterator<TIterator, TPredicate>(_end));
 		}
+
+		/// @brief Split the view into consecutive ranges of size elements, the last range may be shorter.
+		/// Ranges are spans over contiguous storage and subranges otherwise, elements are not copied
+		/// @param size 
+		/// @return 
+		LinqView<WindowIterator<TIterator>> Chunk(const std::size_t size) const
+		{
+			if (size == 0)
+				throw std::invalid_argument("Chunk size must be greater than zero");
+			return LinqView<WindowIterator<TIterator>>(
+				WindowIterator<TIterator>(_begin, _end, size, size, true),
+				WindowIterator<TIterator>(_end));
+		}
+
+		/// @brief Sliding ranges of exactly size elements, each next range starts step elements after the previous one.
+		/// Ranges are spans over contiguous storage and subranges otherwise, elements are not copied
+		/// @param size 
+		/// @param step 
+		/// @return 
+		LinqView<WindowIterator<TIterator>> Window(const std::size_t size, const std::size_t step = 1) const
+		{
+			if (size == 0 || step == 0)
+				throw std::invalid_argument("Window size and step must be greater than zero");
+			return LinqView<WindowIterator<TIterator>>(
+				WindowIterator<TIterator>(_begin, _end, size, step, false),
+				WindowIterator<TIterator>(_end));
+		}
+
+		/// @brief Split the view into vectors of size elements, the last vector may be shorter.
+		/// Unlike Chunk every vector owns copies of its elements
+		/// @param size 
+		/// @return 
+		auto Batch(const std::size_t size) const
+		{
+			return Chunk(size).Select([](const WindowRange<TIterator>& chunk)
+				{ return std::vector<value_type>(chunk.begin(), chunk.end()); });
+		}
 	};
 }
 
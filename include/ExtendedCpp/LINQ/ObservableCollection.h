@@ -0,0 +1,165 @@
+#ifndef LINQ_ObservableCollection_H
+#define LINQ_ObservableCollection_H
+
+#include <vector>
+#include <span>
+#include <algorithm>
+#include <stdexcept>
+#include <concepts>
+#include <utility>
+
+#include <ExtendedCpp/Events/Event.h>
+#include <ExtendedCpp/LINQ/Concepts.h>
+
+/// @brief
+namespace ExtendedCpp::LINQ
+{
+    /// @brief Unordered collection, which raises an event for every inserted and erased element.
+    /// Erasing moves the last element into the place of the erased one, so every change costs O(1)
+    /// @tparam TSource
+    template<std::copyable TSource>
+    class ObservableCollection final
+    {
+    private:
+        std::vector<TSource> _elements;
+
+    public:
+        /// @brief
+        using value_type = TSource;
+
+        /// @brief
+        using const_iterator = typename std::vector<TSource>::const_iterator;
+
+        /// @brief Raised after the element has been inserted
+        Events::Event<const TSource&> Inserted;
+
+        /// @brief Raised before the element is erased
+        Events::Event<const TSource&> Erased;
+
+        /// @brief
+        ObservableCollection() = default;
+
+        /// @brief
+        /// @param elements
+        explicit ObservableCollection(std::vector<TSource> elements) noexcept :
+            _elements(std::move(elements)) {}
+
+        /// @brief Handlers are not copied
+        ObservableCollection(const ObservableCollection&) = delete;
+
+        /// @brief Handlers are not copied
+        ObservableCollection& operator=(const ObservableCollection&) = delete;
+
+        /// @brief Default destructor
+        ~ObservableCollection() = default;
+
+        /// @brief
+        /// @return
+        [[nodiscard]]
+        std::size_t size() const noexcept
+        {
+            return _elements.size();
+        }
+
+        /// @brief
+        /// @return
+        [[nodiscard]]
+        bool empty() const noexcept
+        {
+            return _elements.empty();
+        }
+
+        /// @brief
+        /// @return
+        const_iterator begin() const noexcept
+        {
+            return _elements.cbegin();
+        }
+
+        /// @brief
+        /// @return
+        const_iterator end() const noexcept
+        {
+            return _elements.cend();
+        }
+
+        /// @brief
+        /// @return
+        const_iterator cbegin() const noexcept
+        {
+            return _elements.cbegin();
+        }
+
+        /// @brief
+        /// @return
+        const_iterator cend() const noexcept
+        {
+            return _elements.cend();
+        }
+
+        /// @brief
+        /// @param index
+        /// @return
+        const TSource& operator[](const std::size_t index) const noexcept
+        {
+            return _elements[index];
+        }
+
+        /// @brief
+        /// @return Elements in the current order, which changes on every erasing
+        std::span<const TSource> Elements() const noexcept
+        {
+            return _elements;
+        }
+
+        /// @brief
+        /// @param element
+        void Insert(TSource element)
+        {
+            _elements.push_back(std::move(element));
+            Inserted(_elements.back());
+        }
+
+        /// @brief Erases the element in O(1), the last element takes its place
+        /// @param index
+        void EraseAt(const std::size_t index)
+        {
+            if (index >= _elements.size())
+                throw std::out_of_range("Index is out of the collection");
+
+            Erased(_elements[index]);
+            if (index + 1 != _elements.size())
+                _elements[index] = std::move(_elements.back());
+            _elements.pop_back();
+        }
+
+        /// @brief Erases the first equal element, the search takes O(n)
+        /// @param element
+        /// @return false if there is no such element
+        bool Erase(const TSource& element)
+        requires Concepts::Equatable<TSource>
+        {
+            const auto position = std::find(_elements.cbegin(), _elements.cend(), element);
+            if (position == _elements.cend())
+                return false;
+
+            EraseAt(static_cast<std::size_t>(position - _elements.cbegin()));
+            return true;
+        }
+
+        /// @brief Erases the old element and inserts the new one in its place
+        /// @param index
+        /// @param element
+        void Replace(const std::size_t index, TSource element)
+        {
+            if (index >= _elements.size())
+                throw std::out_of_range("Index is out of the collection");
+
+            Erased(_elements[index]);
+            _elements[index] = std::move(element);
+            Inserted(_elements[index]);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef LINQ_Parallel_H
+#define LINQ_Parallel_H
+
+#include <cstddef>
+#include <thread>
+
+/// @brief
+namespace ExtendedCpp::LINQ
+{
+    /// @brief Execution options of the parallel LINQ operators
+    struct Parallel final
+    {
+        /// @brief Maximum number of threads, 0 means std::thread::hardware_concurrency()
+        std::size_t ThreadCount = 0;
+
+        /// @brief Preserve the relative order of equal elements
+        bool Stable = false;
+
+        /// @brief
+        /// @return Number of threads to use, at least one
+        [[nodiscard]]
+        std::size_t Threads() const noexcept
+        {
+            if (ThreadCount != 0)
+                return ThreadCount;
+            const std::size_t hardwareConcurrency = std::thread::hardware_concurrency();
+            return hardwareConcurrency == 0 ? 1 : hardwareConcurrency;
+        }
+    };
+}
+
+#endif
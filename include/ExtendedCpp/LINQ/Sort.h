@@ -4,12 +4,19 @@
 #include <map>
 #include <memory>
 #include <vector>
+#include <array>
+#include <string_view>
+#include <cstdint>
 #include <cmath>
+#include <bit>
+#include <algorithm>
 #include <utility>
 #include <type_traits>
 #include <concepts>
+#include <future>
 
 #include <ExtendedCpp/LINQ/OrderType.h>
+#include <ExtendedCpp/LINQ/Parallel.h>
 #include <ExtendedCpp/LINQ/TypeTraits.h>
 #include <ExtendedCpp/LINQ/Concepts.h>
 #include <ExtendedCpp/LINQ/Aggregate.h>
@@ -18,7 +25,17 @@
 namespace ExtendedCpp::LINQ::Sort
 {
     static constexpr std::size_t RUN = 64;
+    static constexpr std::size_t MIN_GALLOP = 7;
     static constexpr double FACTOR = 1.2473309;
+    static constexpr std::size_t INSERTION_SORT_THRESHOLD = 24;
+    static constexpr std::size_t NINTHER_THRESHOLD = 128;
+    static constexpr std::size_t PARTIAL_INSERTION_SORT_LIMIT = 8;
+    static constexpr std::size_t BLOCK_SIZE = 64;
+    static constexpr std::size_t PARALLEL_THRESHOLD = 1 << 15;
+    static constexpr std::size_t RADIX = 256;
+    static constexpr std::size_t RADIX_THRESHOLD = 256;
+    static constexpr std::size_t PACKED_KEY_SIZE = 16;
+    static constexpr std::size_t TOP_K_HEAP_RATIO = 16;
 
     /// @brief 
     /// @tparam TCollection 
@@ -280,8 +297,7 @@ namespace ExtendedCpp::LINQ::Sort
         if (start >= end)
             return;
 
-        const T min = Aggregate::Min(collection, start, end);
-        const T max = Aggregate::Max(collection, start, end);
+        const auto [min, max] = Aggregate::MinMax(collection, start, end);
         const auto blockCount = static_cast<std::size_t>(std::ceil(std::log2(end + 1 - start)));
         if (blockCount == 0)
             return;
@@ -366,8 +382,7 @@ namespace ExtendedCpp::LINQ::Sort
 
         using TSelect = std::invoke_result_t<TSelector, T>;
 
-        const TSelect min = Aggregate::Min(collection, start, end, selector);
-        const TSelect max = Aggregate::Max(collection, start, end, selector);
+        const auto [min, max] = Aggregate::MinMax(collection, start, end, selector);
         const auto blockCount = static_cast<std::size_t>(std::ceil(std::log2(end + 1 - start)));
         if (blockCount == 0)
             return;
@@ -429,415 +444,2587 @@ namespace ExtendedCpp::LINQ::Sort
         }
     }
 
-    /// @brief 
+    /// @brief Sorts [begin, end) with binary insertion sort, [begin, sorted) must be already sorted
     /// @tparam TCollection 
+    /// @tparam TLess 
     /// @tparam T 
     /// @param collection 
-    /// @param start 
-    /// @param mid 
+    /// @param begin First index of the range
+    /// @param end Index past the last element of the range
+    /// @param sorted Index past the sorted prefix
+    /// @param less Strict weak ordering
+    template<Concepts::RandomAccess TCollection, typename TLess,
+             typename T = RandomAccessValueType<TCollection>>
+    void BinaryInsertionSort(TCollection&& collection, const std::size_t begin, const std::size_t end,
+                             std::size_t sorted, TLess&& less)
+    {
+        if (sorted == begin)
+            ++sorted;
+
+        for (; sorted < end; ++sorted)
+        {
+            T pivot = std::move(collection[sorted]);
+
+            std::size_t left = begin;
+            std::size_t right = sorted;
+            while (left < right)
+            {
+                const std::size_t middle = left + (right - left) / 2;
+                if (less(pivot, collection[middle]))
+                    right = middle;
+                else
+                    left = middle + 1;
+            }
+
+            for (std::size_t i = sorted; i > left; --i)
+                collection[i] = std::move(collection[i - 1]);
+            collection[left] = std::move(pivot);
+        }
+    }
+
+    /// @brief Merges two adjacent sorted ranges [begin, middle) and [middle, end) in place.
+    /// The shorter range is moved to the buffer, so it never holds more than half of the elements
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @tparam T 
+    /// @param collection 
+    /// @param begin 
+    /// @param middle 
     /// @param end 
-    /// @param orderType 
-    template<Concepts::RandomAccess TCollection, Concepts::Comparable T = RandomAccessValueType<TCollection>>
-    void Merge(TCollection&& collection, const std::size_t start, const std::size_t mid, const std::size_t end,
-               const OrderType orderType) noexcept
+    /// @param buffer Scratch storage, its capacity is reused between calls
+    /// @param less Strict weak ordering, elements of the left range win ties
+    template<Concepts::RandomAccess TCollection, typename TLess,
+             typename T = RandomAccessValueType<TCollection>>
+    void MergeAdjacent(TCollection&& collection, const std::size_t begin, const std::size_t middle,
+                       const std::size_t end, std::vector<T>& buffer, TLess&& less)
     {
-        const std::size_t n1 = mid - start + 1;
-        const std::size_t n2 = end - mid;
+        if (begin == middle || middle == end || !less(collection[middle], collection[middle - 1]))
+            return;
+
+        buffer.clear();
 
-        std::vector<T> array1;
-        array1.reserve(n1);
-        std::vector<T> array2;
-        array2.reserve(n2);
+        if (middle - begin <= end - middle)
+        {
+            for (std::size_t i = begin; i < middle; ++i)
+                buffer.push_back(std::move(collection[i]));
 
-        for (std::size_t i = start; i <= mid; ++i)
-            array1.push_back(collection[i]);
-        for (std::size_t i = mid + 1; i <= end; ++i)
-            array2.push_back(collection[i]);
+            std::size_t left = 0;
+            std::size_t right = middle;
+            std::size_t out = begin;
 
-        std::size_t i = 0, j = 0;
+            while (left < buffer.size() && right < end)
+            {
+                if (less(collection[right], buffer[left]))
+                    collection[out++] = std::move(collection[right++]);
+                else
+                    collection[out++] = std::move(buffer[left++]);
+            }
 
-        if (orderType == OrderType::ASC)
+            while (left < buffer.size())
+                collection[out++] = std::move(buffer[left++]);
+        }
+        else
+        {
+            for (std::size_t i = middle; i < end; ++i)
+                buffer.push_back(std::move(collection[i]));
+
+            std::size_t left = middle;
+            std::size_t right = buffer.size();
+            std::size_t out = end;
+
+            while (left > begin && right > 0)
+            {
+                if (less(buffer[right - 1], collection[left - 1]))
+                    collection[--out] = std::move(collection[--left]);
+                else
+                    collection[--out] = std::move(buffer[--right]);
+            }
+
+            while (right > 0)
+                collection[--out] = std::move(buffer[--right]);
+        }
+    }
+
+    /// @brief Stable bottom-up merge sort over [begin, end): insertion sorted blocks
+    /// are merged pairwise through a single buffer of at most half of the range
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @tparam T 
+    /// @param collection 
+    /// @param begin First index of the range
+    /// @param end Index past the last element of the range
+    /// @param less Strict weak ordering
+    template<Concepts::RandomAccess TCollection, typename TLess,
+             typename T = RandomAccessValueType<TCollection>>
+    void StableSortRange(TCollection&& collection, const std::size_t begin, const std::size_t end, TLess&& less)
+    {
+        if (end - begin < 2)
+            return;
+
+        for (std::size_t blockBegin = begin; blockBegin < end; blockBegin += INSERTION_SORT_THRESHOLD)
+            BinaryInsertionSort(collection, blockBegin, std::min(blockBegin + INSERTION_SORT_THRESHOLD, end),
+                                blockBegin, less);
+
+        if (end - begin <= INSERTION_SORT_THRESHOLD)
+            return;
+
+        std::vector<T> buffer;
+        buffer.reserve((end - begin) / 2);
+
+        for (std::size_t width = INSERTION_SORT_THRESHOLD; width < end - begin; width *= 2)
+            for (std::size_t left = begin; left + width < end; left += 2 * width)
+                MergeAdjacent(collection, left, left + width, std::min(left + 2 * width, end), buffer, less);
+    }
+
+    /// @brief Finds the leftmost position to insert key into the sorted range source[base, base + length),
+    /// searching exponentially from hint and then binary
+    /// @tparam TSource 
+    /// @tparam TLess 
+    /// @tparam T 
+    /// @param key 
+    /// @param source 
+    /// @param base 
+    /// @param length Must be positive
+    /// @param hint Index in [0, length) where the search starts
+    /// @param less Strict weak ordering
+    /// @return Offset k such that source[base + k - 1] < key <= source[base + k]
+    template<Concepts::RandomAccess TSource, typename TLess, typename T>
+    std::size_t GallopLeft(const T& key, TSource&& source, const std::size_t base, const std::size_t length,
+                           const std::size_t hint, TLess&& less)
+    {
+        std::size_t lastOffset = 0;
+        std::size_t offset = 1;
+        std::size_t low;
+        std::size_t high;
+
+        if (less(source[base + hint], key))
+        {
+            const std::size_t maxOffset = length - hint;
+            while (offset < maxOffset && less(source[base + hint + offset], key))
+            {
+                lastOffset = offset;
+                offset = (offset << 1) + 1;
+            }
+            offset = std::min(offset, maxOffset);
+            low = hint + lastOffset + 1;
+            high = hint + offset;
+        }
+        else
+        {
+            const std::size_t maxOffset = hint + 1;
+            while (offset < maxOffset && !less(source[base + hint - offset], key))
+            {
+                lastOffset = offset;
+                offset = (offset << 1) + 1;
+            }
+            offset = std::min(offset, maxOffset);
+            low = hint + 1 - offset;
+            high = hint - lastOffset;
+        }
+
+        while (low < high)
+        {
+            const std::size_t middle = low + (high - low) / 2;
+            if (less(source[base + middle], key))
+                low = middle + 1;
+            else
+                high = middle;
+        }
+
+        return high;
+    }
+
+    /// @brief Finds the rightmost position to insert key into the sorted range source[base, base + length),
+    /// searching exponentially from hint and then binary
+    /// @tparam TSource 
+    /// @tparam TLess 
+    /// @tparam T 
+    /// @param key 
+    /// @param source 
+    /// @param base 
+    /// @param length Must be positive
+    /// @param hint Index in [0, length) where the search starts
+    /// @param less Strict weak ordering
+    /// @return Offset k such that source[base + k - 1] <= key < source[base + k]
+    template<Concepts::RandomAccess TSource, typename TLess, typename T>
+    std::size_t GallopRight(const T& key, TSource&& source, const std::size_t base, const std::size_t length,
+                            const std::size_t hint, TLess&& less)
+    {
+        std::size_t lastOffset = 0;
+        std::size_t offset = 1;
+        std::size_t low;
+        std::size_t high;
+
+        if (less(key, source[base + hint]))
+        {
+            const std::size_t maxOffset = hint + 1;
+            while (offset < maxOffset && less(key, source[base + hint - offset]))
+            {
+                lastOffset = offset;
+                offset = (offset << 1) + 1;
+            }
+            offset = std::min(offset, maxOffset);
+            low = hint + 1 - offset;
+            high = hint - lastOffset;
+        }
+        else
+        {
+            const std::size_t maxOffset = length - hint;
+            while (offset < maxOffset && !less(key, source[base + hint + offset]))
+            {
+                lastOffset = offset;
+                offset = (offset << 1) + 1;
+            }
+            offset = std::min(offset, maxOffset);
+            low = hint + lastOffset + 1;
+            high = hint + offset;
+        }
+
+        while (low < high)
+        {
+            const std::size_t middle = low + (high - low) / 2;
+            if (less(key, source[base + middle]))
+                high = middle;
+            else
+                low = middle + 1;
+        }
+
+        return high;
+    }
+
+    /// @brief Finds the natural run starting at begin, a strictly descending run is reversed in place
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @param collection 
+    /// @param begin 
+    /// @param end 
+    /// @param less Strict weak ordering
+    /// @return Length of the run
+    template<Concepts::RandomAccess TCollection, typename TLess>
+    std::size_t CountRunAndMakeAscending(TCollection&& collection, const std::size_t begin, const std::size_t end,
+                                         TLess&& less)
+    {
+        std::size_t runEnd = begin + 1;
+        if (runEnd == end)
+            return 1;
+
+        if (less(collection[runEnd++], collection[begin]))
+        {
+            while (runEnd < end && less(collection[runEnd], collection[runEnd - 1]))
+                ++runEnd;
+            for (std::size_t left = begin, right = runEnd - 1; left < right; ++left, --right)
+                std::swap(collection[left], collection[right]);
+        }
+        else
+            while (runEnd < end && !less(collection[runEnd], collection[runEnd - 1]))
+                ++runEnd;
+
+        return runEnd - begin;
+    }
+
+    /// @brief Merges the adjacent runs [base1, base1 + length1) and [base2, base2 + length2) when the first one
+    /// is not longer. The first run is moved to the buffer, the first element of the second run must be less
+    /// than the first element of the first run and its last element must be greater than the second run
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @tparam T 
+    /// @param collection 
+    /// @param base1 
+    /// @param length1 
+    /// @param base2 
+    /// @param length2 
+    /// @param buffer 
+    /// @param minGallop Adaptive threshold for switching to galloping mode
+    /// @param less Strict weak ordering
+    template<Concepts::RandomAccess TCollection, typename TLess,
+             typename T = RandomAccessValueType<TCollection>>
+    void TimSortMergeLow(TCollection&& collection, const std::size_t base1, std::size_t length1,
+                         const std::size_t base2, std::size_t length2,
+                         std::vector<T>& buffer, std::size_t& minGallop, TLess&& less)
+    {
+        buffer.clear();
+        for (std::size_t i = 0; i < length1; ++i)
+            buffer.push_back(std::move(collection[base1 + i]));
+
+        std::size_t cursor1 = 0;
+        std::size_t cursor2 = base2;
+        std::size_t destination = base1;
+
+        collection[destination++] = std::move(collection[cursor2++]);
+        bool done = --length2 == 0 || length1 == 1;
+
+        while (!done)
         {
-            for (std::size_t k = start; k <= end; ++k)
+            std::size_t count1 = 0;
+            std::size_t count2 = 0;
+
+            while (true)
             {
-                if (i != n1 && (j == n2 || array1[i] < array2[j]))
+                if (less(collection[cursor2], buffer[cursor1]))
                 {
-                    collection[k] = array1[i];
-                    ++i;
+                    collection[destination++] = std::move(collection[cursor2++]);
+                    ++count2;
+                    count1 = 0;
+                    if (--length2 == 0)
+                    {
+                        done = true;
+                        break;
+                    }
                 }
-                else if (j != n2 && (i == n1 || array2[j] < array1[i]))
+                else
                 {
-                    collection[k] = array2[j];
-                    ++j;
+                    collection[destination++] = std::move(buffer[cursor1++]);
+                    ++count1;
+                    count2 = 0;
+                    if (--length1 == 1)
+                    {
+                        done = true;
+                        break;
+                    }
                 }
-                else if (i != n1 && (j == n2 || array1[i] == array2[j]))
+
+                if ((count1 | count2) >= minGallop)
+                    break;
+            }
+
+            while (!done)
+            {
+                count1 = GallopRight(collection[cursor2], buffer, cursor1, length1, 0, less);
+                for (std::size_t i = 0; i < count1; ++i)
+                    collection[destination++] = std::move(buffer[cursor1++]);
+                length1 -= count1;
+                if (length1 <= 1)
                 {
-                    collection[k] = array1[i];
-                    ++i;
+                    done = true;
+                    break;
+                }
+
+                collection[destination++] = std::move(collection[cursor2++]);
+                if (--length2 == 0)
+                {
+                    done = true;
+                    break;
+                }
+
+                count2 = GallopLeft(buffer[cursor1], collection, cursor2, length2, 0, less);
+                for (std::size_t i = 0; i < count2; ++i)
+                    collection[destination++] = std::move(collection[cursor2++]);
+                length2 -= count2;
+                if (length2 == 0)
+                {
+                    done = true;
+                    break;
                 }
+
+                collection[destination++] = std::move(buffer[cursor1++]);
+                if (--length1 == 1)
+                {
+                    done = true;
+                    break;
+                }
+
+                if (minGallop > 0)
+                    --minGallop;
+                if (count1 < MIN_GALLOP && count2 < MIN_GALLOP)
+                    break;
             }
+
+            if (!done)
+                minGallop += 2;
+        }
+
+        minGallop = std::max<std::size_t>(minGallop, 1);
+
+        if (length1 == 1)
+        {
+            for (std::size_t i = 0; i < length2; ++i)
+                collection[destination + i] = std::move(collection[cursor2 + i]);
+            collection[destination + length2] = std::move(buffer[cursor1]);
         }
         else
+            for (std::size_t i = 0; i < length1; ++i)
+                collection[destination++] = std::move(buffer[cursor1++]);
+    }
+
+    /// @brief Merges the adjacent runs [base1, base1 + length1) and [base2, base2 + length2) from the end
+    /// when the second one is shorter. The second run is moved to the buffer, the preconditions are the same
+    /// as for TimSortMergeLow
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @tparam T 
+    /// @param collection 
+    /// @param base1 
+    /// @param length1 
+    /// @param base2 
+    /// @param length2 
+    /// @param buffer 
+    /// @param minGallop Adaptive threshold for switching to galloping mode
+    /// @param less Strict weak ordering
+    template<Concepts::RandomAccess TCollection, typename TLess,
+             typename T = RandomAccessValueType<TCollection>>
+    void TimSortMergeHigh(TCollection&& collection, const std::size_t base1, std::size_t length1,
+                          const std::size_t base2, std::size_t length2,
+                          std::vector<T>& buffer, std::size_t& minGallop, TLess&& less)
+    {
+        buffer.clear();
+        for (std::size_t i = 0; i < length2; ++i)
+            buffer.push_back(std::move(collection[base2 + i]));
+
+        // Cursors point past the last unmerged element.
+        std::size_t cursor1 = base1 + length1;
+        std::size_t cursor2 = length2;
+        std::size_t destination = base2 + length2;
+
+        collection[--destination] = std::move(collection[--cursor1]);
+        bool done = --length1 == 0 || length2 == 1;
+
+        while (!done)
         {
-            for (std::size_t k = start; k <= end; ++k)
+            std::size_t count1 = 0;
+            std::size_t count2 = 0;
+
+            while (true)
             {
-                if (i != n1 && (j == n2 || array2[j] < array1[i]))
+                if (less(buffer[cursor2 - 1], collection[cursor1 - 1]))
                 {
-                    collection[k] = array1[i];
-                    ++i;
+                    collection[--destination] = std::move(collection[--cursor1]);
+                    ++count1;
+                    count2 = 0;
+                    if (--length1 == 0)
+                    {
+                        done = true;
+                        break;
+                    }
+                }
+                else
+                {
+                    collection[--destination] = std::move(buffer[--cursor2]);
+                    ++count2;
+                    count1 = 0;
+                    if (--length2 == 1)
+                    {
+                        done = true;
+                        break;
+                    }
+                }
+
+                if ((count1 | count2) >= minGallop)
+                    break;
+            }
+
+            while (!done)
+            {
+                count1 = length1 - GallopRight(buffer[cursor2 - 1], collection, base1, length1, length1 - 1, less);
+                for (std::size_t i = 0; i < count1; ++i)
+                    collection[--destination] = std::move(collection[--cursor1]);
+                length1 -= count1;
+                if (length1 == 0)
+                {
+                    done = true;
+                    break;
+                }
+
+                collection[--destination] = std::move(buffer[--cursor2]);
+                if (--length2 == 1)
+                {
+                    done = true;
+                    break;
+                }
+
+                count2 = length2 - GallopLeft(collection[cursor1 - 1], buffer, 0, length2, length2 - 1, less);
+                for (std::size_t i = 0; i < count2; ++i)
+                    collection[--destination] = std::move(buffer[--cursor2]);
+                length2 -= count2;
+                if (length2 <= 1)
+                {
+                    done = true;
+                    break;
                 }
-                else if (j != n2 && (i == n1 || array1[i] < array2[j]))
+
+                collection[--destination] = std::move(collection[--cursor1]);
+                if (--length1 == 0)
                 {
-                    collection[k] = array2[j];
-                    ++j;
+                    done = true;
+                    break;
                 }
-                else if (j != n2 && (i == n1 || array1[i] == array2[j]))
+
+                if (minGallop > 0)
+                    --minGallop;
+                if (count1 < MIN_GALLOP && count2 < MIN_GALLOP)
+                    break;
+            }
+
+            if (!done)
+                minGallop += 2;
+        }
+
+        minGallop = std::max<std::size_t>(minGallop, 1);
+
+        if (length2 == 1)
+        {
+            for (std::size_t i = 0; i < length1; ++i)
+                collection[--destination] = std::move(collection[--cursor1]);
+            collection[--destination] = std::move(buffer[cursor2 - 1]);
+        }
+        else
+            while (cursor2 > 0)
+                collection[--destination] = std::move(buffer[--cursor2]);
+    }
+
+    /// @brief Merges the runs at index and index + 1 of the run stack. Elements of the first run that are already
+    /// in place and elements of the second run that are already in place are skipped by galloping
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @tparam T 
+    /// @param collection 
+    /// @param runs Stack of (base, length) pairs
+    /// @param index 
+    /// @param buffer 
+    /// @param minGallop 
+    /// @param less Strict weak ordering
+    template<Concepts::RandomAccess TCollection, typename TLess,
+             typename T = RandomAccessValueType<TCollection>>
+    void TimSortMergeAt(TCollection&& collection, std::vector<std::pair<std::size_t, std::size_t>>& runs,
+                        const std::size_t index, std::vector<T>& buffer, std::size_t& minGallop, TLess&& less)
+    {
+        auto [base1, length1] = runs[index];
+        auto [base2, length2] = runs[index + 1];
+
+        runs[index].second = length1 + length2;
+        runs.erase(runs.begin() + static_cast<std::ptrdiff_t>(index) + 1);
+
+        const std::size_t skipped = GallopRight(collection[base2], collection, base1, length1, 0, less);
+        base1 += skipped;
+        length1 -= skipped;
+        if (length1 == 0)
+            return;
+
+        length2 = GallopLeft(collection[base1 + length1 - 1], collection, base2, length2, length2 - 1, less);
+        if (length2 == 0)
+            return;
+
+        if (length1 <= length2)
+            TimSortMergeLow(collection, base1, length1, base2, length2, buffer, minGallop, less);
+        else
+            TimSortMergeHigh(collection, base1, length1, base2, length2, buffer, minGallop, less);
+    }
+
+    /// @brief Stable TimSort over [begin, end): natural runs are detected and extended to the minimal run length
+    /// by binary insertion sort, then merged with galloping while the run stack keeps the TimSort invariants.
+    /// The merge buffer never holds more than half of the elements
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @tparam T 
+    /// @param collection 
+    /// @param begin First index of the range
+    /// @param end Index past the last element of the range
+    /// @param less Strict weak ordering
+    template<Concepts::RandomAccess TCollection, typename TLess,
+             typename T = RandomAccessValueType<TCollection>>
+    void TimSortRange(TCollection&& collection, const std::size_t begin, const std::size_t end, TLess&& less)
+    {
+        std::size_t remaining = end - begin;
+        if (remaining < 2)
+            return;
+
+        if (remaining < RUN)
+        {
+            const std::size_t runLength = CountRunAndMakeAscending(collection, begin, end, less);
+            BinaryInsertionSort(collection, begin, end, begin + runLength, less);
+            return;
+        }
+
+        std::size_t minRun = remaining;
+        std::size_t lowBits = 0;
+        while (minRun >= RUN)
+        {
+            lowBits |= minRun & 1;
+            minRun >>= 1;
+        }
+        minRun += lowBits;
+
+        std::vector<std::pair<std::size_t, std::size_t>> runs;
+        std::vector<T> buffer;
+        buffer.reserve(remaining / 2);
+        std::size_t minGallop = MIN_GALLOP;
+
+        for (std::size_t low = begin; remaining != 0;)
+        {
+            std::size_t runLength = CountRunAndMakeAscending(collection, low, end, less);
+            if (runLength < minRun)
+            {
+                const std::size_t forced = std::min(remaining, minRun);
+                BinaryInsertionSort(collection, low, low + forced, low + runLength, less);
+                runLength = forced;
+            }
+
+            runs.emplace_back(low, runLength);
+            while (runs.size() > 1)
+            {
+                std::size_t index = runs.size() - 2;
+                if ((index > 0 && runs[index - 1].second <= runs[index].second + runs[index + 1].second) ||
+                    (index > 1 && runs[index - 2].second <= runs[index - 1].second + runs[index].second))
                 {
-                    collection[k] = array2[j];
-                    ++j;
+                    if (runs[index - 1].second < runs[index + 1].second)
+                        --index;
                 }
+                else if (runs[index].second > runs[index + 1].second)
+                    break;
+                TimSortMergeAt(collection, runs, index, buffer, minGallop, less);
+            }
+
+            low += runLength;
+            remaining -= runLength;
+        }
+
+        while (runs.size() > 1)
+        {
+            std::size_t index = runs.size() - 2;
+            if (index > 0 && runs[index - 1].second < runs[index + 1].second)
+                --index;
+            TimSortMergeAt(collection, runs, index, buffer, minGallop, less);
+        }
+    }
+
+    /// @brief 
+    /// @tparam TCollection 
+    /// @tparam T 
+    /// @param collection 
+    /// @param start 
+    /// @param mid 
+    /// @param end 
+    /// @param orderType 
+    template<Concepts::RandomAccess TCollection, Concepts::Comparable T = RandomAccessValueType<TCollection>>
+    void Merge(TCollection&& collection, const std::size_t start, const std::size_t mid, const std::size_t end,
+               const OrderType orderType) noexcept
+    {
+        std::vector<T> buffer;
+
+        if (orderType == OrderType::ASC)
+            MergeAdjacent(collection, start, mid + 1, end + 1, buffer,
+                          [](const T& left, const T& right) { return left < right; });
+        else
+            MergeAdjacent(collection, start, mid + 1, end + 1, buffer,
+                          [](const T& left, const T& right) { return left > right; });
+    }
+
+    /// @brief 
+    /// @tparam TCollection 
+    /// @tparam T 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param orderType 
+    template<Concepts::RandomAccess TCollection, Concepts::Comparable T = RandomAccessValueType<TCollection>>
+    void MergeSort(TCollection&& collection, const std::size_t start, const std::size_t end,
+                   const OrderType orderType = OrderType::ASC) noexcept
+    {
+        if (start >= end)
+            return;
+
+        if (orderType == OrderType::ASC)
+            StableSortRange(collection, start, end + 1, [](const T& left, const T& right) { return left < right; });
+        else
+            StableSortRange(collection, start, end + 1, [](const T& left, const T& right) { return left > right; });
+    }
+
+    /// @brief 
+    /// @tparam T 
+    /// @tparam TCollection 
+    /// @tparam TSelector 
+    /// @param collection 
+    /// @param start 
+    /// @param mid 
+    /// @param end 
+    /// @param selector 
+    /// @param orderType 
+    template<Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>,
+             std::invocable<T> TSelector>
+    requires Concepts::Comparable<std::invoke_result_t<TSelector, T>>
+    void Merge(TCollection&& collection, const std::size_t start, const std::size_t mid, const std::size_t end,
+               TSelector&& selector, const OrderType orderType)
+    noexcept(std::is_nothrow_invocable_v<TSelector, T>)
+    {
+        std::vector<T> buffer;
+
+        if (orderType == OrderType::ASC)
+            MergeAdjacent(collection, start, mid + 1, end + 1, buffer, [&selector](const T& left, const T& right)
+                { return selector(left) < selector(right); });
+        else
+            MergeAdjacent(collection, start, mid + 1, end + 1, buffer, [&selector](const T& left, const T& right)
+                { return selector(left) > selector(right); });
+    }
+
+    /// @brief 
+    /// @tparam T 
+    /// @tparam TCollection 
+    /// @tparam TSelector 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param selector 
+    /// @param orderType 
+    template<Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>,
+             std::invocable<T> TSelector>
+    requires Concepts::Comparable<std::invoke_result_t<TSelector, T>>
+    void MergeSort(TCollection&& collection, const std::size_t start, const std::size_t end,
+                   TSelector&& selector, const OrderType orderType = OrderType::ASC)
+    noexcept(std::is_nothrow_invocable_v<TSelector, T>)
+    {
+        if (start >= end)
+            return;
+
+        if (orderType == OrderType::ASC)
+            StableSortRange(collection, start, end + 1, [&selector](const T& left, const T& right)
+                { return selector(left) < selector(right); });
+        else
+            StableSortRange(collection, start, end + 1, [&selector](const T& left, const T& right)
+                { return selector(left) > selector(right); });
+    }
+
+    /// @brief 
+    /// @tparam TCollection 
+    /// @tparam T 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param orderType 
+    template<Concepts::RandomAccess TCollection, Concepts::Comparable T = RandomAccessValueType<TCollection>>
+    void TimSort(TCollection&& collection, const std::size_t start, const std::size_t end,
+                 const OrderType orderType = OrderType::ASC) noexcept
+    {
+        if (start >= end)
+            return;
+
+        if (orderType == OrderType::ASC)
+            TimSortRange(collection, start, end + 1, [](const T& left, const T& right) { return left < right; });
+        else
+            TimSortRange(collection, start, end + 1, [](const T& left, const T& right) { return left > right; });
+    }
+
+    /// @brief 
+    /// @tparam T 
+    /// @tparam TCollection 
+    /// @tparam TSelector 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param selector 
+    /// @param orderType 
+    template<Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>,
+             std::invocable<T> TSelector>
+    requires Concepts::Comparable<std::invoke_result_t<TSelector, T>>
+    void TimSort(TCollection&& collection, const std::size_t start, const std::size_t end,
+                 TSelector&& selector, const OrderType orderType = OrderType::ASC)
+    noexcept(std::is_nothrow_invocable_v<TSelector, T>)
+    {
+        if (start >= end)
+            return;
+
+        if (orderType == OrderType::ASC)
+            TimSortRange(collection, start, end + 1, [&selector](const T& left, const T& right)
+                { return selector(left) < selector(right); });
+        else
+            TimSortRange(collection, start, end + 1, [&selector](const T& left, const T& right)
+                { return selector(left) > selector(right); });
+    }
+
+    /// @brief Sorts [begin, end) with insertion sort using a binary comparator
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @param collection 
+    /// @param begin First index of the range
+    /// @param end Index past the last element of the range
+    /// @param less Strict weak ordering
+    template<Concepts::RandomAccess TCollection, typename TLess,
+             typename T = RandomAccessValueType<TCollection>>
+    void PdqInsertionSort(TCollection&& collection, const std::size_t begin, const std::size_t end, TLess&& less)
+    {
+        if (begin == end)
+            return;
+
+        for (std::size_t i = begin + 1; i < end; ++i)
+        {
+            if (!less(collection[i], collection[i - 1]))
+                continue;
+
+            T value = std::move(collection[i]);
+            std::size_t j = i;
+            do
+            {
+                collection[j] = std::move(collection[j - 1]);
+                --j;
+            }
+            while (j != begin && less(value, collection[j - 1]));
+            collection[j] = std::move(value);
+        }
+    }
+
+    /// @brief Sorts [begin, end) with insertion sort without bounds check.
+    /// Requires that collection[begin - 1] is not greater than any element of the range
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @param collection 
+    /// @param begin First index of the range
+    /// @param end Index past the last element of the range
+    /// @param less Strict weak ordering
+    template<Concepts::RandomAccess TCollection, typename TLess,
+             typename T = RandomAccessValueType<TCollection>>
+    void PdqUnguardedInsertionSort(TCollection&& collection, const std::size_t begin, const std::size_t end, TLess&& less)
+    {
+        if (begin == end)
+            return;
+
+        for (std::size_t i = begin + 1; i < end; ++i)
+        {
+            if (!less(collection[i], collection[i - 1]))
+                continue;
+
+            T value = std::move(collection[i]);
+            std::size_t j = i;
+            do
+            {
+                collection[j] = std::move(collection[j - 1]);
+                --j;
+            }
+            while (less(value, collection[j - 1]));
+            collection[j] = std::move(value);
+        }
+    }
+
+    /// @brief Attempts to sort [begin, end) with insertion sort.
+    /// Gives up after PARTIAL_INSERTION_SORT_LIMIT elements were moved
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @param collection 
+    /// @param begin First index of the range
+    /// @param end Index past the last element of the range
+    /// @param less Strict weak ordering
+    /// @return true if the range is sorted
+    template<Concepts::RandomAccess TCollection, typename TLess,
+             typename T = RandomAccessValueType<TCollection>>
+    bool PdqPartialInsertionSort(TCollection&& collection, const std::size_t begin, const std::size_t end, TLess&& less)
+    {
+        if (begin == end)
+            return true;
+
+        std::size_t limit = 0;
+        for (std::size_t i = begin + 1; i < end; ++i)
+        {
+            if (!less(collection[i], collection[i - 1]))
+                continue;
+
+            T value = std::move(collection[i]);
+            std::size_t j = i;
+            do
+            {
+                collection[j] = std::move(collection[j - 1]);
+                --j;
+            }
+            while (j != begin && less(value, collection[j - 1]));
+            collection[j] = std::move(value);
+
+            limit += i - j;
+            if (limit > PARTIAL_INSERTION_SORT_LIMIT)
+                return false;
+        }
+
+        return true;
+    }
+
+    /// @brief Sorts three elements in place
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @param collection 
+    /// @param a 
+    /// @param b 
+    /// @param c 
+    /// @param less Strict weak ordering
+    template<Concepts::RandomAccess TCollection, typename TLess>
+    void PdqSortThree(TCollection&& collection, const std::size_t a, const std::size_t b, const std::size_t c,
+                      TLess&& less)
+    {
+        if (less(collection[b], collection[a]))
+            std::swap(collection[a], collection[b]);
+        if (less(collection[c], collection[b]))
+            std::swap(collection[b], collection[c]);
+        if (less(collection[b], collection[a]))
+            std::swap(collection[a], collection[b]);
+    }
+
+    /// @brief Restores the max-heap property for the subtree at root of heap stored in [begin, begin + size)
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @param collection 
+    /// @param begin First index of the heap
+    /// @param root Subtree root relative to begin
+    /// @param size Heap size
+    /// @param less Strict weak ordering
+    template<Concepts::RandomAccess TCollection, typename TLess,
+             typename T = RandomAccessValueType<TCollection>>
+    void SiftDown(TCollection&& collection, const std::size_t begin, std::size_t root, const std::size_t size,
+                  TLess&& less)
+    {
+        T value = std::move(collection[begin + root]);
+
+        while (2 * root + 1 < size)
+        {
+            std::size_t child = 2 * root + 1;
+            if (child + 1 < size && less(collection[begin + child], collection[begin + child + 1]))
+                ++child;
+            if (!less(value, collection[begin + child]))
+                break;
+            collection[begin + root] = std::move(collection[begin + child]);
+            root = child;
+        }
+
+        collection[begin + root] = std::move(value);
+    }
+
+    /// @brief Sorts [begin, end) with heap sort using a binary comparator
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @param collection 
+    /// @param begin First index of the range
+    /// @param end Index past the last element of the range
+    /// @param less Strict weak ordering
+    template<Concepts::RandomAccess TCollection, typename TLess>
+    void HeapSortRange(TCollection&& collection, const std::size_t begin, const std::size_t end, TLess&& less)
+    {
+        const std::size_t size = end - begin;
+        if (size < 2)
+            return;
+
+        for (std::size_t i = size / 2; i > 0; --i)
+            SiftDown(collection, begin, i - 1, size, less);
+
+        for (std::size_t i = size - 1; i > 0; --i)
+        {
+            std::swap(collection[begin], collection[begin + i]);
+            SiftDown(collection, begin, 0, i, less);
+        }
+    }
+
+    /// @brief 
+    /// @tparam TCollection 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param orderType 
+    template<Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>>
+    requires Concepts::Comparable<T>
+    void HeapSort(TCollection&& collection, const std::size_t start, const std::size_t end,
+                  const OrderType orderType = OrderType::ASC) noexcept
+    {
+        if (start >= end)
+            return;
+
+        if (orderType == OrderType::ASC)
+            HeapSortRange(collection, start, end + 1, [](const T& left, const T& right) { return left < right; });
+        else
+            HeapSortRange(collection, start, end + 1, [](const T& left, const T& right) { return left > right; });
+    }
+
+    /// @brief 
+    /// @tparam T 
+    /// @tparam TCollection 
+    /// @tparam TSelector 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param selector 
+    /// @param orderType 
+    template<Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>,
+             std::invocable<T> TSelector>
+    requires Concepts::Comparable<std::invoke_result_t<TSelector, T>>
+    void HeapSort(TCollection&& collection, const std::size_t start, const std::size_t end,
+                  TSelector&& selector, const OrderType orderType = OrderType::ASC)
+    noexcept(std::is_nothrow_invocable_v<TSelector, T>)
+    {
+        if (start >= end)
+            return;
+
+        if (orderType == OrderType::ASC)
+            HeapSortRange(collection, start, end + 1, [&selector](const T& left, const T& right)
+                { return selector(left) < selector(right); });
+        else
+            HeapSortRange(collection, start, end + 1, [&selector](const T& left, const T& right)
+                { return selector(left) > selector(right); });
+    }
+
+    /// @brief Partitions [begin, end) around collection[begin], placing elements equal to the pivot to the left.
+    /// Used when the range is known to contain many elements equal to the pivot
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @param collection 
+    /// @param begin First index of the range
+    /// @param end Index past the last element of the range
+    /// @param less Strict weak ordering
+    /// @return Final position of the pivot
+    template<Concepts::RandomAccess TCollection, typename TLess,
+             typename T = RandomAccessValueType<TCollection>>
+    std::size_t PdqPartitionLeft(TCollection&& collection, const std::size_t begin, const std::size_t end, TLess&& less)
+    {
+        T pivot = std::move(collection[begin]);
+        std::size_t first = begin;
+        std::size_t last = end;
+
+        while (less(pivot, collection[--last]));
+
+        if (last + 1 == end)
+            while (first < last && !less(pivot, collection[++first]));
+        else
+            while (!less(pivot, collection[++first]));
+
+        while (first < last)
+        {
+            std::swap(collection[first], collection[last]);
+            while (less(pivot, collection[--last]));
+            while (!less(pivot, collection[++first]));
+        }
+
+        const std::size_t pivotPosition = last;
+        collection[begin] = std::move(collection[pivotPosition]);
+        collection[pivotPosition] = std::move(pivot);
+
+        return pivotPosition;
+    }
+
+    /// @brief Partitions [begin, end) around collection[begin], placing elements equal to the pivot to the right
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @param collection 
+    /// @param begin First index of the range
+    /// @param end Index past the last element of the range
+    /// @param less Strict weak ordering
+    /// @return Final position of the pivot and whether the range was already partitioned
+    template<Concepts::RandomAccess TCollection, typename TLess,
+             typename T = RandomAccessValueType<TCollection>>
+    std::pair<std::size_t, bool> PdqPartitionRight(TCollection&& collection, const std::size_t begin,
+                                                   const std::size_t end, TLess&& less)
+    {
+        T pivot = std::move(collection[begin]);
+        std::size_t first = begin;
+        std::size_t last = end;
+
+        while (less(collection[++first], pivot));
+
+        if (first - 1 == begin)
+            while (first < last && !less(collection[--last], pivot));
+        else
+            while (!less(collection[--last], pivot));
+
+        const bool alreadyPartitioned = first >= last;
+
+        while (first < last)
+        {
+            std::swap(collection[first], collection[last]);
+            while (less(collection[++first], pivot));
+            while (!less(collection[--last], pivot));
+        }
+
+        const std::size_t pivotPosition = first - 1;
+        collection[begin] = std::move(collection[pivotPosition]);
+        collection[pivotPosition] = std::move(pivot);
+
+        return std::make_pair(pivotPosition, alreadyPartitioned);
+    }
+
+    /// @brief Swaps num pairs of elements addressed by block offsets
+    /// @tparam TCollection 
+    /// @param collection 
+    /// @param first Base index of the left block
+    /// @param last Base index past the right block
+    /// @param leftOffsets 
+    /// @param rightOffsets 
+    /// @param num 
+    /// @param useSwaps Plain swaps are required when both blocks have the same number of misplaced elements
+    template<Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>>
+    void PdqSwapOffsets(TCollection&& collection, const std::size_t first, const std::size_t last,
+                        const unsigned char* leftOffsets, const unsigned char* rightOffsets,
+                        const std::size_t num, const bool useSwaps)
+    {
+        if (useSwaps)
+        {
+            for (std::size_t i = 0; i < num; ++i)
+                std::swap(collection[first + leftOffsets[i]], collection[last - rightOffsets[i]]);
+        }
+        else if (num > 0)
+        {
+            std::size_t left = first + leftOffsets[0];
+            std::size_t right = last - rightOffsets[0];
+            T value = std::move(collection[left]);
+            collection[left] = std::move(collection[right]);
+
+            for (std::size_t i = 1; i < num; ++i)
+            {
+                left = first + leftOffsets[i];
+                collection[right] = std::move(collection[left]);
+                right = last - rightOffsets[i];
+                collection[left] = std::move(collection[right]);
+            }
+
+            collection[right] = std::move(value);
+        }
+    }
+
+    /// @brief Branchless variant of PdqPartitionRight based on block partitioning.
+    /// Comparison results are written to offset buffers instead of branching on them,
+    /// which avoids branch mispredictions for cheap comparisons of primitive types
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @param collection 
+    /// @param begin First index of the range
+    /// @param end Index past the last element of the range
+    /// @param less Strict weak ordering
+    /// @return Final position of the pivot and whether the range was already partitioned
+    template<Concepts::RandomAccess TCollection, typename TLess,
+             typename T = RandomAccessValueType<TCollection>>
+    std::pair<std::size_t, bool> PdqPartitionRightBranchless(TCollection&& collection, const std::size_t begin,
+                                                             const std::size_t end, TLess&& less)
+    {
+        T pivot = std::move(collection[begin]);
+        std::size_t first = begin;
+        std::size_t last = end;
+
+        while (less(collection[++first], pivot));
+
+        if (first - 1 == begin)
+            while (first < last && !less(collection[--last], pivot));
+        else
+            while (!less(collection[--last], pivot));
+
+        if (first >= last)
+        {
+            const std::size_t pivotPosition = first - 1;
+            collection[begin] = std::move(collection[pivotPosition]);
+            collection[pivotPosition] = std::move(pivot);
+            return std::make_pair(pivotPosition, true);
+        }
+
+        std::swap(collection[first], collection[last]);
+        ++first;
+
+        unsigned char leftOffsetsBuffer[BLOCK_SIZE];
+        unsigned char rightOffsetsBuffer[BLOCK_SIZE];
+        unsigned char* leftOffsets = leftOffsetsBuffer;
+        unsigned char* rightOffsets = rightOffsetsBuffer;
+        std::size_t leftCount = 0, rightCount = 0, leftStart = 0, rightStart = 0;
+
+        while (last - first > 2 * BLOCK_SIZE)
+        {
+            if (leftCount == 0)
+            {
+                leftStart = 0;
+                for (std::size_t i = 0; i < BLOCK_SIZE; ++i)
+                {
+                    leftOffsets[leftCount] = static_cast<unsigned char>(i);
+                    leftCount += !less(collection[first + i], pivot);
+                }
+            }
+
+            if (rightCount == 0)
+            {
+                rightStart = 0;
+                for (std::size_t i = 1; i <= BLOCK_SIZE; ++i)
+                {
+                    rightOffsets[rightCount] = static_cast<unsigned char>(i);
+                    rightCount += less(collection[last - i], pivot);
+                }
+            }
+
+            const std::size_t num = std::min(leftCount, rightCount);
+            PdqSwapOffsets(collection, first, last, leftOffsets + leftStart, rightOffsets + rightStart,
+                           num, leftCount == rightCount);
+            leftCount -= num;
+            rightCount -= num;
+            leftStart += num;
+            rightStart += num;
+
+            if (leftCount == 0)
+                first += BLOCK_SIZE;
+            if (rightCount == 0)
+                last -= BLOCK_SIZE;
+        }
+
+        std::size_t leftSize = 0, rightSize = 0;
+        const std::size_t unknownLeft = (last - first) - ((rightCount || leftCount) ? BLOCK_SIZE : 0);
+
+        if (rightCount)
+        {
+            leftSize = unknownLeft;
+            rightSize = BLOCK_SIZE;
+        }
+        else if (leftCount)
+        {
+            leftSize = BLOCK_SIZE;
+            rightSize = unknownLeft;
+        }
+        else
+        {
+            leftSize = unknownLeft / 2;
+            rightSize = unknownLeft - leftSize;
+        }
+
+        if (unknownLeft && !leftCount)
+        {
+            leftStart = 0;
+            for (std::size_t i = 0; i < leftSize; ++i)
+            {
+                leftOffsets[leftCount] = static_cast<unsigned char>(i);
+                leftCount += !less(collection[first + i], pivot);
+            }
+        }
+
+        if (unknownLeft && !rightCount)
+        {
+            rightStart = 0;
+            for (std::size_t i = 1; i <= rightSize; ++i)
+            {
+                rightOffsets[rightCount] = static_cast<unsigned char>(i);
+                rightCount += less(collection[last - i], pivot);
+            }
+        }
+
+        const std::size_t num = std::min(leftCount, rightCount);
+        PdqSwapOffsets(collection, first, last, leftOffsets + leftStart, rightOffsets + rightStart,
+                       num, leftCount == rightCount);
+        leftCount -= num;
+        rightCount -= num;
+        leftStart += num;
+        rightStart += num;
+
+        if (leftCount == 0)
+            first += leftSize;
+        if (rightCount == 0)
+            last -= rightSize;
+
+        if (leftCount)
+        {
+            leftOffsets += leftStart;
+            while (leftCount--)
+                std::swap(collection[first + leftOffsets[leftCount]], collection[--last]);
+            first = last;
+        }
+
+        if (rightCount)
+        {
+            rightOffsets += rightStart;
+            while (rightCount--)
+            {
+                std::swap(collection[last - rightOffsets[rightCount]], collection[first]);
+                ++first;
+            }
+            last = first;
+        }
+
+        const std::size_t pivotPosition = first - 1;
+        collection[begin] = std::move(collection[pivotPosition]);
+        collection[pivotPosition] = std::move(pivot);
+
+        return std::make_pair(pivotPosition, false);
+    }
+
+    /// @brief Moves the median of three (or the ninther for large ranges) to collection[begin],
+    /// which guarantees that an element not less than the pivot exists to the right of it
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @param collection 
+    /// @param begin First index of the range
+    /// @param end Index past the last element of the range, at least INSERTION_SORT_THRESHOLD after begin
+    /// @param less Strict weak ordering
+    template<Concepts::RandomAccess TCollection, typename TLess>
+    void PdqChoosePivot(TCollection&& collection, const std::size_t begin, const std::size_t end, TLess&& less)
+    {
+        const std::size_t size = end - begin;
+        const std::size_t half = size / 2;
+
+        if (size > NINTHER_THRESHOLD)
+        {
+            PdqSortThree(collection, begin, begin + half, end - 1, less);
+            PdqSortThree(collection, begin + 1, begin + (half - 1), end - 2, less);
+            PdqSortThree(collection, begin + 2, begin + (half + 1), end - 3, less);
+            PdqSortThree(collection, begin + (half - 1), begin + half, begin + (half + 1), less);
+            std::swap(collection[begin], collection[begin + half]);
+        }
+        else
+            PdqSortThree(collection, begin + half, begin, end - 1, less);
+    }
+
+    /// @brief Main loop of pattern-defeating quicksort over [begin, end)
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @param collection 
+    /// @param begin First index of the range
+    /// @param end Index past the last element of the range
+    /// @param less Strict weak ordering
+    /// @param badAllowed Number of highly unbalanced partitions allowed before switching to heap sort
+    /// @param leftmost Whether the range has no elements to the left of it
+    /// @param branchless Use block partitioning
+    template<Concepts::RandomAccess TCollection, typename TLess>
+    void PdqSortLoop(TCollection&& collection, std::size_t begin, const std::size_t end, TLess&& less,
+                     std::size_t badAllowed, bool leftmost, const bool branchless)
+    {
+        while (true)
+        {
+            const std::size_t size = end - begin;
+
+            if (size < INSERTION_SORT_THRESHOLD)
+            {
+                if (leftmost)
+                    PdqInsertionSort(collection, begin, end, less);
+                else
+                    PdqUnguardedInsertionSort(collection, begin, end, less);
+                return;
+            }
+
+            PdqChoosePivot(collection, begin, end, less);
+
+            // If the chosen pivot is equal to the predecessor, the range consists of equal elements
+            // on its left side, so they can be skipped in one pass.
+            if (!leftmost && !less(collection[begin - 1], collection[begin]))
+            {
+                begin = PdqPartitionLeft(collection, begin, end, less) + 1;
+                continue;
+            }
+
+            const auto [pivotPosition, alreadyPartitioned] = branchless
+                ? PdqPartitionRightBranchless(collection, begin, end, less)
+                : PdqPartitionRight(collection, begin, end, less);
+
+            const std::size_t leftSize = pivotPosition - begin;
+            const std::size_t rightSize = end - (pivotPosition + 1);
+
+            if (leftSize < size / 8 || rightSize < size / 8)
+            {
+                if (--badAllowed == 0)
+                {
+                    HeapSortRange(collection, begin, end, less);
+                    return;
+                }
+
+                if (leftSize >= INSERTION_SORT_THRESHOLD)
+                {
+                    std::swap(collection[begin], collection[begin + leftSize / 4]);
+                    std::swap(collection[pivotPosition - 1], collection[pivotPosition - leftSize / 4]);
+
+                    if (leftSize > NINTHER_THRESHOLD)
+                    {
+                        std::swap(collection[begin + 1], collection[begin + (leftSize / 4 + 1)]);
+                        std::swap(collection[begin + 2], collection[begin + (leftSize / 4 + 2)]);
+                        std::swap(collection[pivotPosition - 2], collection[pivotPosition - (leftSize / 4 + 1)]);
+                        std::swap(collection[pivotPosition - 3], collection[pivotPosition - (leftSize / 4 + 2)]);
+                    }
+                }
+
+                if (rightSize >= INSERTION_SORT_THRESHOLD)
+                {
+                    std::swap(collection[pivotPosition + 1], collection[pivotPosition + (1 + rightSize / 4)]);
+                    std::swap(collection[end - 1], collection[end - rightSize / 4]);
+
+                    if (rightSize > NINTHER_THRESHOLD)
+                    {
+                        std::swap(collection[pivotPosition + 2], collection[pivotPosition + (2 + rightSize / 4)]);
+                        std::swap(collection[pivotPosition + 3], collection[pivotPosition + (3 + rightSize / 4)]);
+                        std::swap(collection[end - 2], collection[end - (1 + rightSize / 4)]);
+                        std::swap(collection[end - 3], collection[end - (2 + rightSize / 4)]);
+                    }
+                }
+            }
+            else if (alreadyPartitioned &&
+                     PdqPartialInsertionSort(collection, begin, pivotPosition, less) &&
+                     PdqPartialInsertionSort(collection, pivotPosition + 1, end, less))
+                return;
+
+            PdqSortLoop(collection, begin, pivotPosition, less, badAllowed, leftmost, branchless);
+            begin = pivotPosition + 1;
+            leftmost = false;
+        }
+    }
+
+    /// @brief Pattern-defeating quicksort over [begin, end): median-of-three or ninther pivot selection,
+    /// partitioning of equal elements and a heap sort fallback, which guarantees O(n log n) in the worst case
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @param collection 
+    /// @param begin First index of the range
+    /// @param end Index past the last element of the range
+    /// @param less Strict weak ordering
+    /// @param branchless Use block partitioning, profitable for cheap comparisons only
+    template<Concepts::RandomAccess TCollection, typename TLess>
+    void PdqSort(TCollection&& collection, const std::size_t begin, const std::size_t end, TLess&& less,
+                 const bool branchless = false)
+    {
+        if (end - begin < 2)
+            return;
+        PdqSortLoop(collection, begin, end, less,
+                    static_cast<std::size_t>(std::bit_width(end - begin)), true, branchless);
+    }
+
+    /// @brief 
+    /// @tparam TCollection 
+    /// @tparam T 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param orderType 
+    /// @return 
+    template<Concepts::RandomAccess TCollection, Concepts::Comparable T = RandomAccessValueType<TCollection>>
+    std::size_t Partition(TCollection&& collection, const std::size_t start, const std::size_t end,
+                          const OrderType orderType) noexcept
+    {
+        auto i = static_cast<long long>(start);
+        auto j = static_cast<long long>(end);
+        const T pivot = collection[(start + end) / 2];
+
+        if (orderType == OrderType::ASC)
+        {
+            while (i <= j)
+            {
+                while (collection[i] < pivot)
+                    ++i;
+                while (collection[j] > pivot)
+                    --j;
+
+                if (i <= j)
+                {
+                    std::swap(collection[i], collection[j]);
+                    ++i;
+                    --j;
+                }
+            }
+        }
+        else
+        {
+            while (i <= j)
+            {
+                while (collection[i] > pivot)
+                    ++i;
+                while (collection[j] < pivot)
+                    --j;
+
+                if (i <= j)
+                {
+                    std::swap(collection[i], collection[j]);
+                    ++i;
+                    --j;
+                }
+            }
+        }
+
+        return i;
+    }
+
+    /// @brief 
+    /// @tparam TCollection 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param orderType 
+    template<Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>>
+    requires Concepts::Comparable<T>
+    void QuickSort(TCollection&& collection, const std::size_t start, const std::size_t end,
+                   const OrderType orderType = OrderType::ASC) noexcept
+    {
+        if (start >= end)
+            return;
+
+        constexpr bool branchless = std::is_arithmetic_v<T> || std::is_pointer_v<T>;
+
+        if (orderType == OrderType::ASC)
+            PdqSort(collection, start, end + 1, [](const T& left, const T& right) { return left < right; }, branchless);
+        else
+            PdqSort(collection, start, end + 1, [](const T& left, const T& right) { return left > right; }, branchless);
+    }
+
+    /// @brief 
+    /// @tparam T 
+    /// @tparam TCollection 
+    /// @tparam TSelector 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param selector 
+    /// @param orderType 
+    /// @return 
+    template<Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>,
+             std::invocable<T> TSelector>
+    requires Concepts::Comparable<std::invoke_result_t<TSelector, T>>
+    std::size_t Partition(TCollection&& collection, const std::size_t start, const std::size_t end,
+                                 TSelector&& selector, const OrderType orderType)
+    noexcept(std::is_nothrow_invocable_v<TSelector, T>)
+    {
+        using TSelect = std::invoke_result_t<TSelector, T>;
+
+        auto i = static_cast<long long>(start);
+        auto j = static_cast<long long>(end);
+        const TSelect pivot = selector(collection[(start + end) / 2]);
+
+        if (orderType == OrderType::ASC)
+        {
+            while (i <= j)
+            {
+                while (selector(collection[i]) < pivot)
+                    ++i;
+                while (selector(collection[j]) > pivot)
+                    --j;
+
+                if (i <= j)
+                {
+                    std::swap(collection[i], collection[j]);
+                    ++i;
+                    --j;
+                }
+            }
+        }
+        else
+        {
+            while (i <= j)
+            {
+                while (selector(collection[i]) > pivot)
+                    ++i;
+                while (selector(collection[j]) < pivot)
+                    --j;
+
+                if (i <= j)
+                {
+                    std::swap(collection[i], collection[j]);
+                    ++i;
+                    --j;
+                }
+            }
+        }
+
+        return i;
+    }
+
+    /// @brief 
+    /// @tparam T 
+    /// @tparam TCollection 
+    /// @tparam TSelector 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param selector 
+    /// @param orderType 
+    template<Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>,
+             std::invocable<T> TSelector>
+    requires Concepts::Comparable<std::invoke_result_t<TSelector, T>>
+    void QuickSort(TCollection&& collection, std::size_t start, std::size_t end,
+                   TSelector&& selector, const OrderType orderType = OrderType::ASC)
+    noexcept(std::is_nothrow_invocable_v<TSelector, T>)
+    {
+        if (start >= end)
+            return;
+
+        if (orderType == OrderType::ASC)
+            PdqSort(collection, start, end + 1, [&selector](const T& left, const T& right)
+                { return selector(left) < selector(right); });
+        else
+            PdqSort(collection, start, end + 1, [&selector](const T& left, const T& right)
+                { return selector(left) > selector(right); });
+    }
+
+    /// @brief Rearranges [start, start + order.size()) so that the element at relative index indexOf(order[i])
+    /// moves to start + i. Cycles of the permutation are followed in place, indexes are reset to identity
+    /// @tparam TCollection 
+    /// @tparam TOrder 
+    /// @tparam TIndexOf 
+    /// @tparam T 
+    /// @param collection 
+    /// @param start 
+    /// @param order 
+    /// @param indexOf Returns a mutable reference to the index stored in an element of order
+    template<Concepts::RandomAccess TCollection, typename TOrder, typename TIndexOf,
+             typename T = RandomAccessValueType<TCollection>>
+    void ApplyPermutation(TCollection&& collection, const std::size_t start, TOrder& order, TIndexOf&& indexOf)
+    {
+        for (std::size_t i = 0; i < order.size(); ++i)
+        {
+            if (indexOf(order[i]) == i)
+                continue;
+
+            T value = std::move(collection[start + i]);
+            std::size_t current = i;
+            while (indexOf(order[current]) != i)
+            {
+                const std::size_t next = indexOf(order[current]);
+                collection[start + current] = std::move(collection[start + next]);
+                indexOf(order[current]) = current;
+                current = next;
+            }
+            collection[start + current] = std::move(value);
+            indexOf(order[current]) = current;
+        }
+    }
+
+    /// @brief Decorate-sort-undecorate: the selector is invoked once per element, then (key, index) pairs
+    /// or indexes into the array of keys are sorted and the collection is permuted once.
+    /// Small trivially copyable keys are packed with their indexes, ties are broken by index, so the sort is stable
+    /// @tparam TCollection 
+    /// @tparam T 
+    /// @tparam TSelector 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param selector 
+    /// @param orderType 
+    template<Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>,
+             std::invocable<T> TSelector>
+    requires Concepts::Comparable<std::invoke_result_t<TSelector, T>>
+    void SchwartzianSort(TCollection&& collection, const std::size_t start, const std::size_t end,
+                         TSelector&& selector, const OrderType orderType = OrderType::ASC)
+    {
+        if (start >= end)
+            return;
+
+        using TKey = std::decay_t<std::invoke_result_t<TSelector, T>>;
+        const std::size_t size = end - start + 1;
+
+        if constexpr (std::is_trivially_copyable_v<TKey> && sizeof(TKey) <= PACKED_KEY_SIZE)
+        {
+            using TPair = std::pair<TKey, std::size_t>;
+            constexpr bool branchless = std::is_arithmetic_v<TKey> || std::is_pointer_v<TKey>;
+
+            std::vector<TPair> keys;
+            keys.reserve(size);
+            for (std::size_t i = 0; i < size; ++i)
+                keys.emplace_back(selector(collection[start + i]), i);
+
+            if (orderType == OrderType::ASC)
+                PdqSort(keys, 0, size, [](const TPair& left, const TPair& right)
+                    { return left.first < right.first || (!(right.first < left.first) && left.second < right.second); },
+                    branchless);
+            else
+                PdqSort(keys, 0, size, [](const TPair& left, const TPair& right)
+                    { return left.first > right.first || (!(right.first > left.first) && left.second < right.second); },
+                    branchless);
+
+            ApplyPermutation(collection, start, keys, [](TPair& key) -> std::size_t& { return key.second; });
+        }
+        else
+        {
+            std::vector<TKey> keys;
+            keys.reserve(size);
+            std::vector<std::size_t> indexes;
+            indexes.reserve(size);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                keys.push_back(selector(collection[start + i]));
+                indexes.push_back(i);
+            }
+
+            if (orderType == OrderType::ASC)
+                PdqSort(indexes, 0, size, [&keys](const std::size_t left, const std::size_t right)
+                    { return keys[left] < keys[right] || (!(keys[right] < keys[left]) && left < right); });
+            else
+                PdqSort(indexes, 0, size, [&keys](const std::size_t left, const std::size_t right)
+                    { return keys[left] > keys[right] || (!(keys[right] > keys[left]) && left < right); });
+
+            ApplyPermutation(collection, start, indexes, [](std::size_t& index) -> std::size_t& { return index; });
+        }
+    }
+
+    /// @brief Parallel pattern-defeating quicksort over [begin, end): the range is partitioned once,
+    /// one half is sorted by a new task and the other by the current thread until the depth is exhausted
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @param collection 
+    /// @param begin First index of the range
+    /// @param end Index past the last element of the range
+    /// @param less Strict weak ordering, invoked concurrently
+    /// @param depth Number of levels that may still fork tasks
+    /// @param leftmost Whether the range has no elements to the left of it
+    /// @param branchless Use block partitioning
+    template<Concepts::RandomAccess TCollection, typename TLess>
+    void ParallelPdqSort(TCollection&& collection, std::size_t begin, const std::size_t end, TLess&& less,
+                         const std::size_t depth, const bool leftmost, const bool branchless)
+    {
+        while (true)
+        {
+            if (depth == 0 || end - begin < PARALLEL_THRESHOLD)
+            {
+                if (end - begin > 1)
+                    PdqSortLoop(collection, begin, end, less,
+                                static_cast<std::size_t>(std::bit_width(end - begin)), leftmost, branchless);
+                return;
+            }
+
+            PdqChoosePivot(collection, begin, end, less);
+
+            if (!leftmost && !less(collection[begin - 1], collection[begin]))
+            {
+                begin = PdqPartitionLeft(collection, begin, end, less) + 1;
+                continue;
+            }
+
+            const std::size_t pivotPosition = branchless
+                ? PdqPartitionRightBranchless(collection, begin, end, less).first
+                : PdqPartitionRight(collection, begin, end, less).first;
+
+            // Both halves are disjoint and the pivot between them is never written again,
+            // so the tasks may read it as the predecessor of the right half.
+            auto leftTask = std::async(std::launch::async, [&collection, &less, begin, pivotPosition, depth, leftmost, branchless]
+            {
+                ParallelPdqSort(collection, begin, pivotPosition, less, depth - 1, leftmost, branchless);
+            });
+            ParallelPdqSort(collection, pivotPosition + 1, end, less, depth - 1, false, branchless);
+            leftTask.get();
+            return;
+        }
+    }
+
+    /// @brief 
+    /// @tparam TCollection 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param orderType 
+    /// @param threadCount Maximum number of threads, 0 means std::thread::hardware_concurrency()
+    template<Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>>
+    requires Concepts::Comparable<T>
+    void ParallelSort(TCollection&& collection, const std::size_t start, const std::size_t end,
+                      const OrderType orderType = OrderType::ASC, const std::size_t threadCount = 0)
+    {
+        if (start >= end)
+            return;
+
+        constexpr bool branchless = std::is_arithmetic_v<T> || std::is_pointer_v<T>;
+        const auto depth = static_cast<std::size_t>(std::bit_width(Parallel { .ThreadCount = threadCount }.Threads() - 1));
+
+        if (orderType == OrderType::ASC)
+            ParallelPdqSort(collection, start, end + 1, [](const T& left, const T& right) { return left < right; },
+                            depth, true, branchless);
+        else
+            ParallelPdqSort(collection, start, end + 1, [](const T& left, const T& right) { return left > right; },
+                            depth, true, branchless);
+    }
+
+    /// @brief 
+    /// @tparam TCollection 
+    /// @tparam T 
+    /// @tparam TSelector Must be safe to invoke concurrently
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param selector 
+    /// @param orderType 
+    /// @param threadCount Maximum number of threads, 0 means std::thread::hardware_concurrency()
+    template<Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>,
+             std::invocable<T> TSelector>
+    requires Concepts::Comparable<std::invoke_result_t<TSelector, T>>
+    void ParallelSort(TCollection&& collection, const std::size_t start, const std::size_t end,
+                      TSelector&& selector, const OrderType orderType = OrderType::ASC, const std::size_t threadCount = 0)
+    {
+        if (start >= end)
+            return;
+
+        const auto depth = static_cast<std::size_t>(std::bit_width(Parallel { .ThreadCount = threadCount }.Threads() - 1));
+
+        if (orderType == OrderType::ASC)
+            ParallelPdqSort(collection, start, end + 1, [&selector](const T& left, const T& right)
+                { return selector(left) < selector(right); }, depth, true, false);
+        else
+            ParallelPdqSort(collection, start, end + 1, [&selector](const T& left, const T& right)
+                { return selector(left) > selector(right); }, depth, true, false);
+    }
+
+    /// @brief Stably merges source[first1, last1) and source[first2, last2) into destination starting at out
+    /// @tparam TSource 
+    /// @tparam TDestination 
+    /// @tparam TLess 
+    /// @param source 
+    /// @param first1 
+    /// @param last1 
+    /// @param first2 
+    /// @param last2 
+    /// @param destination 
+    /// @param out 
+    /// @param less Strict weak ordering, elements of the first range win ties
+    template<Concepts::RandomAccess TSource, Concepts::RandomAccess TDestination, typename TLess>
+    void MergeInto(TSource&& source, std::size_t first1, const std::size_t last1,
+                   std::size_t first2, const std::size_t last2,
+                   TDestination&& destination, std::size_t out, TLess&& less)
+    {
+        while (first1 < last1 && first2 < last2)
+        {
+            if (less(source[first2], source[first1]))
+                destination[out++] = std::move(source[first2++]);
+            else
+                destination[out++] = std::move(source[first1++]);
+        }
+
+        while (first1 < last1)
+            destination[out++] = std::move(source[first1++]);
+        while (first2 < last2)
+            destination[out++] = std::move(source[first2++]);
+    }
+
+    /// @brief Merges sorted runs of source pairwise into destination, each merge is split
+    /// by binary search into independent parts that are processed by separate tasks
+    /// @tparam TSource 
+    /// @tparam TDestination 
+    /// @tparam TLess 
+    /// @param source 
+    /// @param sourceOffset Index of the first element of the runs in source
+    /// @param destination 
+    /// @param destinationOffset Index of the first element of the runs in destination
+    /// @param bounds Bounds of the runs relative to the offsets, replaced by the bounds of the merged runs
+    /// @param less Strict weak ordering
+    /// @param threadCount 
+    template<Concepts::RandomAccess TSource, Concepts::RandomAccess TDestination, typename TLess>
+    void ParallelMergePass(TSource&& source, const std::size_t sourceOffset,
+                           TDestination&& destination, const std::size_t destinationOffset,
+                           std::vector<std::size_t>& bounds, TLess&& less, const std::size_t threadCount)
+    {
+        const std::size_t merges = (bounds.size() - 1) / 2;
+        const std::size_t parts = std::max<std::size_t>(1, threadCount / std::max<std::size_t>(1, merges));
+
+        std::vector<std::future<void>> tasks;
+        std::vector<std::size_t> newBounds;
+        newBounds.reserve(merges + 2);
+
+        for (std::size_t run = 0; run + 1 < bounds.size(); run += 2)
+        {
+            newBounds.push_back(bounds[run]);
+
+            const std::size_t first1 = sourceOffset + bounds[run];
+            const std::size_t last1 = sourceOffset + bounds[run + 1];
+
+            if (run + 2 == bounds.size())
+            {
+                tasks.push_back(std::async(std::launch::async, [&source, &destination, &less, first1, last1,
+                                                                out = destinationOffset + bounds[run]]
+                {
+                    MergeInto(source, first1, last1, last1, last1, destination, out, less);
+                }));
+                continue;
+            }
+
+            const std::size_t last2 = sourceOffset + bounds[run + 2];
+            std::size_t partFirst1 = first1;
+            std::size_t partFirst2 = last1;
+
+            for (std::size_t part = 1; part <= parts; ++part)
+            {
+                std::size_t partLast1 = last1;
+                std::size_t partLast2 = last2;
+
+                if (part < parts)
+                {
+                    partLast1 = first1 + (last1 - first1) * part / parts;
+                    partLast2 = partFirst2;
+                    std::size_t count = last2 - partLast2;
+                    while (count > 0)
+                    {
+                        const std::size_t step = count / 2;
+                        if (less(source[partLast2 + step], source[partLast1]))
+                        {
+                            partLast2 += step + 1;
+                            count -= step + 1;
+                        }
+                        else
+                            count = step;
+                    }
+                }
+
+                const std::size_t out = destinationOffset + bounds[run] +
+                                        (partFirst1 - first1) + (partFirst2 - last1);
+                tasks.push_back(std::async(std::launch::async, [&source, &destination, &less,
+                                                                partFirst1, partLast1, partFirst2, partLast2, out]
+                {
+                    MergeInto(source, partFirst1, partLast1, partFirst2, partLast2, destination, out, less);
+                }));
+
+                partFirst1 = partLast1;
+                partFirst2 = partLast2;
+            }
+        }
+
+        for (auto& task : tasks)
+            task.get();
+
+        newBounds.push_back(bounds.back());
+        bounds = std::move(newBounds);
+    }
+
+    /// @brief Parallel stable merge sort over [begin, end): equal chunks are sorted by TimSort in separate tasks,
+    /// then merged pairwise in parallel, alternating between the collection and a buffer
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @tparam T 
+    /// @param collection 
+    /// @param begin First index of the range
+    /// @param end Index past the last element of the range
+    /// @param less Strict weak ordering, invoked concurrently
+    /// @param threadCount 
+    template<Concepts::RandomAccess TCollection, typename TLess,
+             typename T = RandomAccessValueType<TCollection>>
+    void ParallelStableSortRange(TCollection&& collection, const std::size_t begin, const std::size_t end,
+                                 TLess&& less, const std::size_t threadCount)
+    {
+        const std::size_t size = end - begin;
+        if (threadCount < 2 || size < PARALLEL_THRESHOLD)
+        {
+            TimSortRange(collection, begin, end, less);
+            return;
+        }
+
+        const std::size_t chunks = std::min(threadCount, size / (PARALLEL_THRESHOLD / 2));
+        std::vector<std::size_t> bounds;
+        bounds.reserve(chunks + 1);
+        for (std::size_t chunk = 0; chunk <= chunks; ++chunk)
+            bounds.push_back(size * chunk / chunks);
+
+        std::vector<std::future<void>> tasks;
+        tasks.reserve(chunks);
+        for (std::size_t chunk = 0; chunk < chunks; ++chunk)
+            tasks.push_back(std::async(std::launch::async, [&collection, &less,
+                                                            first = begin + bounds[chunk],
+                                                            last = begin + bounds[chunk + 1]]
+            {
+                TimSortRange(collection, first, last, less);
+            }));
+        for (auto& task : tasks)
+            task.get();
+
+        // The sorted chunks are moved to the buffer, so the first pass merges them back into the collection.
+        std::vector<T> buffer;
+        buffer.reserve(size);
+        for (std::size_t i = begin; i < end; ++i)
+            buffer.push_back(std::move(collection[i]));
+
+        bool inBuffer = true;
+        while (bounds.size() > 2)
+        {
+            if (inBuffer)
+                ParallelMergePass(buffer, 0, collection, begin, bounds, less, threadCount);
+            else
+                ParallelMergePass(collection, begin, buffer, 0, bounds, less, threadCount);
+            inBuffer = !inBuffer;
+        }
+
+        if (inBuffer)
+            for (std::size_t i = 0; i < size; ++i)
+                collection[begin + i] = std::move(buffer[i]);
+    }
+
+    /// @brief 
+    /// @tparam TCollection 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param orderType 
+    /// @param threadCount Maximum number of threads, 0 means std::thread::hardware_concurrency()
+    template<Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>>
+    requires Concepts::Comparable<T>
+    void ParallelStableSort(TCollection&& collection, const std::size_t start, const std::size_t end,
+                            const OrderType orderType = OrderType::ASC, const std::size_t threadCount = 0)
+    {
+        if (start >= end)
+            return;
+
+        const std::size_t threads = Parallel { .ThreadCount = threadCount }.Threads();
+
+        if (orderType == OrderType::ASC)
+            ParallelStableSortRange(collection, start, end + 1,
+                                    [](const T& left, const T& right) { return left < right; }, threads);
+        else
+            ParallelStableSortRange(collection, start, end + 1,
+                                    [](const T& left, const T& right) { return left > right; }, threads);
+    }
+
+    /// @brief 
+    /// @tparam TCollection 
+    /// @tparam T 
+    /// @tparam TSelector Must be safe to invoke concurrently
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param selector 
+    /// @param orderType 
+    /// @param threadCount Maximum number of threads, 0 means std::thread::hardware_concurrency()
+    template<Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>,
+             std::invocable<T> TSelector>
+    requires Concepts::Comparable<std::invoke_result_t<TSelector, T>>
+    void ParallelStableSort(TCollection&& collection, const std::size_t start, const std::size_t end,
+                            TSelector&& selector, const OrderType orderType = OrderType::ASC,
+                            const std::size_t threadCount = 0)
+    {
+        if (start >= end)
+            return;
+
+        const std::size_t threads = Parallel { .ThreadCount = threadCount }.Threads();
+
+        if (orderType == OrderType::ASC)
+            ParallelStableSortRange(collection, start, end + 1, [&selector](const T& left, const T& right)
+                { return selector(left) < selector(right); }, threads);
+        else
+            ParallelStableSortRange(collection, start, end + 1, [&selector](const T& left, const T& right)
+                { return selector(left) > selector(right); }, threads);
+    }
+
+    /// @brief Moves the element that would be at nth after sorting [begin, end) to nth, so that no element before it
+    /// is greater and no element after it is smaller. Pattern-defeating quickselect with a heap sort fallback
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @param collection 
+    /// @param begin First index of the range
+    /// @param end Index past the last element of the range
+    /// @param nth Index in [begin, end)
+    /// @param less Strict weak ordering
+    template<Concepts::RandomAccess TCollection, typename TLess>
+    void PdqSelect(TCollection&& collection, std::size_t begin, std::size_t end, const std::size_t nth, TLess&& less)
+    {
+        const std::size_t first = begin;
+        auto badAllowed = static_cast<std::size_t>(std::bit_width(end - begin));
+
+        while (end - begin >= INSERTION_SORT_THRESHOLD)
+        {
+            PdqChoosePivot(collection, begin, end, less);
+
+            // Elements equal to a previous pivot are already in their final positions.
+            if (begin != first && !less(collection[begin - 1], collection[begin]))
+            {
+                begin = PdqPartitionLeft(collection, begin, end, less) + 1;
+                if (nth < begin)
+                    return;
+                continue;
+            }
+
+            const std::size_t size = end - begin;
+            const std::size_t pivotPosition = PdqPartitionRight(collection, begin, end, less).first;
+            if (pivotPosition == nth)
+                return;
+
+            if ((pivotPosition - begin < size / 8 || end - (pivotPosition + 1) < size / 8) && --badAllowed == 0)
+            {
+                HeapSortRange(collection, begin, end, less);
+                return;
+            }
+
+            if (nth < pivotPosition)
+                end = pivotPosition;
+            else
+                begin = pivotPosition + 1;
+        }
+
+        PdqInsertionSort(collection, begin, end, less);
+    }
+
+    /// @brief Moves the k first elements of sorted [begin, end) to [begin, begin + k) in sorted order,
+    /// the order of the other elements is unspecified. Small k keep a bounded max-heap of the best elements seen,
+    /// larger k select the k-th element first, then only the selected elements are sorted
+    /// @tparam TCollection 
+    /// @tparam TLess 
+    /// @param collection 
+    /// @param begin First index of the range
+    /// @param end Index past the last element of the range
+    /// @param k Number of elements to select
+    /// @param less Strict weak ordering
+    template<Concepts::RandomAccess TCollection, typename TLess>
+    void TopKRange(TCollection&& collection, const std::size_t begin, const std::size_t end, const std::size_t k,
+                   TLess&& less)
+    {
+        const std::size_t size = end - begin;
+        if (k == 0)
+            return;
+
+        if (k >= size)
+        {
+            PdqSort(collection, begin, end, less);
+            return;
+        }
+
+        if (k <= size / TOP_K_HEAP_RATIO)
+        {
+            for (std::size_t i = k / 2; i > 0; --i)
+                SiftDown(collection, begin, i - 1, k, less);
+
+            for (std::size_t i = begin + k; i < end; ++i)
+            {
+                if (!less(collection[i], collection[begin]))
+                    continue;
+                std::swap(collection[i], collection[begin]);
+                SiftDown(collection, begin, 0, k, less);
             }
         }
+        else
+            PdqSelect(collection, begin, end, begin + k, less);
+
+        PdqSort(collection, begin, begin + k, less);
     }
 
-    /// @brief 
+    /// @brief Parallel TopKRange: each task selects the k first elements of its chunk,
+    /// then the winners of all chunks are gathered in front of the range and selected once more
     /// @tparam TCollection 
+    /// @tparam TLess 
     /// @param collection 
-    /// @param start 
-    /// @param end 
-    /// @param orderType 
-    template<typename TCollection>
-    void MergeSort(TCollection&& collection, const std::size_t start, const std::size_t end,
-                   const OrderType orderType = OrderType::ASC) noexcept
+    /// @param begin First index of the range
+    /// @param end Index past the last element of the range
+    /// @param k Number of elements to select
+    /// @param less Strict weak ordering, invoked concurrently
+    /// @param threadCount 
+    template<Concepts::RandomAccess TCollection, typename TLess>
+    void ParallelTopKRange(TCollection&& collection, const std::size_t begin, const std::size_t end, const std::size_t k,
+                           TLess&& less, const std::size_t threadCount)
     {
-        if (start >= end)
+        const std::size_t size = end - begin;
+        if (threadCount < 2 || size < PARALLEL_THRESHOLD || k >= size / 2)
+        {
+            TopKRange(collection, begin, end, k, less);
             return;
-        const std::size_t mid = (start + end) / 2;
-        MergeSort(std::forward<TCollection>(collection), start, mid, orderType);
-        MergeSort(std::forward<TCollection>(collection), mid + 1, end, orderType);
-        Merge(std::forward<TCollection>(collection), start, mid, end, orderType);
+        }
+
+        const std::size_t chunks = std::min(threadCount, size / (PARALLEL_THRESHOLD / 2));
+        std::vector<std::size_t> bounds;
+        bounds.reserve(chunks + 1);
+        for (std::size_t chunk = 0; chunk <= chunks; ++chunk)
+            bounds.push_back(begin + size * chunk / chunks);
+
+        std::vector<std::future<void>> tasks;
+        tasks.reserve(chunks);
+        for (std::size_t chunk = 0; chunk < chunks; ++chunk)
+            tasks.push_back(std::async(std::launch::async, [&collection, &less, k,
+                                                            first = bounds[chunk], last = bounds[chunk + 1]]
+            {
+                TopKRange(collection, first, last, std::min(k, last - first), less);
+            }));
+        for (auto& task : tasks)
+            task.get();
+
+        // Every chunk is at least as long as the winners gathered before it, so a winner is never overwritten.
+        std::size_t gathered = begin;
+        for (std::size_t chunk = 0; chunk < chunks; ++chunk)
+        {
+            const std::size_t winners = std::min(k, bounds[chunk + 1] - bounds[chunk]);
+            for (std::size_t i = bounds[chunk]; i < bounds[chunk] + winners; ++i)
+                std::swap(collection[gathered++], collection[i]);
+        }
+
+        TopKRange(collection, begin, gathered, k, less);
     }
 
-    /// @brief 
-    /// @tparam T 
+    /// @brief Decorate-select-undecorate: the selector is invoked once per element, then the first count
+    /// (key, index) pairs or indexes into the array of keys are selected and the collection is permuted once.
+    /// Ties are broken by index, so the selected elements keep their relative order
     /// @tparam TCollection 
+    /// @tparam T 
     /// @tparam TSelector 
     /// @param collection 
     /// @param start 
-    /// @param mid 
     /// @param end 
+    /// @param count 
     /// @param selector 
     /// @param orderType 
+    /// @param threadCount 1 selects on the current thread
     template<Concepts::RandomAccess TCollection,
              typename T = RandomAccessValueType<TCollection>,
              std::invocable<T> TSelector>
     requires Concepts::Comparable<std::invoke_result_t<TSelector, T>>
-    void Merge(TCollection&& collection, const std::size_t start, const std::size_t mid, const std::size_t end,
-               TSelector&& selector, const OrderType orderType)
-    noexcept(std::is_nothrow_invocable_v<TSelector, T>)
+    void SchwartzianTopK(TCollection&& collection, const std::size_t start, const std::size_t end,
+                         const std::size_t count, TSelector&& selector, const OrderType orderType,
+                         const std::size_t threadCount)
     {
-        const std::size_t n1 = mid - start + 1;
-        const std::size_t n2 = end - mid;
+        if (start > end || count == 0)
+            return;
 
-        std::vector<T> array1;
-        array1.reserve(n1);
-        std::vector<T> array2;
-        array2.reserve(n2);
+        using TKey = std::decay_t<std::invoke_result_t<TSelector, T>>;
+        const std::size_t size = end - start + 1;
 
-        for (std::size_t i = start; i <= mid; ++i)
-            array1.push_back(collection[i]);
-        for (std::size_t i = mid + 1; i <= end; ++i)
-            array2.push_back(collection[i]);
+        if constexpr (std::is_trivially_copyable_v<TKey> && sizeof(TKey) <= PACKED_KEY_SIZE)
+        {
+            using TPair = std::pair<TKey, std::size_t>;
 
-        std::size_t i = 0, j = 0;
+            std::vector<TPair> keys;
+            keys.reserve(size);
+            for (std::size_t i = 0; i < size; ++i)
+                keys.emplace_back(selector(collection[start + i]), i);
 
-        if (orderType == OrderType::ASC)
-        {
-            for (std::size_t k = start; k <= end; ++k)
-            {
-                if (i != n1 && (j == n2 || selector(array1[i]) < selector(array2[j])))
-                {
-                    collection[k] = array1[i];
-                    ++i;
-                }
-                else if (j != n2 && (i == n1 || selector(array2[j]) < selector(array1[i])))
-                {
-                    collection[k] = array2[j];
-                    ++j;
-                }
-                else if (i != n1 && (j == n2 || selector(array1[i]) == selector(array2[j])))
-                {
-                    collection[k] = array1[i];
-                    ++i;
-                }
-            }
+            if (orderType == OrderType::ASC)
+                ParallelTopKRange(keys, 0, size, count, [](const TPair& left, const TPair& right)
+                    { return left.first < right.first || (!(right.first < left.first) && left.second < right.second); },
+                    threadCount);
+            else
+                ParallelTopKRange(keys, 0, size, count, [](const TPair& left, const TPair& right)
+                    { return left.first > right.first || (!(right.first > left.first) && left.second < right.second); },
+                    threadCount);
+
+            ApplyPermutation(collection, start, keys, [](TPair& key) -> std::size_t& { return key.second; });
         }
         else
         {
-            for (std::size_t k = start; k <= end; ++k)
+            std::vector<TKey> keys;
+            keys.reserve(size);
+            std::vector<std::size_t> indexes;
+            indexes.reserve(size);
+            for (std::size_t i = 0; i < size; ++i)
             {
-                if (i != n1 && (j == n2 || selector(array2[j]) < selector(array1[i])))
-                {
-                    collection[k] = array1[i];
-                    ++i;
-                }
-                else if (j != n2 && (i == n1 || selector(array1[i]) < selector(array2[j])))
-                {
-                    collection[k] = array2[j];
-                    ++j;
-                }
-                else if (j != n2 && (i == n1 || selector(array1[i]) == selector(array2[j])))
-                {
-                    collection[k] = array2[j];
-                    ++j;
-                }
+                keys.push_back(selector(collection[start + i]));
+                indexes.push_back(i);
             }
+
+            if (orderType == OrderType::ASC)
+                ParallelTopKRange(indexes, 0, size, count, [&keys](const std::size_t left, const std::size_t right)
+                    { return keys[left] < keys[right] || (!(keys[right] < keys[left]) && left < right); },
+                    threadCount);
+            else
+                ParallelTopKRange(indexes, 0, size, count, [&keys](const std::size_t left, const std::size_t right)
+                    { return keys[left] > keys[right] || (!(keys[right] > keys[left]) && left < right); },
+                    threadCount);
+
+            ApplyPermutation(collection, start, indexes, [](std::size_t& index) -> std::size_t& { return index; });
         }
     }
 
-    /// @brief 
-    /// @tparam T 
+    /// @brief Moves the count first elements of the sorted range to its beginning in sorted order
+    /// without sorting the whole range, the order of the other elements is unspecified
+    /// @tparam TCollection 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param count 
+    /// @param orderType 
+    template<Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>>
+    requires Concepts::Comparable<T>
+    void TopK(TCollection&& collection, const std::size_t start, const std::size_t end, const std::size_t count,
+              const OrderType orderType = OrderType::ASC) noexcept
+    {
+        if (start > end)
+            return;
+
+        if (orderType == OrderType::ASC)
+            TopKRange(collection, start, end + 1, count, [](const T& left, const T& right) { return left < right; });
+        else
+            TopKRange(collection, start, end + 1, count, [](const T& left, const T& right) { return left > right; });
+    }
+
+    /// @brief Moves the count first elements of the range stably sorted by selector to its beginning,
+    /// the selector is invoked once per element
     /// @tparam TCollection 
+    /// @tparam T 
     /// @tparam TSelector 
     /// @param collection 
     /// @param start 
     /// @param end 
+    /// @param count 
     /// @param selector 
     /// @param orderType 
     template<Concepts::RandomAccess TCollection,
              typename T = RandomAccessValueType<TCollection>,
              std::invocable<T> TSelector>
-    void MergeSort(TCollection&& collection, const std::size_t start, const std::size_t end,
-                   TSelector&& selector, const OrderType orderType = OrderType::ASC)
-    noexcept(std::is_nothrow_invocable_v<TSelector, T>)
+    requires Concepts::Comparable<std::invoke_result_t<TSelector, T>>
+    void TopK(TCollection&& collection, const std::size_t start, const std::size_t end, const std::size_t count,
+              TSelector&& selector, const OrderType orderType = OrderType::ASC)
     {
-        if (start >= end)
-            return;
-        const std::size_t mid = (start + end) / 2;
-        MergeSort(std::forward<TCollection>(collection), start, mid, selector, orderType);
-        MergeSort(std::forward<TCollection>(collection), mid + 1, end, selector, orderType);
-        Merge(std::forward<TCollection>(collection), start, mid, end, selector, orderType);
+        SchwartzianTopK(collection, start, end, count, std::forward<TSelector>(selector), orderType, 1);
     }
 
     /// @brief 
     /// @tparam TCollection 
-    /// @tparam T 
     /// @param collection 
     /// @param start 
     /// @param end 
+    /// @param count 
     /// @param orderType 
-    template<Concepts::RandomAccess TCollection, Concepts::Comparable T = RandomAccessValueType<TCollection>>
-    void TimSort(TCollection&& collection, const std::size_t start, const std::size_t end,
-                 const OrderType orderType = OrderType::ASC) noexcept
+    /// @param threadCount Maximum number of threads, 0 means std::thread::hardware_concurrency()
+    template<Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>>
+    requires Concepts::Comparable<T>
+    void ParallelTopK(TCollection&& collection, const std::size_t start, const std::size_t end, const std::size_t count,
+                      const OrderType orderType = OrderType::ASC, const std::size_t threadCount = 0)
     {
-        if (start >= end)
+        if (start > end)
             return;
-        const std::size_t count = end + 1 - start;
 
-        for (std::size_t i = 0; i < count; i += RUN)
-        {
-            if (i + RUN - 1 < count - 1)
-                InsertionSort(std::forward<TCollection>(collection), i, i + RUN - 1, orderType);
-            else
-                InsertionSort(std::forward<TCollection>(collection), i, count - 1, orderType);
-        }
+        const std::size_t threads = Parallel { .ThreadCount = threadCount }.Threads();
 
-        for (std::size_t size = RUN; size < count; size = 2 * size)
-            for (std::size_t left = 0; left < count; left += 2 * size)
-            {
-                const std::size_t mid = left + size - 1;
-                std::size_t right = left + 2 * size - 1;
-                if (count - 1 < (left + 2 * size - 1))
-                    right = count - 1;
-                if (mid < right)
-                    Merge(collection, left, mid, right, orderType);
-            }
+        if (orderType == OrderType::ASC)
+            ParallelTopKRange(collection, start, end + 1, count,
+                              [](const T& left, const T& right) { return left < right; }, threads);
+        else
+            ParallelTopKRange(collection, start, end + 1, count,
+                              [](const T& left, const T& right) { return left > right; }, threads);
     }
 
     /// @brief 
-    /// @tparam T 
     /// @tparam TCollection 
-    /// @tparam TSelector 
+    /// @tparam T 
+    /// @tparam TSelector Must be safe to invoke concurrently
     /// @param collection 
     /// @param start 
     /// @param end 
+    /// @param count 
     /// @param selector 
     /// @param orderType 
+    /// @param threadCount Maximum number of threads, 0 means std::thread::hardware_concurrency()
     template<Concepts::RandomAccess TCollection,
              typename T = RandomAccessValueType<TCollection>,
              std::invocable<T> TSelector>
     requires Concepts::Comparable<std::invoke_result_t<TSelector, T>>
-    void TimSort(TCollection&& collection, const std::size_t start, const std::size_t end,
-                 TSelector&& selector, const OrderType orderType = OrderType::ASC)
-    noexcept(std::is_nothrow_invocable_v<TSelector, T>)
+    void ParallelTopK(TCollection&& collection, const std::size_t start, const std::size_t end, const std::size_t count,
+                      TSelector&& selector, const OrderType orderType = OrderType::ASC,
+                      const std::size_t threadCount = 0)
     {
-        if (start >= end)
+        SchwartzianTopK(collection, start, end, count, std::forward<TSelector>(selector), orderType,
+                        Parallel { .ThreadCount = threadCount }.Threads());
+    }
+
+    /// @brief Maps a value to an unsigned key of the same width whose unsigned order matches the order of values:
+    /// the sign bit of integers is flipped, negative floats have all bits inverted and positive floats the sign bit
+    /// @tparam T 
+    /// @param value 
+    /// @param orderType DESC inverts the key
+    /// @return 
+    template<Concepts::RadixSortable T>
+    auto ToRadixKey(const T value, const OrderType orderType) noexcept
+    {
+        using TKey = std::conditional_t<sizeof(T) == 1, std::uint8_t,
+                     std::conditional_t<sizeof(T) == 2, std::uint16_t,
+                     std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>>;
+        constexpr TKey signBit = static_cast<TKey>(TKey { 1 } << (sizeof(T) * 8 - 1));
+
+        TKey key;
+        if constexpr (std::floating_point<T>)
+        {
+            key = std::bit_cast<TKey>(value);
+            key = (key & signBit) != 0 ? static_cast<TKey>(~key) : static_cast<TKey>(key | signBit);
+        }
+        else if constexpr (std::signed_integral<T>)
+            key = static_cast<TKey>(static_cast<TKey>(value) ^ signBit);
+        else
+            key = static_cast<TKey>(value);
+
+        return orderType == OrderType::ASC ? key : static_cast<TKey>(~key);
+    }
+
+    /// @brief Stable LSD radix sort over [begin, end) by one byte per pass.
+    /// Histograms of all bytes are built in a single pass and bytes equal for all elements are skipped
+    /// @tparam TCollection 
+    /// @tparam TKeyOf 
+    /// @tparam T 
+    /// @param collection 
+    /// @param begin First index of the range
+    /// @param end Index past the last element of the range
+    /// @param keyOf Returns unsigned integer key of the element
+    template<Concepts::RandomAccess TCollection, typename TKeyOf,
+             typename T = RandomAccessValueType<TCollection>>
+    void LsdRadixSortRange(TCollection&& collection, const std::size_t begin, const std::size_t end, TKeyOf&& keyOf)
+    {
+        using TKey = std::decay_t<std::invoke_result_t<TKeyOf, const T&>>;
+        const std::size_t size = end - begin;
+
+        if (size < RADIX_THRESHOLD)
+        {
+            StableSortRange(collection, begin, end, [&keyOf](const T& left, const T& right)
+                { return keyOf(left) < keyOf(right); });
             return;
-        const std::size_t count = end + 1 - start;
+        }
+
+        std::array<std::array<std::size_t, RADIX>, sizeof(TKey)> counts {};
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            const TKey key = keyOf(collection[i]);
+            for (std::size_t digit = 0; digit < sizeof(TKey); ++digit)
+                ++counts[digit][(key >> (digit * 8)) & (RADIX - 1)];
+        }
 
-        for (std::size_t i = 0; i < count; i += RUN)
+        // Elements are moved to the buffer, so the first scatter writes them back into the collection.
+        std::vector<T> buffer;
+        buffer.reserve(size);
+        for (std::size_t i = begin; i < end; ++i)
+            buffer.push_back(std::move(collection[i]));
+
+        bool inBuffer = true;
+        for (std::size_t digit = 0; digit < sizeof(TKey); ++digit)
         {
-            if (i + RUN - 1 < count - 1)
-                InsertionSort(std::forward<TCollection>(collection), i, i + RUN - 1, selector, orderType);
+            auto& offsets = counts[digit];
+            if (std::ranges::find(offsets, size) != offsets.end())
+                continue;
+
+            std::size_t offset = 0;
+            for (auto& count : offsets)
+                offset += std::exchange(count, offset);
+
+            const std::size_t shift = digit * 8;
+            if (inBuffer)
+                for (std::size_t i = 0; i < size; ++i)
+                    collection[begin + offsets[(keyOf(buffer[i]) >> shift) & (RADIX - 1)]++] = std::move(buffer[i]);
             else
-                InsertionSort(std::forward<TCollection>(collection), i, count - 1, selector, orderType);
+                for (std::size_t i = begin; i < end; ++i)
+                    buffer[offsets[(keyOf(collection[i]) >> shift) & (RADIX - 1)]++] = std::move(collection[i]);
+            inBuffer = !inBuffer;
         }
 
-        for (std::size_t size = RUN; size < count; size = 2 * size)
-            for (std::size_t left = 0; left < count; left += 2 * size)
-            {
-                const std::size_t mid = left + size - 1;
-                std::size_t right = left + 2 * size - 1;
-                if (count - 1 < (left + 2 * size - 1))
-                    right = count - 1;
-                if (mid < right)
-                    Merge(collection, left, mid, right, selector, orderType);
-            }
+        if (inBuffer)
+            for (std::size_t i = 0; i < size; ++i)
+                collection[begin + i] = std::move(buffer[i]);
     }
 
-    /// @brief 
+    /// @brief Stable MSD radix sort of strings over [begin, end) starting from the character at depth.
+    /// Strings that end at depth form the first bucket, small buckets are finished by insertion sort
     /// @tparam TCollection 
+    /// @tparam TKeyOf 
     /// @tparam T 
     /// @param collection 
-    /// @param start 
-    /// @param end 
+    /// @param begin First index of the range
+    /// @param end Index past the last element of the range
+    /// @param depth Length of the prefix shared by all strings of the range
+    /// @param buffer Scratch storage for scattering, its capacity is reused between calls
+    /// @param keyOf Returns std::string_view of the element
     /// @param orderType 
-    /// @return 
-    template<Concepts::RandomAccess TCollection, Concepts::Comparable T = RandomAccessValueType<TCollection>>
-    std::size_t Partition(TCollection&& collection, const std::size_t start, const std::size_t end,
-                          const OrderType orderType) noexcept
+    template<Concepts::RandomAccess TCollection, typename TKeyOf,
+             typename T = RandomAccessValueType<TCollection>>
+    void MsdRadixSortRange(TCollection&& collection, const std::size_t begin, const std::size_t end,
+                           std::size_t depth, std::vector<T>& buffer, TKeyOf&& keyOf, const OrderType orderType)
     {
-        auto i = static_cast<long long>(start);
-        auto j = static_cast<long long>(end);
-        const T pivot = collection[(start + end) / 2];
+        const auto bucketOf = [&keyOf, &depth](const T& element) -> std::size_t
+        {
+            const std::string_view key = keyOf(element);
+            return depth < key.size() ? 1 + static_cast<unsigned char>(key[depth]) : 0;
+        };
 
-        if (orderType == OrderType::ASC)
+        while (true)
         {
-            while (i <= j)
+            if (end - begin < INSERTION_SORT_THRESHOLD)
             {
-                while (collection[i] < pivot)
-                    ++i;
-                while (collection[j] > pivot)
-                    --j;
-
-                if (i <= j)
-                {
-                    std::swap(collection[i], collection[j]);
-                    ++i;
-                    --j;
-                }
+                if (orderType == OrderType::ASC)
+                    PdqInsertionSort(collection, begin, end, [&keyOf, depth](const T& left, const T& right)
+                        { return keyOf(left).substr(depth) < keyOf(right).substr(depth); });
+                else
+                    PdqInsertionSort(collection, begin, end, [&keyOf, depth](const T& left, const T& right)
+                        { return keyOf(left).substr(depth) > keyOf(right).substr(depth); });
+                return;
             }
-        }
-        else
-        {
-            while (i <= j)
+
+            std::array<std::size_t, RADIX + 1> counts {};
+            for (std::size_t i = begin; i < end; ++i)
+                ++counts[bucketOf(collection[i])];
+
+            if (counts[0] == end - begin)
+                return;
+
+            // All strings continue with the same character, so only the depth changes.
+            if (std::ranges::find(counts, end - begin) != counts.end())
             {
-                while (collection[i] > pivot)
-                    ++i;
-                while (collection[j] < pivot)
-                    --j;
+                ++depth;
+                continue;
+            }
 
-                if (i <= j)
-                {
-                    std::swap(collection[i], collection[j]);
-                    ++i;
-                    --j;
-                }
+            std::array<std::size_t, RADIX + 1> offsets {};
+            std::size_t offset = begin;
+            for (std::size_t bucket = 0; bucket <= RADIX; ++bucket)
+            {
+                const std::size_t ordered = orderType == OrderType::ASC ? bucket : RADIX - bucket;
+                offsets[ordered] = offset;
+                offset += counts[ordered];
             }
-        }
 
-        return i;
+            buffer.clear();
+            for (std::size_t i = begin; i < end; ++i)
+                buffer.push_back(std::move(collection[i]));
+            for (auto& element : buffer)
+                collection[offsets[bucketOf(element)]++] = std::move(element);
+
+            for (std::size_t bucket = 1; bucket <= RADIX; ++bucket)
+                if (counts[bucket] > 1)
+                    MsdRadixSortRange(collection, offsets[bucket] - counts[bucket], offsets[bucket],
+                                      depth + 1, buffer, keyOf, orderType);
+            return;
+        }
     }
 
-    /// @brief 
+    /// @brief LSD radix sort of integers and floating point numbers
     /// @tparam TCollection 
+    /// @tparam T 
     /// @param collection 
     /// @param start 
     /// @param end 
     /// @param orderType 
-    template<typename TCollection>
-    void QuickSort(TCollection&& collection, const std::size_t start, const std::size_t end,
-                   const OrderType orderType = OrderType::ASC) noexcept
+    template<Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>>
+    requires Concepts::RadixSortable<T>
+    void RadixSort(TCollection&& collection, const std::size_t start, const std::size_t end,
+                   const OrderType orderType = OrderType::ASC)
     {
-        if (end - start <= RUN)
-        {
-            InsertionSort(std::forward<TCollection>(collection), start, end, orderType);
+        if (start >= end)
             return;
-        }
-
-        const std::size_t mid = Partition(std::forward<TCollection>(collection), start, end, orderType);
 
-        if (start < mid - 1)
-            QuickSort(std::forward<TCollection>(collection), start, mid - 1, orderType);
-        if (mid < end)
-            QuickSort(std::forward<TCollection>(collection), mid, end, orderType);
+        LsdRadixSortRange(collection, start, end + 1, [orderType](const T value)
+            { return ToRadixKey(value, orderType); });
     }
 
-    /// @brief 
+    /// @brief MSD radix sort of strings
+    /// @tparam TCollection 
     /// @tparam T 
+    /// @param collection 
+    /// @param start 
+    /// @param end 
+    /// @param orderType 
+    template<Concepts::RandomAccess TCollection,
+             typename T = RandomAccessValueType<TCollection>>
+    requires std::convertible_to<const T&, std::string_view>
+    void RadixSort(TCollection&& collection, const std::size_t start, const std::size_t end,
+                   const OrderType orderType = OrderType::ASC)
+    {
+        if (start >= end)
+            return;
+
+        std::vector<T> buffer;
+        MsdRadixSortRange(collection, start, end + 1, 0, buffer, [](const T& element)
+            { return std::string_view(element); }, orderType);
+    }
+
+    /// @brief Stable LSD radix sort by integer or floating point keys, the selector is invoked once per element
     /// @tparam TCollection 
+    /// @tparam T 
     /// @tparam TSelector 
     /// @param collection 
     /// @param start 
     /// @param end 
     /// @param selector 
     /// @param orderType 
-    /// @return 
     template<Concepts::RandomAccess TCollection,
              typename T = RandomAccessValueType<TCollection>,
              std::invocable<T> TSelector>
-    requires Concepts::Comparable<std::invoke_result_t<TSelector, T>>
-    std::size_t Partition(TCollection&& collection, const std::size_t start, const std::size_t end,
-                                 TSelector&& selector, const OrderType orderType)
-    noexcept(std::is_nothrow_invocable_v<TSelector, T>)
+    requires Concepts::RadixSortable<std::decay_t<std::invoke_result_t<TSelector, T>>>
+    void RadixSort(TCollection&& collection, const std::size_t start, const std::size_t end,
+                   TSelector&& selector, const OrderType orderType = OrderType::ASC)
     {
-        using TSelect = std::invoke_result_t<TSelector, T>;
-
-        auto i = static_cast<long long>(start);
-        auto j = static_cast<long long>(end);
-        const TSelect pivot = selector(collection[(start + end) / 2]);
-
-        if (orderType == OrderType::ASC)
-        {
-            while (i <= j)
-            {
-                while (selector(collection[i]) < pivot)
-                    ++i;
-                while (selector(collection[j]) > pivot)
-                    --j;
+        if (start >= end)
+            return;
 
-                if (i <= j)
-                {
-                    std::swap(collection[i], collection[j]);
-                    ++i;
-                    --j;
-                }
-            }
-        }
-        else
-        {
-            while (i <= j)
-            {
-                while (selector(collection[i]) > pivot)
-                    ++i;
-                while (selector(collection[j]) < pivot)
-                    --j;
+        using TKey = decltype(ToRadixKey(selector(collection[start]), orderType));
+        std::vector<std::pair<TKey, std::size_t>> keys;
+        keys.reserve(end - start + 1);
+        for (std::size_t i = start; i <= end; ++i)
+            keys.emplace_back(ToRadixKey(selector(collection[i]), orderType), i - start);
 
-                if (i <= j)
-                {
-                    std::swap(collection[i], collection[j]);
-                    ++i;
-                    --j;
-                }
-            }
-        }
+        LsdRadixSortRange(keys, 0, keys.size(), [](const std::pair<TKey, std::size_t>& key)
+            { return key.first; });
 
-        return i;
+        ApplyPermutation(collection, start, keys, [](std::pair<TKey, std::size_t>& key) -> std::size_t&
+            { return key.second; });
     }
 
-    /// @brief 
-    /// @tparam T 
+    /// @brief Stable MSD radix sort by string keys, the selector is invoked once per element
     /// @tparam TCollection 
+    /// @tparam T 
     /// @tparam TSelector 
     /// @param collection 
     /// @param start 
@@ -847,24 +3034,30 @@ namespace ExtendedCpp::LINQ::Sort
     template<Concepts::RandomAccess TCollection,
              typename T = RandomAccessValueType<TCollection>,
              std::invocable<T> TSelector>
-    requires Concepts::Comparable<std::invoke_result_t<TSelector, T>>
-    void QuickSort(TCollection&& collection, std::size_t start, std::size_t end,
+    requires std::convertible_to<const std::decay_t<std::invoke_result_t<TSelector, T>>&, std::string_view>
+    void RadixSort(TCollection&& collection, const std::size_t start, const std::size_t end,
                    TSelector&& selector, const OrderType orderType = OrderType::ASC)
-    noexcept(std::is_nothrow_invocable_v<TSelector, T>)
     {
-        if (end - start <= RUN)
-        {
-            InsertionSort(std::forward<TCollection>(collection), start, end, std::forward<TSelector>(selector), orderType);
+        if (start >= end)
             return;
+
+        using TKey = std::decay_t<std::invoke_result_t<TSelector, T>>;
+        std::vector<TKey> keys;
+        keys.reserve(end - start + 1);
+        std::vector<std::size_t> indexes;
+        indexes.reserve(end - start + 1);
+        for (std::size_t i = start; i <= end; ++i)
+        {
+            keys.push_back(selector(collection[i]));
+            indexes.push_back(i - start);
         }
 
-        const std::size_t mid = Partition(std::forward<TCollection>(collection), start, end, std::forward<TSelector>(selector), orderType);
+        std::vector<std::size_t> buffer;
+        MsdRadixSortRange(indexes, 0, indexes.size(), 0, buffer, [&keys](const std::size_t index)
+            { return std::string_view(keys[index]); }, orderType);
 
-        if (start < mid - 1)
-            QuickSort(std::forward<TCollection>(collection), start, mid - 1, selector, orderType);
-        if (mid < end)
-            QuickSort(std::forward<TCollection>(collection), mid, end, selector, orderType);
+        ApplyPermutation(collection, start, indexes, [](std::size_t& index) -> std::size_t& { return index; });
     }
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,132 @@
+#ifndef LINQ_SortedIndex_H
+#define LINQ_SortedIndex_H
+
+#include <vector>
+#include <bit>
+#include <concepts>
+#include <algorithm>
+#include <utility>
+
+#include <ExtendedCpp/LINQ/Algorithm.h>
+#include <ExtendedCpp/LINQ/Sort.h>
+#include <ExtendedCpp/LINQ/Concepts.h>
+
+/// @brief
+namespace ExtendedCpp::LINQ
+{
+    /// @brief Read-only sorted set of elements for frequent searches. Elements are stored in Eytzinger layout:
+    /// the node k has children 2k and 2k + 1, so the first levels of every search share the same cache lines
+    /// and the next levels are prefetched while the current one is compared
+    /// @tparam T
+    template<std::copyable T>
+    requires Concepts::Comparable<T>
+    class SortedIndex final
+    {
+    public:
+        /// @brief Number of nodes in a cache line. Descendants of the node k at the fourth level below it
+        /// for four-byte elements are stored in one line starting from the node k * NODES_PER_LINE
+        static constexpr std::size_t NODES_PER_LINE = sizeof(T) < 64 ? 64 / sizeof(T) : 1;
+
+        /// @brief
+        SortedIndex() = default;
+
+        /// @brief Sorts the collection if it is not sorted yet
+        /// @param collection
+        explicit SortedIndex(std::vector<T> collection)
+        {
+            if (collection.empty())
+                return;
+
+            if (!std::is_sorted(collection.begin(), collection.end()))
+                Sort::QuickSort(collection, 0, collection.size() - 1);
+
+            _tree.assign(collection.size() + 1, collection.front());
+            std::size_t next = 0;
+            Build(collection, next, 1);
+        }
+
+        /// @brief
+        /// @return
+        [[nodiscard]]
+        std::size_t size() const noexcept
+        {
+            return _tree.empty() ? 0 : _tree.size() - 1;
+        }
+
+        /// @brief
+        /// @return
+        [[nodiscard]]
+        bool empty() const noexcept
+        {
+            return _tree.empty();
+        }
+
+        /// @brief
+        /// @param key
+        /// @return The least element that is not less than key, or nullptr
+        const T* LowerBound(const T& key) const noexcept
+        {
+            const std::size_t node = LowerBoundNode(key);
+            return node == 0 ? nullptr : &_tree[node];
+        }
+
+        /// @brief
+        /// @param key
+        /// @return
+        bool Contains(const T& key) const noexcept
+        {
+            const std::size_t node = LowerBoundNode(key);
+            return node != 0 && _tree[node] == key;
+        }
+
+        /// @brief
+        /// @return Elements in sorted order
+        [[nodiscard]]
+        std::vector<T> ToVector() const
+        {
+            std::vector<T> collection;
+            collection.reserve(size());
+            Collect(collection, 1);
+            return collection;
+        }
+
+    private:
+        std::vector<T> _tree;
+
+        void Build(const std::vector<T>& sorted, std::size_t& next, const std::size_t node)
+        {
+            if (node >= _tree.size())
+                return;
+            Build(sorted, next, 2 * node);
+            _tree[node] = sorted[next++];
+            Build(sorted, next, 2 * node + 1);
+        }
+
+        void Collect(std::vector<T>& collection, const std::size_t node) const
+        {
+            if (node >= _tree.size())
+                return;
+            Collect(collection, 2 * node);
+            collection.push_back(_tree[node]);
+            Collect(collection, 2 * node + 1);
+        }
+
+        // The path goes right on every element less than key, the answer is the last node,
+        // where it went left: trailing ones of the final position are those right turns.
+        std::size_t LowerBoundNode(const T& key) const noexcept
+        {
+            const std::size_t count = size();
+            std::size_t node = 1;
+
+            while (node <= count)
+            {
+                Algorithm::Prefetch(_tree.data() + std::min(node * NODES_PER_LINE, count));
+                node = 2 * node + (_tree[node] < key ? 1 : 0);
+            }
+
+            return node >> (std::countr_one(node) + 1);
+        }
+    };
+}
+
+#endif
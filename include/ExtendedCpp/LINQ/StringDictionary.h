@@ -0,0 +1,406 @@
+#ifndef LINQ_StringDictionary_H
+#define LINQ_StringDictionary_H
+
+#include <vector>
+#include <string>
+#include <map>
+#include <string_view>
+#include <span>
+#include <memory>
+#include <optional>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <concepts>
+#include <functional>
+#include <utility>
+
+#include <ExtendedCpp/LINQ/Concepts.h>
+#include <ExtendedCpp/LINQ/OrderType.h>
+#include <ExtendedCpp/LINQ/CowVector.h>
+#include <ExtendedCpp/LINQ/FlatHashMap.h>
+#include <ExtendedCpp/LINQ/LinqContainer.h>
+
+/// @brief
+namespace ExtendedCpp::LINQ
+{
+    /// @brief Sorted set of different strings, every string is encoded by its position.
+    /// Codes preserve the order of strings, so codes are compared instead of strings
+    class StringDictionary final
+    {
+    public:
+        /// @brief
+        using code_type = std::uint32_t;
+
+        /// @brief
+        /// @param strings Different strings in ascending order
+        /// @throws std::invalid_argument if the strings are not strictly ascending
+        explicit StringDictionary(std::vector<std::string>&& strings)
+        {
+            if (strings.size() > static_cast<std::size_t>(std::numeric_limits<code_type>::max()))
+                throw std::length_error("Too many different strings for the dictionary");
+            if (std::adjacent_find(strings.cbegin(), strings.cend(), std::greater_equal<>()) != strings.cend())
+                throw std::invalid_argument("Dictionary strings must be different and in ascending order");
+            _strings = std::move(strings);
+        }
+
+        /// @brief
+        /// @return Number of different strings
+        [[nodiscard]]
+        std::size_t size() const noexcept
+        {
+            return _strings.size();
+        }
+
+        /// @brief
+        /// @return Strings in the order of their codes
+        [[nodiscard]]
+        std::span<const std::string> Strings() const noexcept
+        {
+            return _strings;
+        }
+
+        /// @brief Finds the code by binary search
+        /// @param string
+        /// @return Code of the string, or nothing if the string is not in the dictionary
+        [[nodiscard]]
+        std::optional<code_type> Encode(const std::string_view string) const noexcept
+        {
+            const auto position = std::lower_bound(_strings.cbegin(), _strings.cend(), string,
+                [](const std::string& element, const std::string_view value) { return element < value; });
+            if (position == _strings.cend() || *position != string)
+                return std::nullopt;
+            return static_cast<code_type>(position - _strings.cbegin());
+        }
+
+        /// @brief
+        /// @param code Must be less than size
+        /// @return
+        [[nodiscard]]
+        const std::string& Decode(const code_type code) const noexcept
+        {
+            return _strings[code];
+        }
+
+    private:
+        std::vector<std::string> _strings;
+    };
+
+    /// @brief Strings stored as dense codes of a shared sorted dictionary. Equality, grouping and sorting
+    /// work on the codes, strings are decoded only at output
+    class EncodedStringContainer final
+    {
+    public:
+        /// @brief
+        using code_type = StringDictionary::code_type;
+
+        /// @brief
+        using value_type = std::string;
+
+    private:
+        std::shared_ptr<const StringDictionary> _dictionary;
+        CowVector<code_type> _codes;
+
+        EncodedStringContainer(std::shared_ptr<const StringDictionary> dictionary, CowVector<code_type>&& codes) noexcept :
+            _dictionary(std::move(dictionary)),
+            _codes(std::move(codes)) {}
+
+        bool IsDense() const noexcept
+        {
+            return _dictionary->size() <= _codes.size();
+        }
+
+        FlatHashMap<code_type, std::size_t> Occurrences() const
+        {
+            FlatHashMap<code_type, std::size_t> occurrences;
+            for (const code_type code : _codes)
+                ++occurrences[code];
+            return occurrences;
+        }
+
+        std::vector<std::pair<code_type, std::size_t>> SortedOccurrences() const
+        {
+            if (!IsDense())
+            {
+                std::vector<std::pair<code_type, std::size_t>> occurrences = Occurrences().ToVector();
+                std::sort(occurrences.begin(), occurrences.end());
+                return occurrences;
+            }
+
+            std::vector<std::size_t> counts(_dictionary->size(), 0);
+            for (const code_type code : _codes)
+                ++counts[code];
+
+            std::vector<std::pair<code_type, std::size_t>> occurrences;
+            for (std::size_t code = 0; code < counts.size(); ++code)
+                if (counts[code] != 0)
+                    occurrences.emplace_back(static_cast<code_type>(code), counts[code]);
+            return occurrences;
+        }
+
+    public:
+        /// @brief
+        EncodedStringContainer() :
+            _dictionary(std::make_shared<const StringDictionary>(std::vector<std::string>())) {}
+
+        /// @brief Builds the dictionary of the strings, every string is hashed once
+        /// and only different strings are compared by sorting
+        /// @tparam TCollection
+        /// @param strings
+        template<Concepts::ConstIterable TCollection>
+        requires std::convertible_to<const typename TCollection::value_type&, std::string_view>
+        explicit EncodedStringContainer(const TCollection& strings)
+        {
+            FlatHashMap<std::string_view, code_type> firstCodes;
+            std::vector<code_type> codes;
+            if constexpr (Concepts::HasSize<TCollection>)
+                codes.reserve(strings.size());
+
+            for (const auto& element : strings)
+            {
+                const std::string_view string = element;
+                if (const code_type* firstCode = firstCodes.Find(string))
+                {
+                    codes.push_back(*firstCode);
+                }
+                else
+                {
+                    const auto code = static_cast<code_type>(firstCodes.size());
+                    firstCodes[string] = code;
+                    codes.push_back(code);
+                }
+            }
+
+            std::vector<std::pair<std::string_view, code_type>> entries = std::move(firstCodes).ToVector();
+            std::sort(entries.begin(), entries.end());
+
+            std::vector<code_type> ranks(entries.size());
+            std::vector<std::string> sorted;
+            sorted.reserve(entries.size());
+            for (std::size_t rank = 0; rank < entries.size(); ++rank)
+            {
+                ranks[entries[rank].second] = static_cast<code_type>(rank);
+                sorted.emplace_back(entries[rank].first);
+            }
+
+            for (code_type& code : codes)
+                code = ranks[code];
+
+            _dictionary = std::make_shared<const StringDictionary>(std::move(sorted));
+            _codes = CowVector<code_type>(std::move(codes));
+        }
+
+        /// @brief
+        /// @return
+        [[nodiscard]]
+        std::size_t size() const noexcept
+        {
+            return _codes.size();
+        }
+
+        /// @brief
+        /// @return
+        [[nodiscard]]
+        bool empty() const noexcept
+        {
+            return _codes.empty();
+        }
+
+        /// @brief
+        /// @return Dictionary shared with the containers derived from this one
+        [[nodiscard]]
+        const StringDictionary& Dictionary() const noexcept
+        {
+            return *_dictionary;
+        }
+
+        /// @brief
+        /// @return Codes of the strings in the order of the collection
+        [[nodiscard]]
+        std::span<const code_type> Codes() const noexcept
+        {
+            return std::span<const code_type>(_codes.data(), _codes.size());
+        }
+
+        /// @brief
+        /// @param index
+        /// @return
+        const std::string& operator[](const std::size_t index) const noexcept
+        {
+            return _dictionary->Decode(_codes[index]);
+        }
+
+        /// @brief Filters the strings, the predicate is invoked once for every different string of the collection.
+        /// Strings of the dictionary absent from the collection are never tested
+        /// @tparam TPredicate
+        /// @param predicate
+        /// @return
+        template<typename TPredicate>
+        requires Concepts::IsPredicate<TPredicate, std::string>
+        EncodedStringContainer Where(TPredicate&& predicate) const
+        {
+            std::vector<code_type> codes;
+            codes.reserve(_codes.size());
+
+            if (IsDense())
+            {
+                // 0 - not tested, 1 - rejected, 2 - accepted
+                std::vector<std::uint8_t> matches(_dictionary->size(), 0);
+                for (const code_type code : _codes)
+                {
+                    if (matches[code] == 0)
+                        matches[code] = predicate(_dictionary->Decode(code)) ? 2 : 1;
+                    if (matches[code] == 2)
+                        codes.push_back(code);
+                }
+            }
+            else
+            {
+                FlatHashMap<code_type, bool> matches;
+                for (const code_type code : _codes)
+                {
+                    const bool* match = matches.Find(code);
+                    if (match ? *match : (matches[code] = static_cast<bool>(predicate(_dictionary->Decode(code)))))
+                        codes.push_back(code);
+                }
+            }
+
+            return EncodedStringContainer(_dictionary, CowVector<code_type>(std::move(codes)));
+        }
+
+        /// @brief Number of strings equal to the string, the string is encoded once
+        /// @param string
+        /// @return
+        [[nodiscard]]
+        std::size_t Count(const std::string_view string) const noexcept
+        {
+            const std::optional<code_type> code = _dictionary->Encode(string);
+            if (!code)
+                return 0;
+            return static_cast<std::size_t>(std::count(_codes.cbegin(), _codes.cend(), *code));
+        }
+
+        /// @brief
+        /// @param string
+        /// @return
+        [[nodiscard]]
+        bool Contains(const std::string_view string) const noexcept
+        {
+            const std::optional<code_type> code = _dictionary->Encode(string);
+            return code && std::find(_codes.cbegin(), _codes.cend(), *code) != _codes.cend();
+        }
+
+        /// @brief Remove duplicates, the result is sorted like LinqContainer::Distinct.
+        /// Codes are counted by the dictionary only if it is not larger than the collection
+        /// @return
+        EncodedStringContainer Distinct() const
+        {
+            const std::vector<std::pair<code_type, std::size_t>> occurrences = SortedOccurrences();
+
+            std::vector<code_type> codes;
+            codes.reserve(occurrences.size());
+            for (const auto& [code, count] : occurrences)
+                codes.push_back(code);
+
+            return EncodedStringContainer(_dictionary, CowVector<code_type>(std::move(codes)));
+        }
+
+        /// @brief Sorts the strings by counting their codes, strings are never compared.
+        /// Codes are counted by the dictionary only if it is not larger than the collection
+        /// @param orderType
+        /// @return
+        EncodedStringContainer Order(const OrderType orderType = OrderType::ASC) const
+        {
+            const std::vector<std::pair<code_type, std::size_t>> occurrences = SortedOccurrences();
+
+            std::vector<code_type> codes;
+            codes.reserve(_codes.size());
+            if (orderType == OrderType::ASC)
+                for (auto it = occurrences.cbegin(); it != occurrences.cend(); ++it)
+                    codes.insert(codes.end(), it->second, it->first);
+            else
+                for (auto it = occurrences.crbegin(); it != occurrences.crend(); ++it)
+                    codes.insert(codes.end(), it->second, it->first);
+
+            return EncodedStringContainer(_dictionary, CowVector<code_type>(std::move(codes)));
+        }
+
+        /// @brief Group the strings, the key selector is invoked once for every different string of the collection
+        /// @tparam TKeySelector
+        /// @tparam TKey
+        /// @param keySelector
+        /// @return
+        template<std::invocable<std::string> TKeySelector,
+                 typename TKey = std::invoke_result_t<TKeySelector, std::string>>
+        std::map<TKey, std::vector<std::string>> GroupBy(TKeySelector&& keySelector) const
+        {
+            std::map<TKey, std::vector<std::string>> result;
+            FlatHashMap<code_type, std::vector<std::string>*> groups;
+
+            for (const code_type code : _codes)
+            {
+                std::vector<std::string>* const* group = groups.Find(code);
+                if (!group)
+                    group = &(groups[code] = &result[keySelector(_dictionary->Decode(code))]);
+                (*group)->push_back(_dictionary->Decode(code));
+            }
+
+            return result;
+        }
+
+        /// @brief Count equal strings
+        /// @return Strings with the numbers of their occurrences in the order of first occurrence
+        LinqContainer<std::pair<std::string, std::size_t>> CountBy() const
+        {
+            std::vector<std::pair<std::string, std::size_t>> result;
+            for (const auto& [code, count] : Occurrences().ToVector())
+                result.emplace_back(_dictionary->Decode(code), count);
+
+            return LinqContainer<std::pair<std::string, std::size_t>>(std::move(result));
+        }
+
+        /// @brief
+        /// @return
+        [[nodiscard]]
+        const std::string& Min() const
+        {
+            if (_codes.empty())
+                throw std::out_of_range("Collection is empty");
+            return _dictionary->Decode(*std::min_element(_codes.cbegin(), _codes.cend()));
+        }
+
+        /// @brief
+        /// @return
+        [[nodiscard]]
+        const std::string& Max() const
+        {
+            if (_codes.empty())
+                throw std::out_of_range("Collection is empty");
+            return _dictionary->Decode(*std::max_element(_codes.cbegin(), _codes.cend()));
+        }
+
+        /// @brief Decodes the strings
+        /// @return
+        [[nodiscard]]
+        std::vector<std::string> ToVector() const
+        {
+            std::vector<std::string> result;
+            result.reserve(_codes.size());
+            for (const code_type code : _codes)
+                result.push_back(_dictionary->Decode(code));
+            return result;
+        }
+
+        /// @brief Decodes the strings
+        /// @return
+        [[nodiscard]]
+        LinqContainer<std::string> ToLinq() const
+        {
+            return LinqContainer<std::string>(ToVector());
+        }
+    };
+}
+
+#endif
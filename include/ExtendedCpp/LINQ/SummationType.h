@@ -0,0 +1,23 @@
+#ifndef LINQ_SummationType_H
+#define LINQ_SummationType_H
+
+/// @brief 
+namespace ExtendedCpp::LINQ
+{
+    /// @brief Order of floating point additions used by Sum and Average
+    enum class SummationType
+    {
+        /// @brief Independent accumulators in SIMD lanes, the default of Sum and Average
+        LANES,
+        /// @brief Left to right in a single accumulator
+        NAIVE,
+        /// @brief Recursive halving down to blocks of PAIRWISE_BLOCK elements, error grows as O(log n)
+        PAIRWISE,
+        /// @brief Kahan-Neumaier compensated summation, error does not depend on n
+        KAHAN_NEUMAIER,
+        /// @brief The pairwise tree evaluated by several threads, bitwise equal to PAIRWISE for any thread count
+        PARALLEL_PAIRWISE
+    };
+}
+
+#endif
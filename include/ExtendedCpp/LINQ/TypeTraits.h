@@ -2,6 +2,8 @@
 #define LINQ_TypeTraits_H
 
 #include <utility>
+#include <vector>
+#include <memory_resource>
 
 #include <ExtendedCpp/LINQ/Concepts.h>
 
@@ -41,6 +43,46 @@ namespace ExtendedCpp::LINQ
     /// @tparam TCollection 
     template <Concepts::RandomAccess TCollection>
     using RandomAccessValueType = typename RandomAccessValue<TCollection>::Type;
+
+    /// @brief Group type passed to a GroupJoin result selector: groups are kept in the memory resource
+    /// of the container, selectors taking a std::vector receive a copy of the group
+    /// @tparam TSelector
+    /// @tparam TSource
+    /// @tparam TElement
+    template<typename TSelector, typename TSource, typename TElement>
+    requires Concepts::GroupSelector<TSelector, TSource, TElement>
+    struct GroupSelectorTraits
+    {
+        using GroupType = std::vector<TSource>;
+        using ResultType = std::invoke_result_t<TSelector, const GroupType&, TElement>;
+    };
+
+    /// @brief
+    /// @tparam TSelector
+    /// @tparam TSource
+    /// @tparam TElement
+    template<typename TSelector, typename TSource, typename TElement>
+    requires std::invocable<TSelector, const std::pmr::vector<TSource>&, TElement>
+    struct GroupSelectorTraits<TSelector, TSource, TElement>
+    {
+        using GroupType = std::pmr::vector<TSource>;
+        using ResultType = std::invoke_result_t<TSelector, const GroupType&, TElement>;
+    };
+
+    /// @brief
+    /// @tparam TMemberPointer
+    template<typename TMemberPointer>
+    struct MemberPointerTraits;
+
+    /// @brief
+    /// @tparam TObject
+    /// @tparam TField
+    template<typename TObject, typename TField>
+    struct MemberPointerTraits<TField TObject::*>
+    {
+        using ObjectType = TObject;
+        using FieldType = TField;
+    };
 }
 
 #endif
\ No newline at end of file
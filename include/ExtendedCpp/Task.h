@@ -43,8 +43,11 @@ namespace ExtendedCpp
 			/// @param result 
 			void return_value(TResult&& result) noexcept 
 			{ 
-				_result = std::move(result); 
-				_isDone.store(true);
+				{
+					std::lock_guard lock(_mutex);
+					_result = std::move(result);
+					_isDone.store(true);
+				}
 
 				if (_continuation)
 					_continuation.resume();
@@ -63,11 +66,16 @@ namespace ExtendedCpp
 				return Task(std::coroutine_handle<Promise>::from_promise(*this)); 
 			}
 
-			/// @brief 
+			/// @brief Task may be finished by another thread between the check of IsDone and this call
 			/// @param continuation 
-			void SetContinuation(std::coroutine_handle<> continuation)
+			/// @return false if task is already done and continuation must not wait for it
+			bool SetContinuation(std::coroutine_handle<> continuation)
 			{
+				std::lock_guard lock(_mutex);
+				if (_isDone.load())
+					return false;
 				_continuation = continuation;
+				return true;
 			}
 
 			/// @brief 
@@ -88,6 +96,7 @@ namespace ExtendedCpp
 			std::coroutine_handle<> _continuation;
 			TResult _result;
 			std::atomic<bool> _isDone;
+			std::mutex _mutex;
 		};
 
 		/// @brief 
@@ -180,9 +189,9 @@ namespace ExtendedCpp
 
 			/// @brief 
 			/// @param continuation 
-			void await_suspend(std::coroutine_handle<> continuation)
+			bool await_suspend(std::coroutine_handle<> continuation)
 			{
-				_handle.promise().SetContinuation(continuation);
+				return _handle.promise().SetContinuation(continuation);
 			}
 
 			/// @brief 
@@ -269,7 +278,10 @@ namespace ExtendedCpp
 
 			void return_void() noexcept 
 			{
-				_isDone.store(true);
+				{
+					std::lock_guard lock(_mutex);
+					_isDone.store(true);
+				}
 
 				if (_continuation)
 					_continuation.resume();
@@ -288,11 +300,16 @@ namespace ExtendedCpp
 				return Task(std::coroutine_handle<Promise>::from_promise(*this));
 			}
 
-			/// @brief 
+			/// @brief Task may be finished by another thread between the check of IsDone and this call
 			/// @param continuation 
-			void SetContinuation(std::coroutine_handle<> continuation)
+			/// @return false if task is already done and continuation must not wait for it
+			bool SetContinuation(std::coroutine_handle<> continuation)
 			{
+				std::lock_guard lock(_mutex);
+				if (_isDone.load())
+					return false;
 				_continuation = continuation;
+				return true;
 			}
 
 			/// @brief 
@@ -305,6 +322,7 @@ namespace ExtendedCpp
 		private:
 			std::coroutine_handle<> _continuation;
 			std::atomic<bool> _isDone;
+			std::mutex _mutex;
 		};
 
 		/// @brief 
@@ -393,9 +411,9 @@ namespace ExtendedCpp
 
 			/// @brief 
 			/// @param continuation 
-			void await_suspend(std::coroutine_handle<> continuation)
+			bool await_suspend(std::coroutine_handle<> continuation)
 			{
-				_handle.promise().SetContinuation(continuation);
+				return _handle.promise().SetContinuation(continuation);
 			}
 
 			/// @brief 
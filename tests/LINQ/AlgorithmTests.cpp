@@ -1,8 +1,11 @@
 #include <gtest/gtest.h>
 #include <vector>
 #include <map>
+#include <string>
 
 #include <ExtendedCpp/LINQ/Algorithm.h>
+#include <ExtendedCpp/LINQ/SortedIndex.h>
+#include <ExtendedCpp/LINQ/BloomFilter.h>
 
 TEST(AlgorithmTests, BinarySearchTest)
 {
@@ -36,6 +39,83 @@ TEST(AlgorithmTests, BinarySearchTest)
         delete element;
 }
 
+TEST(AlgorithmTests, LowerBoundTest)
+{
+    // Average
+    const int arr[10] = { 1, 3, 3, 3, 9, 14, 56, 102, 304, 400 };
+    const std::vector keys { 0, 3, 4, 400, 401, 56, 2, 1 };
+    const std::vector<std::size_t> assertResults { 0, 1, 4, 9, 10, 6, 1, 0 };
+    std::vector<std::size_t> results(keys.size());
+
+    // Act
+    ExtendedCpp::LINQ::Algorithm::BatchLowerBound(keys, keys.size(), arr, 0, 9, results.data());
+
+    // Assert
+    ASSERT_EQ(results, assertResults);
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        ASSERT_EQ(ExtendedCpp::LINQ::Algorithm::LowerBound(keys[i], arr, 0, 9), assertResults[i]);
+        ASSERT_EQ(ExtendedCpp::LINQ::Algorithm::LowerBound(keys[i] * 2, arr, 0, 9,
+            [](const int number){ return number * 2; }), assertResults[i]);
+    }
+    ASSERT_EQ(ExtendedCpp::LINQ::Algorithm::LowerBound(3, arr, 4, 9), 4);
+    ASSERT_EQ(ExtendedCpp::LINQ::Algorithm::BinarySearch(3, arr, 0, 9), 1);
+}
+
+TEST(AlgorithmTests, SortedIndexTest)
+{
+    // Average
+    std::vector<int> numbers;
+    for (int i = 0; i < 1000; ++i)
+        numbers.push_back((i * 7919) % 1000 * 2);
+
+    // Act
+    const ExtendedCpp::LINQ::SortedIndex index(numbers);
+    const ExtendedCpp::LINQ::SortedIndex<int> empty;
+    const std::vector<int> sorted = index.ToVector();
+
+    // Assert
+    ASSERT_EQ(index.size(), 1000);
+    ASSERT_TRUE(std::is_sorted(sorted.begin(), sorted.end()));
+    ASSERT_EQ(*index.LowerBound(-5), 0);
+    ASSERT_EQ(*index.LowerBound(101), 102);
+    ASSERT_EQ(*index.LowerBound(1998), 1998);
+    ASSERT_EQ(index.LowerBound(1999), nullptr);
+    ASSERT_TRUE(index.Contains(500));
+    ASSERT_FALSE(index.Contains(501));
+    ASSERT_TRUE(empty.empty());
+    ASSERT_EQ(empty.LowerBound(0), nullptr);
+}
+
+TEST(AlgorithmTests, BloomFilterTest)
+{
+    // Average
+    std::vector<long long> keys;
+    for (long long i = 0; i < 100000; ++i)
+        keys.push_back(i * 2);
+
+    // Act
+    ExtendedCpp::LINQ::BloomFilter<long long> filter(keys.size());
+    for (const long long key : keys)
+        filter.Insert(key);
+    ExtendedCpp::LINQ::KeySet<long long> keySet(keys, [](const long long key) { return key; });
+    ExtendedCpp::LINQ::KeySet<long long> smallKeySet(std::vector<long long> { 1, 5 }, [](const long long key) { return key; });
+
+    std::size_t falsePositives = 0;
+    for (const long long key : keys)
+        falsePositives += filter.MayContain(key + 1) ? 1 : 0;
+
+    // Assert
+    ASSERT_TRUE(std::ranges::all_of(keys, [&filter](const long long key) { return filter.MayContain(key); }));
+    ASSERT_LT(falsePositives, keys.size() / 50);
+    ASSERT_TRUE(keySet.HasFilter());
+    ASSERT_TRUE(keySet.Contains(1000));
+    ASSERT_FALSE(keySet.Contains(1001));
+    ASSERT_FALSE(smallKeySet.HasFilter());
+    ASSERT_TRUE(smallKeySet.Contains(5));
+    ASSERT_FALSE(smallKeySet.Contains(2));
+}
+
 TEST(AlgorithmTests, CountEqualKeysTest)
 {
     // Average
@@ -45,7 +125,7 @@ TEST(AlgorithmTests, CountEqualKeysTest)
     std::map<short, std::size_t> dict = ExtendedCpp::LINQ::Algorithm::CountEqualKeys(arr, 0, 9);
 
     // Assert
-    if (dict[6] == 3 && dict[7] == 1 && dict[2] == 2)
+    if (dict[6] == 4 && dict[7] == 1 && dict[2] == 2 && dict[40] == 1)
     {
         ASSERT_TRUE(true);
         return;
@@ -54,6 +134,33 @@ TEST(AlgorithmTests, CountEqualKeysTest)
     ASSERT_TRUE(false);
 }
 
+TEST(AlgorithmTests, HistogramTest)
+{
+    // Average
+    const short dense[10] = { 7, 6, 6, 10, 2, 2, 5, 6, 40, 6 };
+    const std::vector<std::string> words { "b", "a", "b", "c", "a", "b" };
+    std::vector<int> sparse;
+    for (int i = 0; i < 100000; ++i)
+        sparse.push_back(i % 1000 * 1000003);
+
+    // Act
+    const auto denseHistogram = ExtendedCpp::LINQ::Algorithm::Histogram(dense, 1, 9);
+    const auto wordsHistogram = ExtendedCpp::LINQ::Algorithm::Histogram(words, 0, 5,
+        [](const std::string& word){ return word.front(); });
+    const auto sparseHistogram = ExtendedCpp::LINQ::Algorithm::ParallelHistogram(sparse, 0, sparse.size() - 1, 4);
+
+    // Assert
+    const std::vector<std::pair<short, std::size_t>> assertDense { { 6, 4 }, { 10, 1 }, { 2, 2 }, { 5, 1 }, { 40, 1 } };
+    ASSERT_TRUE(std::equal(denseHistogram.begin(), denseHistogram.end(), assertDense.begin(), assertDense.end()));
+    ASSERT_EQ(wordsHistogram.size(), 3);
+    ASSERT_EQ(*wordsHistogram.Find('b'), 3);
+    ASSERT_EQ(wordsHistogram.Find('d'), nullptr);
+    ASSERT_EQ(sparseHistogram.size(), 1000);
+    ASSERT_EQ(sparseHistogram.begin()->first, 0);
+    for (const auto& [key, count] : sparseHistogram)
+        ASSERT_EQ(count, 100);
+}
+
 TEST(AlgorithmTests, CountCommonSubsequenceTest)
 {
     // Average
@@ -73,6 +180,71 @@ TEST(AlgorithmTests, CountCommonSubsequenceTest)
     ASSERT_TRUE(false);
 }
 
+TEST(AlgorithmTests, CountCommonSubsequenceLargeTest)
+{
+    // Average
+    std::string first;
+    std::string second;
+    for (std::size_t i = 0; i < 100000; ++i)
+    {
+        first.push_back(static_cast<char>('a' + i * 7919 % 4));
+        if (i % 10 != 0)
+            second.push_back(first.back());
+    }
+    std::vector<int> firstNumbers(first.begin(), first.begin() + 2000);
+    std::vector<int> secondNumbers(second.begin(), second.begin() + 1800);
+    firstNumbers.push_back(1000);
+
+    // Act
+    const std::size_t count = ExtendedCpp::LINQ::Algorithm::CountCommonSubsequence(first, first.size(),
+                                                                                    second, second.size());
+    const std::size_t numbersCount = ExtendedCpp::LINQ::Algorithm::CountCommonSubsequence(
+        firstNumbers, firstNumbers.size(), secondNumbers, secondNumbers.size());
+
+    // Assert
+    ASSERT_EQ(count, 90000);
+    ASSERT_EQ(numbersCount, 1800);
+    ASSERT_EQ(ExtendedCpp::LINQ::Algorithm::CountCommonSubsequenceByRows(
+        firstNumbers, firstNumbers.size(), secondNumbers, secondNumbers.size()), 1800);
+}
+
+TEST(AlgorithmTests, EditScriptTest)
+{
+    using ExtendedCpp::LINQ::Algorithm::EditOperationType;
+    using ExtendedCpp::LINQ::NPOS;
+
+    // Average
+    const std::string first = "kitten sitting";
+    const std::string second = "sitting kitten";
+
+    // Act
+    const std::vector<ExtendedCpp::LINQ::Algorithm::EditOperation> script =
+        ExtendedCpp::LINQ::Algorithm::EditScript(first, first.size(), second, second.size());
+
+    // Assert
+    std::string result;
+    std::size_t kept = 0;
+    for (const auto& operation : script)
+    {
+        if (operation.type == EditOperationType::Keep)
+        {
+            ASSERT_EQ(first[operation.firstIndex], second[operation.secondIndex]);
+            ++kept;
+        }
+        if (operation.type == EditOperationType::Remove)
+        {
+            ASSERT_EQ(operation.secondIndex, NPOS);
+        }
+        else
+        {
+            result.push_back(second[operation.secondIndex]);
+        }
+    }
+    ASSERT_EQ(result, second);
+    ASSERT_EQ(kept, ExtendedCpp::LINQ::Algorithm::CountCommonSubsequence(first, first.size(), second, second.size()));
+    ASSERT_EQ(script.size(), first.size() + second.size() - kept);
+}
+
 TEST(AlgorithmTests, ContainsTest)
 {
     // Average
@@ -103,4 +275,37 @@ TEST(AlgorithmTests, IndexAtTest)
     // Assert
     ASSERT_EQ(ExtendedCpp::LINQ::Algorithm::IndexAt(collection, 10, subCollection1, 4), 3);
     ASSERT_EQ(ExtendedCpp::LINQ::Algorithm::IndexAt(collection, 10, subCollection2, 4), ExtendedCpp::LINQ::NPOS);
-}
\ No newline at end of file
+}
+
+TEST(AlgorithmTests, FindTest)
+{
+    // Average
+    std::vector<int> numbers(1000, 7);
+    numbers[900] = 3;
+    const std::string text = "extended c++ library";
+
+    // Act
+    // Assert
+    ASSERT_EQ(ExtendedCpp::LINQ::Algorithm::Find(numbers.data(), numbers.size(), 3), 900);
+    ASSERT_EQ(ExtendedCpp::LINQ::Algorithm::Find(numbers.data(), numbers.size(), 4), ExtendedCpp::LINQ::NPOS);
+    ASSERT_EQ(ExtendedCpp::LINQ::Algorithm::Find(text.data(), text.size(), '+'), 10);
+}
+
+TEST(AlgorithmTests, SubstringSearchTest)
+{
+    // Average
+    std::string text(10000, 'a');
+    text.replace(9000, 4, "aaba");
+    const std::string periodic = "aaba";
+    const std::string missing = "aabaa";
+    const std::vector<std::string> words = { "x", "ab", "ab", "ab", "c", "ab", "ab", "c" };
+    const std::vector<std::string> phrase = { "ab", "ab", "c" };
+
+    // Act
+    // Assert
+    ASSERT_EQ(ExtendedCpp::LINQ::Algorithm::IndexAt(text.data(), text.size(), periodic.data(), periodic.size()), 9000);
+    ASSERT_EQ(ExtendedCpp::LINQ::Algorithm::IndexAt(text.data(), text.size(), missing.data(), missing.size()), 9000);
+    ASSERT_EQ(ExtendedCpp::LINQ::Algorithm::TwoWaySearch(text, text.size(), periodic, periodic.size()), 9000);
+    ASSERT_EQ(ExtendedCpp::LINQ::Algorithm::IndexAt(words, words.size(), phrase, phrase.size()), 2);
+    ASSERT_EQ(ExtendedCpp::LINQ::Algorithm::IndexAt(text.data(), text.size(), missing.data(), 0), 0);
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ExtendedCpp/LINQ.h>
+
+#include "LINQ_Tests.h"
+
+namespace
+{
+    ExtendedCpp::Task<std::optional<int>> ReadNumber(int& next, const int count)
+    {
+        if (next == count)
+            co_return std::nullopt;
+        co_return std::optional<int>(next++);
+    }
+}
+
+TEST(LINQ_AsyncGenerator_Tests, WhereSelectTakeTest)
+{
+    // Average
+    int next = 0;
+    const std::vector<std::string> assertVector = { "0", "4", "8", "12" };
+
+    // Act
+    auto task = ExtendedCpp::LINQ::AsyncGenerator([&next]{ return ReadNumber(next, 100); })
+        .Where([](const int number){ return number % 2 == 0; })
+        .Select([](const int number){ return std::to_string(number * 2); })
+        .Take(4)
+        .ToVector();
+    const std::vector<std::string> result = task.Result();
+
+    // Assert
+    ASSERT_EQ(result, assertVector);
+    ASSERT_EQ(next, 8);
+}
+
+TEST(LINQ_AsyncGenerator_Tests, BatchTest)
+{
+    // Average
+    int next = 0;
+
+    // Act
+    auto task = ExtendedCpp::LINQ::AsyncGenerator([&next]{ return ReadNumber(next, 10); })
+        .Batch(4)
+        .ToVector();
+    const std::vector<std::vector<int>> batches = task.Result();
+
+    // Assert
+    ASSERT_EQ(batches.size(), 3);
+    ASSERT_EQ(batches[0], std::vector<int>({ 0, 1, 2, 3 }));
+    ASSERT_EQ(batches[1], std::vector<int>({ 4, 5, 6, 7 }));
+    ASSERT_EQ(batches[2], std::vector<int>({ 8, 9 }));
+}
+
+TEST(LINQ_AsyncGenerator_Tests, AggregateTest)
+{
+    // Average
+    int next = 0;
+    int emptyNext = 0;
+
+    // Act
+    auto sum = ExtendedCpp::LINQ::AsyncGenerator([&next]{ return ReadNumber(next, 10); })
+        .Aggregate<int>([](const int accumulator, const int number){ return accumulator + number; });
+    auto seeded = ExtendedCpp::LINQ::AsyncGenerator([&emptyNext]{ return ReadNumber(emptyNext, 0); })
+        .Aggregate(100, [](const int accumulator, const int number){ return accumulator + number; });
+
+    // Assert
+    ASSERT_EQ(sum.Result(), 45);
+    ASSERT_EQ(seeded.Result(), 100);
+    ASSERT_THROW(ExtendedCpp::LINQ::AsyncGenerator([&emptyNext]{ return ReadNumber(emptyNext, 0); })
+        .Aggregate<int>([](const int accumulator, const int number){ return accumulator + number; }),
+        std::out_of_range);
+}
+
+TEST(LINQ_AsyncGenerator_Tests, AsyncSourceTest)
+{
+    // Average
+    constexpr int count = 20;
+    std::atomic<int> started = 0;
+    auto readNumber = [&started]
+    {
+        return ExtendedCpp::Task<std::optional<int>>::Run([number = started++]() -> std::optional<int>
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            if (number == count)
+                return std::nullopt;
+            return number;
+        });
+    };
+
+    // Act
+    auto task = ExtendedCpp::LINQ::AsyncGenerator(readNumber)
+        .Select([](const int number){ return number * number; })
+        .Batch(8)
+        .Select([](const std::vector<int>& batch){ return static_cast<int>(batch.size()); })
+        .Aggregate(0, [](const int accumulator, const int size){ return accumulator + size; });
+
+    // Assert
+    ASSERT_EQ(task.Result(), count);
+    ASSERT_EQ(started.load(), count + 1);
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include <utility>
+
+#include <ExtendedCpp/LINQ.h>
+
+#include "LINQ_Tests.h"
+
+struct Sale
+{
+    std::string Region;
+    int Quantity{};
+    double Price{};
+    std::string Comment;
+};
+
+TEST(LINQ_Columnar_Tests, WhereSelectSumTest)
+{
+    // Average
+    const std::vector<Person> people { Person("Tom", 23), Person("Bob", 27), Person("Sam", 29), Person("Alice", 24) };
+    const auto columns = ExtendedCpp::LINQ::Columnar<&Person::Name, &Person::Age>(people);
+
+    // Act
+    auto adults = columns.Where<&Person::Age>([](const unsigned char age){ return age > 23; });
+    const std::vector<std::string> names = adults.Select<&Person::Name>().ToVector();
+    const std::vector<std::size_t> lengths = adults.Select<&Person::Name>([](const std::string& name)
+                                                                          { return name.size(); }).ToVector();
+    const std::vector<Person> rows = std::move(adults).Where<&Person::Name>([](const std::string& name)
+                                                                            { return name != "Bob"; }).ToVector();
+
+    // Assert
+    ASSERT_EQ(columns.size(), 4);
+    ASSERT_EQ(names, (std::vector<std::string> { "Bob", "Sam", "Alice" }));
+    ASSERT_EQ(lengths, (std::vector<std::size_t> { 3, 3, 5 }));
+    ASSERT_EQ(rows.size(), 2);
+    ASSERT_EQ(rows[0].Name, "Sam");
+    ASSERT_EQ(rows[0].Age, 29);
+    ASSERT_EQ(rows[1].Name, "Alice");
+    ASSERT_EQ(rows[1].Age, 24);
+    ASSERT_EQ(columns.Column<&Person::Age>()[0], 23);
+}
+
+TEST(LINQ_Columnar_Tests, GroupBySumAverageTest)
+{
+    // Average
+    const std::vector<Sale> sales {
+        { "North", 3, 10.0, "first" }, { "South", 5, 4.0, "" }, { "North", 7, 2.0, "" },
+        { "East", 1, 8.0, "" }, { "South", 2, 6.0, "last" } };
+    const auto columns = ExtendedCpp::LINQ::Columnar<&Sale::Region, &Sale::Quantity, &Sale::Price>(sales);
+
+    // Act
+    const int quantity = columns.Sum<&Sale::Quantity>();
+    const double price = columns.Average<&Sale::Price>();
+    const auto groups = columns.GroupBy<&Sale::Region>();
+    const auto quantities = groups.Sum<&Sale::Quantity>().ToVector();
+    const auto prices = groups.Average<&Sale::Price>().ToVector();
+    const auto counts = groups.Count().ToVector();
+    const std::vector<Sale> rows = columns.ToVector();
+
+    // Assert
+    ASSERT_EQ(quantity, 18);
+    ASSERT_DOUBLE_EQ(price, 6.0);
+    ASSERT_EQ(quantities, (std::vector<std::pair<std::string, int>> { { "North", 10 }, { "South", 7 }, { "East", 1 } }));
+    ASSERT_EQ(prices, (std::vector<std::pair<std::string, double>> { { "North", 6.0 }, { "South", 5.0 }, { "East", 8.0 } }));
+    ASSERT_EQ(counts, (std::vector<std::pair<std::string, std::size_t>> { { "North", 2 }, { "South", 2 }, { "East", 1 } }));
+    ASSERT_EQ(rows.size(), 5);
+    ASSERT_EQ(rows[4].Region, "South");
+    ASSERT_EQ(rows[4].Quantity, 2);
+    ASSERT_TRUE(rows[0].Comment.empty());
+    ASSERT_THROW(columns.Where<&Sale::Quantity>([](const int n){ return n > 10; }).Sum<&Sale::Quantity>(),
+                 std::out_of_range);
+}
+
+TEST(LINQ_Columnar_Tests, RvalueWhereTest)
+{
+    // Average
+    const std::vector<Person> people { Person("Tom", 23), Person("Bob", 27), Person("Sam", 29), Person("Alice", 24) };
+    auto owned = ExtendedCpp::LINQ::Columnar<&Person::Name, &Person::Age>(people);
+    auto shared = ExtendedCpp::LINQ::Columnar<&Person::Name, &Person::Age>(people);
+    const auto copy = shared;
+    const unsigned char* ownedAges = owned.Column<&Person::Age>().data();
+
+    // Act
+    const auto ownedAdults = std::move(owned).Where<&Person::Age>([](const unsigned char age){ return age > 23; });
+    const auto sharedAdults = std::move(shared).Where<&Person::Age>([](const unsigned char age){ return age > 23; });
+
+    // Assert
+    ASSERT_EQ(ownedAdults.size(), 3);
+    ASSERT_EQ(ownedAdults.Column<&Person::Age>().data(), ownedAges);
+    ASSERT_EQ(ownedAdults.Select<&Person::Name>().ToVector(), (std::vector<std::string> { "Bob", "Sam", "Alice" }));
+    ASSERT_EQ(sharedAdults.size(), 3);
+    ASSERT_EQ(sharedAdults.Select<&Person::Name>().ToVector(), (std::vector<std::string> { "Bob", "Sam", "Alice" }));
+    ASSERT_EQ(sharedAdults.Select<&Person::Age>().ToVector(), (std::vector<unsigned char> { 27, 29, 24 }));
+    ASSERT_EQ(copy.size(), 4);
+    ASSERT_EQ(copy.Select<&Person::Name>().ToVector(), (std::vector<std::string> { "Tom", "Bob", "Sam", "Alice" }));
+    ASSERT_EQ(copy.Select<&Person::Age>().ToVector(), (std::vector<unsigned char> { 23, 27, 29, 24 }));
+}
+
+struct Flagged
+{
+    int Id{};
+    bool Flag{};
+};
+
+TEST(LINQ_Columnar_Tests, BoolColumnTest)
+{
+    // Average
+    const std::vector<Flagged> records { { 1, true }, { 2, false }, { 3, true }, { 4, true } };
+
+    // Act
+    const auto columns = ExtendedCpp::LINQ::Columnar<&Flagged::Id, &Flagged::Flag>(records);
+    const auto flagged = columns.Where<&Flagged::Flag>([](const bool flag){ return flag; });
+    const std::vector<bool> flags = columns.Select<&Flagged::Flag>().ToVector();
+    const auto counts = columns.GroupBy<&Flagged::Flag>().Count().ToVector();
+    const std::vector<Flagged> rows = flagged.ToVector();
+
+    // Assert
+    ASSERT_EQ(flagged.Sum<&Flagged::Id>(), 8);
+    ASSERT_EQ(flags, (std::vector<bool> { true, false, true, true }));
+    ASSERT_EQ(counts, (std::vector<std::pair<bool, std::size_t>> { { true, 3 }, { false, 1 } }));
+    ASSERT_EQ(rows.size(), 3);
+    ASSERT_TRUE(rows[2].Flag);
+    ASSERT_EQ(rows[2].Id, 4);
+}
@@ -1,4 +1,8 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <utility>
 
 #include <ExtendedCpp/LINQ.h>
 
@@ -230,6 +234,29 @@ TEST(LINQ_Generator_Tests, OrderByTest)
     ASSERT_EQ(0, sortedNumbers[6]);
 }
 
+TEST(LINQ_Generator_Tests, OrderStringsDescTest)
+{
+    // Average
+    std::vector<std::string> names(1000);
+    for (std::size_t i = 0; i < names.size(); ++i)
+        names[i] = std::to_string((i * 7919) % 1000);
+    std::vector<std::string> expectedNames = names;
+    std::ranges::sort(expectedNames, std::greater<>());
+
+    // Act
+    const std::vector sortedNames = ExtendedCpp::LINQ::Generator(std::as_const(names))
+            .Order(ExtendedCpp::LINQ::OrderType::DESC)
+            .ToVector();
+    const std::vector takenNames = ExtendedCpp::LINQ::Generator(std::as_const(names))
+            .Order(ExtendedCpp::LINQ::OrderType::DESC)
+            .Take(100)
+            .ToVector();
+
+    // Assert
+    ASSERT_EQ(expectedNames, sortedNames);
+    ASSERT_TRUE(std::equal(takenNames.cbegin(), takenNames.cend(), expectedNames.cbegin()));
+}
+
 TEST(LINQ_Generator_Tests, OrderByWithSelectorTest)
 {
     // Average
@@ -264,6 +291,34 @@ TEST(LINQ_Generator_Tests, OrderByWithSelectorTest)
     ASSERT_EQ(29, sortedAges[3]);
 }
 
+TEST(LINQ_Generator_Tests, TopKTest)
+{
+    // Average
+    std::vector<int> numbers(10000);
+    for (std::size_t i = 0; i < numbers.size(); ++i)
+        numbers[i] = static_cast<int>((i * 7919) % 1009);
+    std::vector<int> expectedNumbers = numbers;
+    std::ranges::sort(expectedNumbers);
+    expectedNumbers.resize(50);
+
+    // Act
+    const std::vector orderTakeNumbers = ExtendedCpp::LINQ::Generator(numbers)
+            .Order()
+            .Take(50)
+            .ToVector();
+    const std::vector topNumbers = ExtendedCpp::LINQ::Generator(numbers)
+            .TopK(50)
+            .ToVector();
+    const std::vector topByNumbers = ExtendedCpp::LINQ::Generator(numbers)
+            .TopK(50, [](const int number){ return -number; }, ExtendedCpp::LINQ::OrderType::DESC)
+            .ToVector();
+
+    // Assert
+    ASSERT_EQ(expectedNumbers, orderTakeNumbers);
+    ASSERT_EQ(expectedNumbers, topNumbers);
+    ASSERT_EQ(expectedNumbers, topByNumbers);
+}
+
 TEST(LINQ_Generator_Tests, ExceptTest1)
 {
     // Average
@@ -519,6 +574,32 @@ TEST(LINQ_Generator_Tests, MaxWithSelectorTest)
     ASSERT_EQ(29, result);
 }
 
+TEST(LINQ_Generator_Tests, MinMaxTest)
+{
+    // Average
+    const std::vector numbers { 4, -2, 9, 0, 17, 3, -8, 5, 11, 2 };
+
+    // Act
+    const auto [min, max] = ExtendedCpp::LINQ::Generator(numbers).MinMax();
+
+    // Assert
+    ASSERT_EQ(-8, min);
+    ASSERT_EQ(17, max);
+}
+
+TEST(LINQ_Generator_Tests, SumSummationTypeTest)
+{
+    // Average
+    const std::vector cancelling { 1.0, 1e100, 1.0, -1e100 };
+
+    // Act
+    const double result = ExtendedCpp::LINQ::Generator(cancelling)
+            .Sum(ExtendedCpp::LINQ::SummationType::KAHAN_NEUMAIER);
+
+    // Assert
+    ASSERT_EQ(2.0, result);
+}
+
 TEST(LINQ_Generator_Tests, AverageTest)
 {
     // Average
@@ -1097,6 +1178,46 @@ TEST(LINQ_Generator_Tests, ForeachTest)
         ASSERT_EQ(element, 8);
 }
 
+TEST(LINQ_Generator_Tests, ForeachOrderTest)
+{
+    // Average
+    const std::vector numbers { 1, 2, 3, 4, 5 };
+    std::vector<int> visitedNumbers;
+
+    // Act
+    auto linq = ExtendedCpp::LINQ::Generator(numbers);
+    for (const int number : linq)
+        visitedNumbers.push_back(number);
+
+    // Assert
+    ASSERT_EQ(numbers, visitedNumbers);
+}
+
+TEST(LINQ_Generator_Tests, PassByReferenceTest)
+{
+    // Average
+    std::vector<CopyCounter> numbers;
+    for (int i = 0; i < 100; ++i)
+        numbers.emplace_back(i);
+    CopyCounter::Copies = 0;
+
+    // Act
+    const std::vector result = ExtendedCpp::LINQ::Generator(std::move(numbers))
+            .Where([](const CopyCounter& number){ return number.Value % 2 == 0; })
+            .Skip(5)
+            .RemoveWhere([](const CopyCounter& number){ return number.Value % 4 == 0; })
+            .TakeWhile([](const CopyCounter& number){ return number.Value < 90; })
+            .Take(10)
+            .ToVector();
+    const std::size_t copies = CopyCounter::Copies;
+
+    // Assert
+    ASSERT_EQ(0, copies);
+    ASSERT_EQ(10, result.size());
+    ASSERT_EQ(10, result.front().Value);
+    ASSERT_EQ(46, result.back().Value);
+}
+
 TEST(LINQ_Generator_Tests, EmptyCollectionTest)
 {
     // Average
@@ -1143,4 +1264,21 @@ TEST(LINQ_Generator_Tests, MapTest)
     // Assert
     for (std::size_t i = 0; i < assertVector.size(); ++i)
         ASSERT_EQ(mapped[i], assertVector[i]);
-}
\ No newline at end of file
+}
+TEST(LINQ_Generator_Tests, ChunkWindowBatchTest)
+{
+    // Average
+    const std::vector<int> numbers = { 1, 2, 3, 4, 5, 6, 7 };
+
+    // Act
+    const auto chunks = ExtendedCpp::LINQ::Generator(numbers).Chunk(3).ToVector();
+    const auto windows = ExtendedCpp::LINQ::Generator(numbers).Window(3, 2).ToVector();
+    const auto sparseWindows = ExtendedCpp::LINQ::Generator(numbers).Window(2, 3).ToVector();
+    const auto batches = ExtendedCpp::LINQ::Generator(numbers).Batch(4).ToVector();
+
+    // Assert
+    ASSERT_EQ(chunks, (std::vector<std::vector<int>> { { 1, 2, 3 }, { 4, 5, 6 }, { 7 } }));
+    ASSERT_EQ(windows, (std::vector<std::vector<int>> { { 1, 2, 3 }, { 3, 4, 5 }, { 5, 6, 7 } }));
+    ASSERT_EQ(sparseWindows, (std::vector<std::vector<int>> { { 1, 2 }, { 4, 5 } }));
+    ASSERT_EQ(batches, (std::vector<std::vector<int>> { { 1, 2, 3, 4 }, { 5, 6, 7 } }));
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <ExtendedCpp/LINQ.h>
+
+#include "LINQ_Tests.h"
+
+TEST(LINQ_Incremental_Tests, WhereGroupBySumTest)
+{
+    // Average
+    ExtendedCpp::LINQ::ObservableCollection<Person> people(std::vector {
+        Person("Tom", 23), Person("Bob", 27), Person("Sam", 29), Person("Alice", 24) });
+
+    const auto ages = ExtendedCpp::LINQ::Incremental(people)
+            .Where([](const Person& person){ return person.Age > 23; })
+            .GroupBy([](const Person& person){ return person.Name.size(); })
+            .Sum([](const Person& person){ return static_cast<int>(person.Age); });
+    const auto count = ExtendedCpp::LINQ::Incremental(people).Count();
+    const std::size_t initialGroups = ages.Reducer().size();
+    const int initialThreeLetters = ages.Reducer().At(3);
+
+    // Act
+    people.Insert(Person("Ann", 30));
+    people.Insert(Person("Max", 20));
+    people.EraseAt(1);
+    people.EraseAt(3);
+    people.Replace(0, Person("Tom", 40));
+
+    // Assert
+    ASSERT_EQ(initialGroups, 2);
+    ASSERT_EQ(initialThreeLetters, 56);
+    ASSERT_EQ(ages.Result(), (std::unordered_map<std::size_t, int> { { 3, 99 } }));
+    ASSERT_FALSE(ages.Reducer().Contains(5));
+    ASSERT_EQ(count.Result(), 4);
+}
+
+TEST(LINQ_Incremental_Tests, SelectAverageBagTest)
+{
+    // Average
+    ExtendedCpp::LINQ::ObservableCollection<int> numbers(std::vector { 8, 7, 1, 9, 50, 0, 3 });
+    const auto query = ExtendedCpp::LINQ::Incremental(numbers).Where([](const int n){ return n % 2 == 1; });
+
+    const auto sum = query.Sum();
+    const auto average = query.Average([](const int n){ return static_cast<double>(n); });
+    const auto squares = query.Select([](const int n){ return n * n; }).ToBag();
+
+    // Act
+    numbers.Insert(5);
+    numbers.Insert(6);
+    numbers.Erase(9);
+    numbers.Erase(1);
+
+    // Assert
+    ASSERT_EQ(sum.Result(), 15);
+    ASSERT_DOUBLE_EQ(average.Result(), 5.0);
+    ASSERT_EQ(squares.Result(), (std::unordered_multiset { 49, 9, 25 }));
+
+    for (const int number : std::vector { 7, 3, 5 })
+        numbers.Erase(number);
+    ASSERT_EQ(sum.Result(), 0);
+    ASSERT_DOUBLE_EQ(average.Result(), 0.0);
+    ASSERT_TRUE(squares.Result().empty());
+}
+
+TEST(LINQ_Incremental_Tests, NegativeAverageTest)
+{
+    // Average
+    ExtendedCpp::LINQ::ObservableCollection<int> numbers(std::vector { -7, -2, 3 });
+    const auto average = ExtendedCpp::LINQ::Incremental(numbers).Average();
+    const auto groupAverages = ExtendedCpp::LINQ::Incremental(numbers)
+            .GroupBy([](const int n){ return n < 0; })
+            .Average([](const int n){ return n; });
+    const int initialAverage = average.Result();
+
+    // Act
+    numbers.Insert(-10);
+
+    // Assert
+    ASSERT_EQ(initialAverage, -2);
+    ASSERT_EQ(average.Result(), -4);
+    ASSERT_EQ(groupAverages.Result(), (std::unordered_map<bool, int> { { true, -6 }, { false, 3 } }));
+}
@@ -1,4 +1,8 @@
 #include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
 
 #include <ExtendedCpp/LINQ.h>
 
@@ -178,6 +182,127 @@ TEST(LINQ_Tests, OrderByWithSelectorTest)
     ASSERT_EQ(29, sortedAges[3]);
 }
 
+TEST(LINQ_Tests, OrderByStableTest)
+{
+    // Average
+    Person person1("Tom", 23);
+    Person person2("Bob", 27);
+    Person person3("Sam", 23);
+    Person person4("Alice", 27);
+    Person person5("Nick", 20);
+
+    std::vector people { person1, person2, person3, person4, person5 };
+    std::size_t selectorCalls = 0;
+
+    // Act
+    std::vector sortedPeople = ExtendedCpp::LINQ::From(people)
+            .OrderBy([&selectorCalls](const Person& person){ ++selectorCalls; return person.Age; },
+                     ExtendedCpp::LINQ::OrderType::DESC)
+            .ToVector();
+
+    // Assert
+    ASSERT_EQ(people.size(), selectorCalls);
+    ASSERT_EQ("Bob", sortedPeople[0].Name);
+    ASSERT_EQ("Alice", sortedPeople[1].Name);
+    ASSERT_EQ("Tom", sortedPeople[2].Name);
+    ASSERT_EQ("Sam", sortedPeople[3].Name);
+    ASSERT_EQ("Nick", sortedPeople[4].Name);
+}
+
+TEST(LINQ_Tests, OrderParallelTest)
+{
+    // Average
+    std::vector<int> numbers(100000);
+    for (std::size_t i = 0; i < numbers.size(); ++i)
+        numbers[i] = static_cast<int>((i * 7919) % 1000);
+
+    // Act
+    const std::vector sortedNumbers = ExtendedCpp::LINQ::From(numbers)
+            .Order(ExtendedCpp::LINQ::OrderType::DESC, ExtendedCpp::LINQ::Parallel())
+            .ToVector();
+
+    // Assert
+    ASSERT_EQ(numbers.size(), sortedNumbers.size());
+    ASSERT_TRUE(std::ranges::is_sorted(sortedNumbers, std::greater<>()));
+
+    // Average
+    std::vector<Person> people;
+    for (std::size_t i = 0; i < 100000; ++i)
+        people.emplace_back(std::to_string(i), static_cast<unsigned char>(i % 50));
+
+    // Act
+    const std::vector sortedPeople = ExtendedCpp::LINQ::From(people)
+            .OrderBy([](const Person& person){ return person.Age; }, ExtendedCpp::LINQ::OrderType::ASC,
+                     ExtendedCpp::LINQ::Parallel { .ThreadCount = 4, .Stable = true })
+            .ToVector();
+
+    // Assert
+    for (std::size_t i = 1; i < sortedPeople.size(); ++i)
+    {
+        ASSERT_TRUE(sortedPeople[i - 1].Age <= sortedPeople[i].Age);
+        if (sortedPeople[i - 1].Age == sortedPeople[i].Age)
+        {
+            ASSERT_TRUE(std::stoul(sortedPeople[i - 1].Name) < std::stoul(sortedPeople[i].Name));
+        }
+    }
+}
+
+TEST(LINQ_Tests, TopKTest)
+{
+    // Average
+    std::vector<int> numbers(100000);
+    for (std::size_t i = 0; i < numbers.size(); ++i)
+        numbers[i] = static_cast<int>((i * 7919) % 100003);
+    std::vector<int> expectedNumbers = numbers;
+    std::ranges::sort(expectedNumbers, std::greater<>());
+    expectedNumbers.resize(100);
+
+    // Act
+    const std::vector topNumbers = ExtendedCpp::LINQ::From(numbers)
+            .TopK(100, ExtendedCpp::LINQ::OrderType::DESC)
+            .ToVector();
+    const std::vector parallelTopNumbers = ExtendedCpp::LINQ::From(numbers)
+            .TopK(100, ExtendedCpp::LINQ::OrderType::DESC, ExtendedCpp::LINQ::Parallel { .ThreadCount = 4 })
+            .ToVector();
+    const std::vector movedTopNumbers = ExtendedCpp::LINQ::From(std::move(numbers))
+            .TopK(100, ExtendedCpp::LINQ::OrderType::DESC)
+            .ToVector();
+
+    // Assert
+    ASSERT_EQ(expectedNumbers, topNumbers);
+    ASSERT_EQ(expectedNumbers, parallelTopNumbers);
+    ASSERT_EQ(expectedNumbers, movedTopNumbers);
+
+    // Average
+    Person person1("Tom", 23);
+    Person person2("Bob", 27);
+    Person person3("Sam", 23);
+    Person person4("Alice", 27);
+    Person person5("Nick", 20);
+
+    std::vector people { person1, person2, person3, person4, person5 };
+    std::size_t selectorCalls = 0;
+
+    // Act
+    std::vector topPeople = ExtendedCpp::LINQ::From(people)
+            .TopK(3, [&selectorCalls](const Person& person){ ++selectorCalls; return person.Age; },
+                  ExtendedCpp::LINQ::OrderType::DESC)
+            .ToVector();
+    std::vector allPeople = ExtendedCpp::LINQ::From(people)
+            .TopK(10, [](const Person& person){ return person.Name; })
+            .ToVector();
+
+    // Assert
+    ASSERT_EQ(people.size(), selectorCalls);
+    ASSERT_EQ(3, topPeople.size());
+    ASSERT_EQ("Bob", topPeople[0].Name);
+    ASSERT_EQ("Alice", topPeople[1].Name);
+    ASSERT_EQ("Tom", topPeople[2].Name);
+    ASSERT_EQ(people.size(), allPeople.size());
+    ASSERT_EQ("Alice", allPeople[0].Name);
+    ASSERT_EQ("Tom", allPeople[4].Name);
+}
+
 TEST(LINQ_Tests, ExceptTest)
 {
     // Average
@@ -369,6 +494,90 @@ TEST(LINQ_Tests, MaxWithSelectorTest)
     ASSERT_EQ(29, result);
 }
 
+TEST(LINQ_Tests, MinMaxTest)
+{
+    // Average
+    std::vector<double> numbers(1000);
+    for (std::size_t i = 0; i < numbers.size(); ++i)
+        numbers[i] = static_cast<double>((i * 7919) % 1000) - 500.0;
+    numbers[3] = std::numeric_limits<double>::quiet_NaN();
+
+    // Act
+    const auto [min, max] = ExtendedCpp::LINQ::From(numbers).MinMax();
+
+    // Assert
+    ASSERT_EQ(-500.0, min);
+    ASSERT_EQ(499.0, max);
+    ASSERT_EQ(min, ExtendedCpp::LINQ::From(numbers).Min());
+    ASSERT_EQ(max, ExtendedCpp::LINQ::From(numbers).Max());
+
+    // Average
+    const Person person1("Tom", 23);
+    const Person person2("Bob", 27);
+    const Person person3("Sam", 29);
+    const Person person4("Alice", 24);
+
+    const std::vector people { person1, person2, person3, person4 };
+
+    // Act
+    const auto [minName, maxName] = ExtendedCpp::LINQ::From(people)
+            .MinMax([](const Person& person){ return person.Name; });
+
+    // Assert
+    ASSERT_EQ("Alice", minName);
+    ASSERT_EQ("Tom", maxName);
+}
+
+TEST(LINQ_Tests, SumLargeTest)
+{
+    // Average
+    std::vector<long long> numbers(100003);
+    for (std::size_t i = 0; i < numbers.size(); ++i)
+        numbers[i] = static_cast<long long>(i) - 50000;
+    std::vector<double> halves(100003, 0.5);
+
+    // Act
+    const long long sum = ExtendedCpp::LINQ::From(numbers).Sum();
+    const double halvesSum = ExtendedCpp::LINQ::From(halves).Sum();
+    const double halvesAverage = ExtendedCpp::LINQ::From(halves).Average();
+    const std::size_t count = ExtendedCpp::LINQ::From(numbers).Count([](const long long n){ return n % 3 == 0; });
+
+    // Assert
+    ASSERT_EQ(100003LL * 100002LL / 2 - 50000LL * 100003LL, sum);
+    ASSERT_EQ(50001.5, halvesSum);
+    ASSERT_EQ(0.5, halvesAverage);
+    ASSERT_EQ(33334, count);
+}
+
+TEST(LINQ_Tests, SumSummationTypeTest)
+{
+    // Average
+    const std::vector cancelling { 1.0, 1e100, 1.0, -1e100 };
+    std::vector<double> tenths(1000000, 0.1);
+    std::vector<double> noise(300007);
+    for (std::size_t i = 0; i < noise.size(); ++i)
+        noise[i] = static_cast<double>((i * 7919) % 1000) / 7.0 - 71.0;
+
+    // Act
+    const double naive = ExtendedCpp::LINQ::From(cancelling).Sum(ExtendedCpp::LINQ::SummationType::NAIVE);
+    const double compensated = ExtendedCpp::LINQ::From(cancelling).Sum(ExtendedCpp::LINQ::SummationType::KAHAN_NEUMAIER);
+    const double naiveTenths = ExtendedCpp::LINQ::From(tenths).Sum(ExtendedCpp::LINQ::SummationType::NAIVE);
+    const double pairwiseTenths = ExtendedCpp::LINQ::From(tenths).Sum(ExtendedCpp::LINQ::SummationType::PAIRWISE);
+    const double compensatedTenths = ExtendedCpp::LINQ::From(tenths)
+            .Average([](const double x){ return x * 10; }, ExtendedCpp::LINQ::SummationType::KAHAN_NEUMAIER);
+    const double pairwise = ExtendedCpp::LINQ::From(noise).Sum(ExtendedCpp::LINQ::SummationType::PAIRWISE);
+
+    // Assert
+    ASSERT_EQ(0.0, naive);
+    ASSERT_EQ(2.0, compensated);
+    ASSERT_GT(std::abs(naiveTenths - 100000.0), 1e-7);
+    ASSERT_LT(std::abs(pairwiseTenths - 100000.0), 1e-9);
+    ASSERT_EQ(1.0, compensatedTenths);
+    for (const std::size_t threadCount : { 1, 2, 3, 8 })
+        ASSERT_EQ(pairwise, ExtendedCpp::LINQ::From(noise).Sum(ExtendedCpp::LINQ::SummationType::PARALLEL_PAIRWISE,
+                                                               ExtendedCpp::LINQ::Parallel { .ThreadCount = threadCount }));
+}
+
 TEST(LINQ_Tests, AverageTest)
 {
     // Average
@@ -589,6 +798,54 @@ TEST(LINQ_Tests, TakeLastTest)
     ASSERT_EQ(6, result[2]);
 }
 
+TEST(LINQ_Tests, SliceTest)
+{
+    // Average
+    std::vector<int> numbers(1000000);
+    std::iota(numbers.begin(), numbers.end(), 0);
+    const auto linqContainer = ExtendedCpp::LINQ::From(std::move(numbers));
+
+    // Act
+    const auto page = linqContainer.Skip(500000).Take(10);
+    const auto lastPage = linqContainer.Skip(999995).Take(10);
+    const auto trimmed = linqContainer.TakeLast(5).SkipLast(1).Erase(0);
+    auto mutablePage = page;
+    *mutablePage.begin() = -1;
+
+    // Assert
+    ASSERT_EQ(linqContainer.data() + 500000, page.data());
+    ASSERT_EQ(500000, page.First());
+    ASSERT_EQ(10, page.size());
+    ASSERT_EQ((std::vector { 999995, 999996, 999997, 999998, 999999 }), lastPage.ToVector());
+    ASSERT_EQ((std::vector { 999996, 999997, 999998 }), trimmed.ToVector());
+    ASSERT_EQ(-1, mutablePage.First());
+    ASSERT_EQ(500000, page.First());
+    ASSERT_EQ(500000, linqContainer.At(500000));
+}
+
+TEST(LINQ_Tests, SliceInvalidationTest)
+{
+    // Average
+    auto original = ExtendedCpp::LINQ::From(std::vector { 1, 2, 3, 4, 5, 6 });
+    auto expiring = ExtendedCpp::LINQ::From(std::vector { 1, 2, 3, 4, 5, 6 });
+
+    // Act
+    const auto iterator = original.begin();
+    const auto copy = original;
+    *iterator = 100;
+    auto skipped = std::move(expiring).Skip(2);
+    const auto chunks = skipped.Chunk(2);
+    const int* first = std::as_const(skipped).data();
+    const auto mutableFirst = skipped.begin();
+
+    // Assert
+    ASSERT_EQ(100, original.First());
+    ASSERT_EQ(1, copy.First());
+    ASSERT_EQ(3, chunks.First()[0]);
+    ASSERT_EQ(first, &*mutableFirst);
+    ASSERT_EQ(3, *first);
+}
+
 TEST(LINQ_Tests, TakeWhileTest)
 {
     // Average
@@ -627,6 +884,38 @@ TEST(LINQ_Tests, GroupByTest)
     ASSERT_EQ(3, companies["Google"].size());
 }
 
+TEST(LINQ_Tests, CountByTest)
+{
+    // Average
+    Employer person1("Tom", "Microsoft");
+    Employer person2("Bob", "Google");
+    Employer person3("Sam", "Microsoft");
+    Employer person4("Alice", "Google");
+    Employer person5("Jon", "Google");
+
+    std::vector people { person1, person2, person3, person4, person5 };
+    std::vector<int> numbers;
+    for (int i = 0; i < 200000; ++i)
+        numbers.push_back(i % 10);
+
+    // Act
+    const std::vector companies = ExtendedCpp::LINQ::From(people)
+            .CountBy([](const Employer& employer){ return employer.CompanyName; })
+            .ToVector();
+    const std::vector remainders = ExtendedCpp::LINQ::From(numbers)
+            .CountBy([](const int number){ return number % 3; }, ExtendedCpp::LINQ::Parallel { .ThreadCount = 4 })
+            .ToVector();
+
+    // Assert
+    ASSERT_EQ(2, companies.size());
+    ASSERT_EQ(std::make_pair(std::string("Microsoft"), std::size_t(2)), companies[0]);
+    ASSERT_EQ(std::make_pair(std::string("Google"), std::size_t(3)), companies[1]);
+    ASSERT_EQ(3, remainders.size());
+    ASSERT_EQ(std::make_pair(0, std::size_t(80000)), remainders[0]);
+    ASSERT_EQ(std::make_pair(1, std::size_t(60000)), remainders[1]);
+    ASSERT_EQ(std::make_pair(2, std::size_t(60000)), remainders[2]);
+}
+
 TEST(LINQ_Tests, JoinTest)
 {
     // Average
@@ -912,6 +1201,88 @@ TEST(LINQ_Tests, FromContainerTest)
         ASSERT_TRUE(linq1.Contains(pair.first));
 }
 
+TEST(LINQ_Tests, BorrowTest)
+{
+    // Average
+    const std::vector numbers { 8, 7, 1, 9, 50, 0, 3 };
+
+    // Act
+    const auto linq = ExtendedCpp::LINQ::Borrow(numbers);
+    const auto copy = linq;
+    const std::size_t count = linq.Count([](const int n){ return n > 5; });
+    const int sum = copy.Sum();
+    auto mutableCopy = linq;
+    *mutableCopy.begin() = 100;
+
+    // Assert
+    ASSERT_TRUE(linq.IsBorrowed());
+    ASSERT_TRUE(copy.IsBorrowed());
+    ASSERT_EQ(numbers.data(), linq.data());
+    ASSERT_EQ(4, count);
+    ASSERT_EQ(78, sum);
+    ASSERT_FALSE(mutableCopy.IsBorrowed());
+    ASSERT_EQ(100, mutableCopy.First());
+    ASSERT_EQ(8, numbers[0]);
+    ASSERT_EQ(8, linq.First());
+}
+
+TEST(LINQ_Tests, RvalueChainTest)
+{
+    // Average
+    std::vector<CopyCounter> numbers;
+    for (const int number : { 8, 7, 1, 9, 50, 0, 3, 12, 4 })
+        numbers.emplace_back(number);
+    const auto expected = ExtendedCpp::LINQ::From(numbers)
+            .Where([](const CopyCounter& n){ return n.Value > 2; })
+            .Order()
+            .Take(4)
+            .Select([](const CopyCounter& n){ return n.Value; })
+            .ToVector();
+    CopyCounter::Copies = 0;
+
+    // Act
+    const auto result = ExtendedCpp::LINQ::From(std::move(numbers))
+            .Where([](const CopyCounter& n){ return n.Value > 2; })
+            .Order()
+            .Take(4)
+            .Reverse()
+            .Skip(1)
+            .PushFront(CopyCounter(100))
+            .Erase(3);
+    const std::size_t copies = CopyCounter::Copies;
+
+    // Assert
+    ASSERT_EQ(0, copies);
+    ASSERT_EQ((std::vector { 3, 4, 7, 8 }), expected);
+    ASSERT_EQ((std::vector { 100, 7, 4 }), result.Select([](const CopyCounter& n){ return n.Value; }).ToVector());
+}
+
+TEST(LINQ_Tests, FromAdaptorTest)
+{
+    // Average
+    std::stack<int> numbersStack;
+    std::queue<int> numbersQueue;
+    std::priority_queue<int> numbersPriorityQueue;
+    for (const int number : { 8, 7, 1, 9, 50, 0, 3 })
+    {
+        numbersStack.push(number);
+        numbersQueue.push(number);
+        numbersPriorityQueue.push(number);
+    }
+
+    // Act
+    const std::vector stackResult = ExtendedCpp::LINQ::From(numbersStack).ToVector();
+    const std::vector queueResult = ExtendedCpp::LINQ::From(numbersQueue).ToVector();
+    const std::vector priorityQueueResult = ExtendedCpp::LINQ::From(numbersPriorityQueue).ToVector();
+    const std::vector movedStackResult = ExtendedCpp::LINQ::From(std::move(numbersStack)).ToVector();
+
+    // Assert
+    ASSERT_EQ((std::vector { 3, 0, 50, 9, 1, 7, 8 }), stackResult);
+    ASSERT_EQ((std::vector { 8, 7, 1, 9, 50, 0, 3 }), queueResult);
+    ASSERT_EQ((std::vector { 50, 9, 8, 7, 3, 1, 0 }), priorityQueueResult);
+    ASSERT_EQ(stackResult, movedStackResult);
+}
+
 TEST(LINQ_Tests, ToContainerTest)
 {
     // Average
@@ -1018,6 +1389,22 @@ TEST(LINQ_Tests, IndexAtTest)
     ASSERT_EQ(ExtendedCpp::LINQ::NPOS, npos);
 }
 
+TEST(LINQ_Tests, BinarySearchTest)
+{
+    // Average
+    const std::vector numbers { 1, 3, 3, 8, 9, 14, 56 };
+
+    // Act
+    const auto linqContainer = ExtendedCpp::LINQ::From(numbers);
+
+    // Assert
+    ASSERT_EQ(linqContainer.BinarySearch(3), 1);
+    ASSERT_EQ(linqContainer.BinarySearch(4), ExtendedCpp::LINQ::NPOS);
+    ASSERT_EQ(linqContainer.BinarySearch(9, [](const int number){ return number / 2; }), 3);
+    ASSERT_EQ(linqContainer.LowerBound(10), 5);
+    ASSERT_EQ(linqContainer.LowerBound(100), 7);
+}
+
 TEST(LINQ_Tests, PushBackTest)
 {
     // Average
@@ -1164,4 +1551,220 @@ TEST(LINQ_Tests, MapTest)
     // Assert
     for (std::size_t i = 0; i < assertVector.size(); ++i)
         ASSERT_EQ(mapped[i], assertVector[i]);
-}
\ No newline at end of file
+}
+TEST(LINQ_Tests, ChunkWindowBatchTest)
+{
+    // Average
+    const std::vector<int> numbers = { 1, 2, 3, 4, 5, 6, 7 };
+    const auto linq = ExtendedCpp::LINQ::From(numbers);
+
+    // Act
+    const auto chunks = linq.Chunk(3).ToVector();
+    const auto windows = linq.Window(3, 2).ToVector();
+    const auto batches = ExtendedCpp::LINQ::From(numbers).Batch(3).ToVector();
+    const auto borrowed = ExtendedCpp::LINQ::Borrow(numbers);
+    const auto borrowedChunks = borrowed.Chunk(3).ToVector();
+
+    // Assert
+    ASSERT_EQ(chunks.size(), 3);
+    ASSERT_EQ(chunks[0].data(), linq.begin());
+    ASSERT_TRUE(std::ranges::equal(chunks[1], std::vector { 4, 5, 6 }));
+    ASSERT_TRUE(std::ranges::equal(chunks[2], std::vector { 7 }));
+    ASSERT_EQ(windows.size(), 3);
+    ASSERT_TRUE(std::ranges::equal(windows[2], std::vector { 5, 6, 7 }));
+    ASSERT_EQ(batches, (std::vector<std::vector<int>> { { 1, 2, 3 }, { 4, 5, 6 }, { 7 } }));
+    ASSERT_EQ(borrowedChunks[0].data(), numbers.data());
+    ASSERT_THROW(linq.Chunk(0), std::invalid_argument);
+}
+
+TEST(LINQ_Tests, MemoryResourceTest)
+{
+    // Average
+    const std::vector<int> numbers = { 8, 7, 1, 9, 50, 0, 3, 12, 4, 7 };
+    std::pmr::monotonic_buffer_resource arena;
+    CountingResource resource(&arena);
+    CountingResource defaultResource;
+    std::pmr::memory_resource* previous = std::pmr::set_default_resource(&defaultResource);
+
+    // Act
+    const auto result = ExtendedCpp::LINQ::From(numbers, &resource)
+            .Where([](const int n){ return n > 2; })
+            .Select([](const int n){ return n * 2; })
+            .Distinct()
+            .Reverse()
+            .Skip(1);
+    const std::size_t queryAllocations = resource.Allocations;
+    const auto inPlace = ExtendedCpp::LINQ::From(std::pmr::vector<int>(numbers.cbegin(), numbers.cend(), &resource))
+            .Where([](const int n){ return n > 2; })
+            .Order()
+            .PushBack(100)
+            .Take(3);
+    const std::size_t inPlaceAllocations = resource.Allocations - queryAllocations;
+    std::pmr::set_default_resource(previous);
+
+    // Assert
+    ASSERT_EQ((std::vector { 24, 18, 16, 14, 8, 6 }), result.ToVector());
+    ASSERT_EQ((std::vector { 3, 4, 7 }), inPlace.ToVector());
+    ASSERT_GE(queryAllocations, 5);
+    ASSERT_EQ(2, inPlaceAllocations);
+    ASSERT_EQ(0, defaultResource.Allocations);
+}
+
+TEST(LINQ_Tests, GroupJoinMemoryResourceTest)
+{
+    // Average
+    const std::vector numbers { 8, 7, 1, 9, 50, 0, 3, 12, 4, 7 };
+    const std::vector remainders { 2, 0 };
+    std::pmr::monotonic_buffer_resource arena;
+    CountingResource resource(&arena);
+    CountingResource defaultResource;
+    std::pmr::memory_resource* previous = std::pmr::set_default_resource(&defaultResource);
+    bool groupsInResource = true;
+
+    // Act
+    const auto result = ExtendedCpp::LINQ::From(numbers, &resource)
+            .GroupJoin(remainders,
+                [](const int n) { return n % 3; },
+                [](const int remainder) { return remainder; },
+                [&](const std::pmr::vector<int>& group, const int remainder)
+                {
+                    groupsInResource = groupsInResource && group.get_allocator().resource() == &resource;
+                    return std::pair(remainder, group.size());
+                })
+            .ToVector();
+    std::pmr::set_default_resource(previous);
+
+    // Assert
+    ASSERT_EQ((std::vector { std::pair<int, std::size_t>(0, 4), std::pair<int, std::size_t>(2, 2) }), result);
+    ASSERT_TRUE(groupsInResource);
+    ASSERT_GE(resource.Allocations, 6);
+    ASSERT_EQ(0, defaultResource.Allocations);
+}
+
+TEST(LINQ_Tests, SemiJoinAntiJoinTest)
+{
+    // Average
+    const Person person1("Tom", 23);
+    const Person person2("Bob", 27);
+    const Person person3("Sam", 29);
+    const Person person4("Alice", 24);
+    const std::vector people { person1, person2, person3, person4 };
+    const std::vector<std::string> names { "Sam", "Tom", "John" };
+    std::vector<int> numbers(200000);
+    std::iota(numbers.begin(), numbers.end(), 0);
+    std::vector<int> evens;
+    for (int i = 0; i < 300000; i += 2)
+        evens.push_back(i);
+
+    // Act
+    const auto semiJoin = ExtendedCpp::LINQ::From(people)
+            .SemiJoin(names, [](const Person& person){ return person.Name; }, [](const std::string& name){ return name; })
+            .Select([](const Person& person){ return person.Name; })
+            .ToVector();
+    const auto antiJoin = ExtendedCpp::LINQ::From(people)
+            .AntiJoin(names, [](const Person& person){ return person.Name; }, [](const std::string& name){ return name; })
+            .Select([](const Person& person){ return person.Name; })
+            .ToVector();
+    const auto linq = ExtendedCpp::LINQ::From(numbers);
+    const std::size_t matched = linq.SemiJoin(evens).Count();
+    const std::size_t unmatched = ExtendedCpp::LINQ::From(numbers).AntiJoin(evens).Count();
+
+    // Assert
+    ASSERT_EQ((std::vector<std::string> { "Tom", "Sam" }), semiJoin);
+    ASSERT_EQ((std::vector<std::string> { "Bob", "Alice" }), antiJoin);
+    ASSERT_EQ(matched, 100000);
+    ASSERT_EQ(unmatched, 100000);
+    ASSERT_TRUE(linq.SemiJoin(std::vector<int>()).empty());
+}
+
+TEST(LINQ_Tests, EncodedStringTest)
+{
+    // Average
+    const std::vector<std::string> names { "Tom", "Bob", "Sam", "Bob", "Alice", "Tom", "Bob" };
+
+    // Act
+    const auto encoded = ExtendedCpp::LINQ::Encode(names);
+    const std::vector<std::string> ordered = encoded.Order().ToVector();
+    const std::vector<std::string> descending = encoded.Order(ExtendedCpp::LINQ::OrderType::DESC).ToVector();
+    const std::vector<std::string> distinct = encoded.Distinct().ToVector();
+    const auto counts = encoded.CountBy().ToVector();
+    const std::vector<std::string> filtered = encoded.Where([](const std::string& name){ return name.size() == 3; })
+            .ToVector();
+
+    // Assert
+    ASSERT_EQ(encoded.Dictionary().size(), 4);
+    ASSERT_EQ(encoded.Codes()[0], *encoded.Dictionary().Encode("Tom"));
+    ASSERT_FALSE(encoded.Dictionary().Encode("John").has_value());
+    ASSERT_EQ(encoded.ToVector(), names);
+    ASSERT_EQ(ordered, (std::vector<std::string> { "Alice", "Bob", "Bob", "Bob", "Sam", "Tom", "Tom" }));
+    ASSERT_EQ(descending, (std::vector<std::string> { "Tom", "Tom", "Sam", "Bob", "Bob", "Bob", "Alice" }));
+    ASSERT_EQ(distinct, ExtendedCpp::LINQ::From(names).Distinct().ToVector());
+    ASSERT_EQ(counts, (std::vector<std::pair<std::string, std::size_t>> {
+        { "Tom", 2 }, { "Bob", 3 }, { "Sam", 1 }, { "Alice", 1 } }));
+    ASSERT_EQ(filtered, (std::vector<std::string> { "Tom", "Bob", "Sam", "Bob", "Tom", "Bob" }));
+    ASSERT_EQ(encoded.Count("Bob"), 3);
+    ASSERT_TRUE(encoded.Contains("Sam"));
+    ASSERT_FALSE(encoded.Where([](const std::string& name){ return name != "Sam"; }).Contains("Sam"));
+    ASSERT_EQ(encoded.Min(), "Alice");
+    ASSERT_EQ(encoded.Max(), "Tom");
+    ASSERT_THROW(static_cast<void>(ExtendedCpp::LINQ::Encode(std::vector<std::string>()).Max()), std::out_of_range);
+    ASSERT_THROW(ExtendedCpp::LINQ::StringDictionary(std::vector<std::string> { "Bob", "Alice" }), std::invalid_argument);
+    ASSERT_THROW(ExtendedCpp::LINQ::StringDictionary(std::vector<std::string> { "Bob", "Bob" }), std::invalid_argument);
+}
+
+TEST(LINQ_Tests, EncodedStringGroupByTest)
+{
+    // Average
+    std::vector<std::string> names { "Tom", "Bob", "Sam", "Bob", "Alice", "Tom", "Bob" };
+    for (int i = 0; i < 100; ++i)
+        names.push_back("Name" + std::to_string(i));
+    const auto encoded = ExtendedCpp::LINQ::Encode(names);
+    std::size_t keyCalls = 0;
+    std::size_t predicateCalls = 0;
+
+    // Act
+    const auto groups = encoded.GroupBy([&keyCalls](const std::string& name){ ++keyCalls; return name.size(); });
+    const auto shortNames = encoded.Where([](const std::string& name){ return name.size() == 3; });
+    const auto bobs = shortNames.Where([&predicateCalls](const std::string& name){ ++predicateCalls; return name == "Bob"; });
+    const std::vector<std::string> ordered = shortNames.Order(ExtendedCpp::LINQ::OrderType::DESC).ToVector();
+    const std::vector<std::string> distinct = shortNames.Distinct().ToVector();
+    const auto counts = shortNames.CountBy().ToVector();
+
+    // Assert
+    ASSERT_EQ(keyCalls, 104);
+    ASSERT_EQ(groups.size(), 3);
+    ASSERT_EQ(groups.at(3), (std::vector<std::string> { "Tom", "Bob", "Sam", "Bob", "Tom", "Bob" }));
+    ASSERT_EQ(groups.at(5), (std::vector<std::string> { "Alice", "Name0", "Name1", "Name2", "Name3", "Name4",
+                                                         "Name5", "Name6", "Name7", "Name8", "Name9" }));
+    ASSERT_EQ(groups.at(6).size(), 90);
+    ASSERT_EQ(predicateCalls, 3);
+    ASSERT_EQ(bobs.ToVector(), (std::vector<std::string> { "Bob", "Bob", "Bob" }));
+    ASSERT_EQ(ordered, (std::vector<std::string> { "Tom", "Tom", "Sam", "Bob", "Bob", "Bob" }));
+    ASSERT_EQ(distinct, (std::vector<std::string> { "Bob", "Sam", "Tom" }));
+    ASSERT_EQ(counts, (std::vector<std::pair<std::string, std::size_t>> { { "Tom", 2 }, { "Bob", 3 }, { "Sam", 1 } }));
+}
+
+TEST(LINQ_Tests, BoolContainerTest)
+{
+    // Average
+    const std::vector<bool> flags { true, false, true, false, true };
+
+    // Act
+    const auto linq = ExtendedCpp::LINQ::From(flags);
+    const std::size_t count = linq.Where([](const bool flag){ return flag; }).Count();
+    const std::vector<int> numbers = linq.Select([](const bool flag){ return flag ? 1 : 0; }).ToVector();
+    const std::vector<bool> skipped = linq.Skip(1).Take(3).ToVector();
+    const std::vector<bool> removed = ExtendedCpp::LINQ::From(std::vector<bool> { true, false, false })
+            .RemoveWhere([](const bool flag){ return flag; })
+            .ToVector();
+    auto copy = linq;
+    *copy.begin() = false;
+
+    // Assert
+    ASSERT_EQ(count, 3);
+    ASSERT_EQ(numbers, (std::vector<int> { 1, 0, 1, 0, 1 }));
+    ASSERT_EQ(skipped, (std::vector<bool> { false, true, false }));
+    ASSERT_EQ(removed, (std::vector<bool> { false, false }));
+    ASSERT_TRUE(linq.First());
+    ASSERT_FALSE(copy.First());
+}
@@ -3,6 +3,9 @@
 
 #include <string>
 #include <vector>
+#include <compare>
+#include <cstddef>
+#include <memory_resource>
 
 class Person
 {
@@ -78,4 +81,66 @@ public:
     ItCompany() = default;
 };
 
+class CopyCounter
+{
+public:
+    inline static std::size_t Copies = 0;
+
+    int Value{};
+
+    CopyCounter() = default;
+
+    explicit CopyCounter(const int value)
+    {
+        Value = value;
+    }
+
+    CopyCounter(const CopyCounter& other) : Value(other.Value)
+    {
+        ++Copies;
+    }
+
+    CopyCounter& operator=(const CopyCounter& other)
+    {
+        Value = other.Value;
+        ++Copies;
+        return *this;
+    }
+
+    CopyCounter(CopyCounter&&) noexcept = default;
+    CopyCounter& operator=(CopyCounter&&) noexcept = default;
+
+    auto operator<=>(const CopyCounter& other) const noexcept = default;
+};
+
+class CountingResource final : public std::pmr::memory_resource
+{
+public:
+    std::size_t Allocations = 0;
+
+    explicit CountingResource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+    {
+        _upstream = upstream;
+    }
+
+private:
+    std::pmr::memory_resource* _upstream;
+
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment) override
+    {
+        ++Allocations;
+        return _upstream->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* pointer, const std::size_t bytes, const std::size_t alignment) override
+    {
+        _upstream->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
 #endif
\ No newline at end of file
@@ -1,4 +1,9 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <execution>
+#include <numeric>
+#include <ranges>
 
 #include <ExtendedCpp/LINQ.h>
 
@@ -139,6 +144,31 @@ TEST(LINQ_View_Tests, SkipWhileTest)
     ASSERT_EQ(6, result[2]);
 }
 
+TEST(LINQ_View_Tests, LazySkipTest)
+{
+    // Average
+    const std::vector numbers{ 1, 2, 3, 4, 5, 6 };
+    std::size_t calls = 0;
+
+    // Act
+    const auto view = ExtendedCpp::LINQ::View(numbers)
+        .SkipWhile([&calls](const int n) { ++calls; return n < 4; })
+        .Skip(1);
+    const std::size_t callsBeforeAccess = calls;
+    const std::vector result = view.ToVector();
+    const std::vector odd = ExtendedCpp::LINQ::View(numbers)
+        .Where([](const int n) { return n % 2 == 1; })
+        .Skip(1)
+        .ToVector();
+
+    // Assert
+    ASSERT_EQ(0, callsBeforeAccess);
+    ASSERT_EQ(4, calls);
+    ASSERT_EQ((std::vector { 5, 6 }), result);
+    ASSERT_EQ((std::vector { 3, 5 }), odd);
+    ASSERT_EQ(2, std::ranges::distance(view));
+}
+
 TEST(LINQ_View_Tests, TakeTest)
 {
     // Average
@@ -219,4 +249,112 @@ TEST(LINQ_View_Tests, MapTest)
     // Assert
     for (std::size_t i = 0; i < assertVector.size(); ++i)
         ASSERT_EQ(mapped[i], assertVector[i]);
-}
\ No newline at end of file
+}
+
+TEST(LINQ_View_Tests, WhereByReferenceTest)
+{
+    // Average
+    const std::vector numbers { 1, 2, 3, 4, 5, 6, 7, 8 };
+    const int divisor = 2;
+    std::size_t calls = 0;
+
+    // Act
+    const auto view = ExtendedCpp::LINQ::View(numbers)
+        .Where([divisor, &calls](const int n){ ++calls; return n % divisor == 0; });
+    std::vector<const int*> addresses;
+    for (const int& number : view)
+        addresses.push_back(&number);
+
+    // Assert
+    ASSERT_EQ(numbers.size(), calls);
+    ASSERT_EQ(4, addresses.size());
+    ASSERT_EQ(&numbers[1], addresses[0]);
+    ASSERT_EQ(&numbers[7], addresses[3]);
+}
+
+TEST(LINQ_View_Tests, RangesViewTest)
+{
+    // Average
+    const std::vector numbers { 1, 2, 3, 4, 5, 6 };
+
+    // Act
+    const auto view = ExtendedCpp::LINQ::View(numbers)
+        .Where([](const int n){ return n > 1; })
+        .Select([](const int n){ return n * 10; })
+        .Take(3);
+    const auto piped = view | std::views::transform([](const int n){ return n + 1; });
+
+    // Assert
+    static_assert(std::ranges::view<std::remove_const_t<decltype(view)>>);
+    static_assert(std::ranges::forward_range<decltype(view)>);
+    ASSERT_EQ(3, std::ranges::distance(view));
+    ASSERT_EQ(21, *std::ranges::begin(piped));
+    ASSERT_EQ(41, std::ranges::max(piped));
+}
+
+TEST(LINQ_View_Tests, StandardAlgorithmsTest)
+{
+    // Average
+    std::vector numbers { 5, 3, 9, 1, 7, 2, 8 };
+
+    // Act
+    const auto head = ExtendedCpp::LINQ::View(numbers).Take(4);
+    std::ranges::sort(head);
+    const auto doubled = ExtendedCpp::LINQ::View(numbers).Select([](const int n){ return n * 2; });
+    const int sum = std::reduce(doubled.begin(), doubled.end());
+    const int headSum = std::reduce(std::execution::unseq, head.begin(), head.end());
+    const auto odd = ExtendedCpp::LINQ::View(numbers).Where([](const int n){ return n % 2 == 1; });
+    std::atomic<int> oddSum = 0;
+    std::for_each(std::execution::par_unseq, odd.begin(), odd.end(), [&oddSum](const int n){ oddSum += n; });
+
+    // Assert
+    static_assert(std::ranges::random_access_range<std::remove_const_t<decltype(doubled)>>);
+    static_assert(std::same_as<std::input_iterator_tag,
+        std::iterator_traits<decltype(doubled.begin())>::iterator_category>);
+    static_assert(std::derived_from<std::iterator_traits<decltype(odd.begin())>::iterator_category,
+        std::forward_iterator_tag>);
+    ASSERT_EQ((std::vector { 1, 3, 5, 9, 7, 2, 8 }), numbers);
+    ASSERT_EQ(70, sum);
+    ASSERT_EQ(18, headSum);
+    ASSERT_EQ(25, oddSum);
+    ASSERT_EQ(7, doubled.size());
+    ASSERT_EQ(18, doubled[3]);
+}
+
+TEST(LINQ_View_Tests, FromRangeTest)
+{
+    // Average
+    const auto squares = std::views::iota(1, 6) | std::views::transform([](const int n){ return n * n; });
+
+    // Act
+    const int sum = ExtendedCpp::LINQ::From(squares).Sum();
+    const std::vector odd = ExtendedCpp::LINQ::View(std::views::iota(1, 6))
+        .Where([](const int n){ return n % 2 == 1; })
+        .ToVector();
+
+    // Assert
+    ASSERT_EQ(55, sum);
+    ASSERT_EQ((std::vector { 1, 3, 5 }), odd);
+}
+
+TEST(LINQ_View_Tests, ChunkWindowBatchTest)
+{
+    // Average
+    const std::vector<int> numbers = { 1, 2, 3, 4, 5, 6, 7 };
+    const std::list<int> list(numbers.begin(), numbers.end());
+
+    // Act
+    const auto chunks = ExtendedCpp::LINQ::View(numbers).Chunk(3);
+    const std::vector<int> windowSums = ExtendedCpp::LINQ::View(list).Window(3)
+        .Select([](const auto& window){ return std::accumulate(window.begin(), window.end(), 0); })
+        .ToVector();
+    const auto batches = ExtendedCpp::LINQ::View(numbers).Where([](const int n){ return n != 4; }).Batch(4).ToVector();
+
+    // Assert
+    ASSERT_EQ(std::ranges::distance(chunks), 3);
+    ASSERT_EQ((*chunks.begin()).data(), numbers.data());
+    ASSERT_EQ((*std::ranges::next(chunks.begin(), 2)).size(), 1);
+    ASSERT_EQ((std::vector { 6, 9, 12, 15, 18 }), windowSums);
+    ASSERT_EQ(batches, (std::vector<std::vector<int>> { { 1, 2, 3, 5 }, { 6, 7 } }));
+    ASSERT_TRUE(ExtendedCpp::LINQ::View(numbers).Window(8).ToVector().empty());
+}
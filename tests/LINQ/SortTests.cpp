@@ -1,4 +1,12 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
 
 #include <ExtendedCpp/LINQ/Sort.h>
 
@@ -277,4 +285,521 @@ TEST(SortTests, TimSortTest)
     // Assert
     for (short i = 0; i < 4; ++i)
         ASSERT_TRUE(persons[i].Age == sortedAges[i]);
-}
\ No newline at end of file
+}
+
+TEST(SortTests, TimSortMergeTest)
+{
+    // Average
+    std::vector<std::vector<int>> keySets(4);
+    for (int key = 0; key < 100; ++key)
+        keySets[0].insert(keySets[0].end(), 30, key);
+    for (int key = 0; key < 100; ++key)
+        keySets[0].insert(keySets[0].end(), 20, key);
+    for (int key = 0; key < 100; ++key)
+        keySets[1].insert(keySets[1].end(), 20, key);
+    for (int key = 0; key < 100; ++key)
+        keySets[1].insert(keySets[1].end(), 30, key);
+    for (int run = 0; run < 6; ++run)
+    {
+        const int length = 300 + run * 250;
+        for (int i = 0; i < length; ++i)
+            keySets[2].push_back(i * 40 / length + run % 2 * 3);
+    }
+    std::mt19937 generator(7);
+    keySets[3].resize(6000);
+    for (auto& key : keySets[3])
+        key = static_cast<int>(generator() % 8);
+
+    for (const auto& keys : keySets)
+    {
+        std::vector<std::pair<int, std::size_t>> pairs(keys.size());
+        for (std::size_t i = 0; i < keys.size(); ++i)
+            pairs[i] = std::make_pair(keys[i], i);
+
+        std::vector<std::pair<int, std::size_t>> ascending = pairs;
+        std::vector<std::pair<int, std::size_t>> descending = pairs;
+        std::vector<std::pair<int, std::size_t>> expectedAscending = pairs;
+        std::vector<std::pair<int, std::size_t>> expectedDescending = pairs;
+        std::ranges::stable_sort(expectedAscending, std::less<>(), &std::pair<int, std::size_t>::first);
+        std::ranges::stable_sort(expectedDescending, std::greater<>(), &std::pair<int, std::size_t>::first);
+
+        // Act
+        ExtendedCpp::LINQ::Sort::TimSort(ascending.data(), 0, ascending.size() - 1,
+                                         [](const std::pair<int, std::size_t>& pair){ return pair.first; });
+        ExtendedCpp::LINQ::Sort::TimSort(descending.data(), 0, descending.size() - 1,
+                                         [](const std::pair<int, std::size_t>& pair){ return pair.first; },
+                                         ExtendedCpp::LINQ::OrderType::DESC);
+
+        // Assert
+        ASSERT_EQ(ascending, expectedAscending);
+        ASSERT_EQ(descending, expectedDescending);
+    }
+}
+
+TEST(SortTests, QuickSortTest3)
+{
+    // Average
+    std::mt19937 generator(42);
+    std::vector<int> random(100000);
+    for (auto& element : random)
+        element = static_cast<int>(generator() % 1000000);
+
+    std::vector<int> duplicates(100000);
+    for (auto& element : duplicates)
+        element = static_cast<int>(generator() % 4);
+
+    std::vector<int> sorted(100000);
+    for (std::size_t i = 0; i < sorted.size(); ++i)
+        sorted[i] = static_cast<int>(i);
+
+    std::vector<int> reversed(sorted.rbegin(), sorted.rend());
+
+    std::vector<int> organPipe(100000);
+    for (std::size_t i = 0; i < organPipe.size(); ++i)
+        organPipe[i] = static_cast<int>(i < organPipe.size() / 2 ? i : organPipe.size() - i);
+
+    for (const auto& source : { random, duplicates, sorted, reversed, organPipe })
+    {
+        std::vector<int> ascending = source;
+        std::vector<int> descending = source;
+        std::vector<int> expected = source;
+        std::ranges::sort(expected);
+
+        // Act
+        ExtendedCpp::LINQ::Sort::QuickSort(ascending.data(), 0, ascending.size() - 1);
+        ExtendedCpp::LINQ::Sort::QuickSort(descending.data(), 0, descending.size() - 1,
+                                           ExtendedCpp::LINQ::OrderType::DESC);
+
+        // Assert
+        ASSERT_EQ(ascending, expected);
+        std::ranges::reverse(expected);
+        ASSERT_EQ(descending, expected);
+    }
+
+    // Average
+    std::vector<std::string> strings(5000);
+    for (auto& element : strings)
+        element = std::to_string(generator() % 100);
+    std::vector<std::string> expectedStrings = strings;
+    std::ranges::sort(expectedStrings, std::greater<>());
+
+    // Act
+    ExtendedCpp::LINQ::Sort::QuickSort(strings.data(), 0, strings.size() - 1,
+                                       [](const std::string& element){ return element; },
+                                       ExtendedCpp::LINQ::OrderType::DESC);
+
+    // Assert
+    ASSERT_EQ(strings, expectedStrings);
+}
+
+TEST(SortTests, HeapSortTest)
+{
+    // Average
+    short arr[20] = { 7, 4, 2, 10, 2, -7, 50, 5, 21, 40, 25, 6, 3, -9, 18, 9, 12, 23, 10, 33 };
+    constexpr short arrCorrect[20] = { -9, -7, 2, 2, 3, 4, 5, 6, 7, 9, 10, 10, 12, 18, 21, 23, 25, 33, 40, 50 };
+
+    // Act
+    ExtendedCpp::LINQ::Sort::HeapSort(arr, 0, 19);
+
+    // Assert
+    for (short i = 0; i < 20; ++i)
+        ASSERT_TRUE(arr[i] == arrCorrect[i]);
+
+    // Act
+    ExtendedCpp::LINQ::Sort::HeapSort(arr, 0, 19, ExtendedCpp::LINQ::OrderType::DESC);
+
+    // Assert
+    for (short i = 0, j = 19; i < 20; ++i, --j)
+        ASSERT_TRUE(arr[i] == arrCorrect[j]);
+
+    // Average
+    const Person person1("Tom", 23);
+    const Person person2("Bob", 27);
+    const Person person3("Sam", 29);
+    const Person person4("Alice", 24);
+    Person persons[] = { person1, person2, person3, person4 };
+    constexpr unsigned char sortedAges[] = { 29, 27, 24, 23 };
+
+    // Act
+    ExtendedCpp::LINQ::Sort::HeapSort(persons, 0, 3, [](const Person& person){ return person.Age; }, ExtendedCpp::LINQ::OrderType::DESC);
+
+    // Assert
+    for (short i = 0; i < 4; ++i)
+        ASSERT_TRUE(persons[i].Age == sortedAges[i]);
+}
+
+TEST(SortTests, ParallelSortTest)
+{
+    // Average
+    std::mt19937 generator(42);
+    std::vector<int> random(300000);
+    for (auto& element : random)
+        element = static_cast<int>(generator() % 1000000);
+
+    std::vector<int> duplicates(300000);
+    for (auto& element : duplicates)
+        element = static_cast<int>(generator() % 4);
+
+    std::vector<int> reversed(300000);
+    for (std::size_t i = 0; i < reversed.size(); ++i)
+        reversed[i] = static_cast<int>(reversed.size() - i);
+
+    for (const auto& source : { random, duplicates, reversed })
+    {
+        std::vector<int> ascending = source;
+        std::vector<int> descending = source;
+        std::vector<int> expected = source;
+        std::ranges::sort(expected);
+
+        // Act
+        ExtendedCpp::LINQ::Sort::ParallelSort(ascending.data(), 0, ascending.size() - 1,
+                                              ExtendedCpp::LINQ::OrderType::ASC, 4);
+        ExtendedCpp::LINQ::Sort::ParallelSort(descending.data(), 0, descending.size() - 1,
+                                              [](const int element){ return element; },
+                                              ExtendedCpp::LINQ::OrderType::DESC, 3);
+
+        // Assert
+        ASSERT_EQ(ascending, expected);
+        std::ranges::reverse(expected);
+        ASSERT_EQ(descending, expected);
+    }
+}
+
+TEST(SortTests, ParallelStableSortTest)
+{
+    // Average
+    std::mt19937 generator(42);
+    std::vector<std::pair<int, std::size_t>> pairs(200000);
+    for (std::size_t i = 0; i < pairs.size(); ++i)
+        pairs[i] = std::make_pair(static_cast<int>(generator() % 100), i);
+
+    std::vector<std::pair<int, std::size_t>> ascending = pairs;
+    std::vector<std::pair<int, std::size_t>> descending = pairs;
+    std::vector<std::pair<int, std::size_t>> expectedAscending = pairs;
+    std::vector<std::pair<int, std::size_t>> expectedDescending = pairs;
+    std::ranges::stable_sort(expectedAscending, std::less<>(), &std::pair<int, std::size_t>::first);
+    std::ranges::stable_sort(expectedDescending, std::greater<>(), &std::pair<int, std::size_t>::first);
+
+    // Act
+    ExtendedCpp::LINQ::Sort::ParallelStableSort(ascending.data(), 0, ascending.size() - 1,
+                                                [](const std::pair<int, std::size_t>& pair){ return pair.first; },
+                                                ExtendedCpp::LINQ::OrderType::ASC, 4);
+    ExtendedCpp::LINQ::Sort::ParallelStableSort(descending.data(), 0, descending.size() - 1,
+                                                [](const std::pair<int, std::size_t>& pair){ return pair.first; },
+                                                ExtendedCpp::LINQ::OrderType::DESC, 5);
+
+    // Assert
+    ASSERT_EQ(ascending, expectedAscending);
+    ASSERT_EQ(descending, expectedDescending);
+
+    // Average
+    std::vector<int> numbers(100);
+    for (auto& element : numbers)
+        element = static_cast<int>(generator() % 10);
+    std::vector<int> expected = numbers;
+    std::ranges::sort(expected);
+
+    // Act
+    ExtendedCpp::LINQ::Sort::ParallelStableSort(numbers.data(), 0, numbers.size() - 1);
+
+    // Assert
+    ASSERT_EQ(numbers, expected);
+
+    // Average
+    std::vector<std::unique_ptr<std::pair<int, std::size_t>>> pointers;
+    for (const auto& pair : pairs)
+        pointers.push_back(std::make_unique<std::pair<int, std::size_t>>(pair));
+
+    // Act
+    ExtendedCpp::LINQ::Sort::ParallelStableSort(pointers, 0, pointers.size() - 1,
+                                                [](const std::unique_ptr<std::pair<int, std::size_t>>& pointer)
+                                                { return pointer->first; },
+                                                ExtendedCpp::LINQ::OrderType::ASC, 4);
+
+    // Assert
+    for (std::size_t i = 0; i < pointers.size(); ++i)
+        ASSERT_EQ(*pointers[i], expectedAscending[i]);
+}
+
+TEST(SortTests, RadixSortTest)
+{
+    // Average
+    std::mt19937_64 generator(42);
+    std::vector<std::int8_t> bytes(1000);
+    for (auto& element : bytes)
+        element = static_cast<std::int8_t>(generator());
+    std::vector<std::uint16_t> shorts(1000);
+    for (auto& element : shorts)
+        element = static_cast<std::uint16_t>(generator());
+    std::vector<int> ints(100000);
+    for (auto& element : ints)
+        element = static_cast<int>(generator() % 2000000) - 1000000;
+    std::vector<long long> longs(1000);
+    for (auto& element : longs)
+        element = static_cast<long long>(generator());
+
+    std::vector<std::int8_t> expectedBytes = bytes;
+    std::ranges::sort(expectedBytes);
+    std::vector<std::uint16_t> expectedShorts = shorts;
+    std::ranges::sort(expectedShorts, std::greater<>());
+    std::vector<int> expectedInts = ints;
+    std::ranges::sort(expectedInts);
+    std::vector<long long> expectedLongs = longs;
+    std::ranges::sort(expectedLongs, std::greater<>());
+
+    // Act
+    ExtendedCpp::LINQ::Sort::RadixSort(bytes.data(), 0, bytes.size() - 1);
+    ExtendedCpp::LINQ::Sort::RadixSort(shorts.data(), 0, shorts.size() - 1, ExtendedCpp::LINQ::OrderType::DESC);
+    ExtendedCpp::LINQ::Sort::RadixSort(ints.data(), 0, ints.size() - 1);
+    ExtendedCpp::LINQ::Sort::RadixSort(longs.data(), 0, longs.size() - 1, ExtendedCpp::LINQ::OrderType::DESC);
+
+    // Assert
+    ASSERT_EQ(bytes, expectedBytes);
+    ASSERT_EQ(shorts, expectedShorts);
+    ASSERT_EQ(ints, expectedInts);
+    ASSERT_EQ(longs, expectedLongs);
+
+    // Average
+    std::vector<double> doubles(10000);
+    for (auto& element : doubles)
+        element = static_cast<double>(static_cast<long long>(generator() % 2000000) - 1000000) / 7.0;
+    doubles[0] = -0.0;
+    doubles[1] = 0.0;
+    std::vector<float> floats(10000);
+    for (auto& element : floats)
+        element = static_cast<float>(static_cast<long long>(generator() % 2000) - 1000) / 3.0f;
+
+    std::vector<double> expectedDoubles = doubles;
+    std::ranges::sort(expectedDoubles, std::greater<>());
+    std::vector<float> expectedFloats = floats;
+    std::ranges::sort(expectedFloats);
+
+    // Act
+    ExtendedCpp::LINQ::Sort::RadixSort(doubles.data(), 0, doubles.size() - 1, ExtendedCpp::LINQ::OrderType::DESC);
+    ExtendedCpp::LINQ::Sort::RadixSort(floats.data(), 0, floats.size() - 1);
+
+    // Assert
+    ASSERT_EQ(doubles, expectedDoubles);
+    ASSERT_EQ(floats, expectedFloats);
+
+    // Average
+    std::vector<std::pair<int, std::size_t>> pairs(5000);
+    for (std::size_t i = 0; i < pairs.size(); ++i)
+        pairs[i] = std::make_pair(static_cast<int>(generator() % 100) - 50, i);
+    std::vector<std::pair<int, std::size_t>> expectedPairs = pairs;
+    std::ranges::stable_sort(expectedPairs, std::greater<>(), &std::pair<int, std::size_t>::first);
+
+    // Act
+    ExtendedCpp::LINQ::Sort::RadixSort(pairs, 0, pairs.size() - 1,
+                                       [](const std::pair<int, std::size_t>& pair){ return pair.first; },
+                                       ExtendedCpp::LINQ::OrderType::DESC);
+
+    // Assert
+    ASSERT_EQ(pairs, expectedPairs);
+}
+
+TEST(SortTests, RadixSortStringTest)
+{
+    // Average
+    std::mt19937 generator(42);
+    std::vector<std::string> strings(20000);
+    for (auto& element : strings)
+    {
+        element = "prefix";
+        element.resize(generator() % 10, 'a');
+        for (std::size_t i = generator() % 5; i > 0; --i)
+            element.push_back(static_cast<char>(generator() % 256));
+    }
+    strings[0].clear();
+
+    std::vector<std::string> ascending = strings;
+    std::vector<std::string> descending = strings;
+    std::vector<std::string> expected = strings;
+    std::ranges::sort(expected);
+
+    // Act
+    ExtendedCpp::LINQ::Sort::RadixSort(ascending, 0, ascending.size() - 1);
+    ExtendedCpp::LINQ::Sort::RadixSort(descending, 0, descending.size() - 1, ExtendedCpp::LINQ::OrderType::DESC);
+
+    // Assert
+    ASSERT_EQ(ascending, expected);
+    std::ranges::reverse(expected);
+    ASSERT_EQ(descending, expected);
+
+    // Average
+    Person people[6] = { Person("Tom", 23), Person("Bob", 27), Person("Alice", 29),
+                         Person("Bob", 24), Person("Al", 30), Person("Tom", 20) };
+
+    // Act
+    ExtendedCpp::LINQ::Sort::RadixSort(people, 0, 5, [](const Person& person){ return person.Name; });
+
+    // Assert
+    ASSERT_EQ(people[0].Name, "Al");
+    ASSERT_EQ(people[1].Name, "Alice");
+    ASSERT_EQ(people[2].Age, 27);
+    ASSERT_EQ(people[3].Age, 24);
+    ASSERT_EQ(people[4].Age, 23);
+    ASSERT_EQ(people[5].Age, 20);
+}
+
+/// @brief Key ordered by Value only, so keys with different tags are equivalent but not equal
+/// @tparam Padding Makes the key too large to be packed with its index
+template<std::size_t Padding>
+struct CoarseKey
+{
+    int Value{};
+    int Tag{};
+    std::array<char, Padding> Bytes{};
+
+    bool operator<(const CoarseKey& other) const noexcept { return Value < other.Value; }
+    bool operator>(const CoarseKey& other) const noexcept { return other < *this; }
+    bool operator<=(const CoarseKey& other) const noexcept { return !(other < *this); }
+    bool operator>=(const CoarseKey& other) const noexcept { return !(*this < other); }
+    bool operator==(const CoarseKey& other) const noexcept { return Value == other.Value && Tag == other.Tag; }
+};
+
+template<std::size_t Padding>
+void AssertSchwartzianSortIsStable(const ExtendedCpp::LINQ::OrderType orderType)
+{
+    // Average
+    std::mt19937 generator(42);
+    std::vector<std::pair<int, std::size_t>> pairs(5000);
+    for (std::size_t i = 0; i < pairs.size(); ++i)
+        pairs[i] = std::make_pair(static_cast<int>(generator() % 1000), i);
+    const auto selector = [](const std::pair<int, std::size_t>& pair){ return CoarseKey<Padding> { pair.first % 10, pair.first }; };
+    std::vector<std::pair<int, std::size_t>> expectedPairs = pairs;
+    if (orderType == ExtendedCpp::LINQ::OrderType::ASC)
+        std::ranges::stable_sort(expectedPairs, std::less<>(), selector);
+    else
+        std::ranges::stable_sort(expectedPairs, std::greater<>(), selector);
+
+    // Act
+    ExtendedCpp::LINQ::Sort::SchwartzianSort(pairs, 0, pairs.size() - 1, selector, orderType);
+
+    // Assert
+    ASSERT_EQ(pairs, expectedPairs);
+}
+
+TEST(SortTests, SchwartzianSortEquivalentKeysTest)
+{
+    AssertSchwartzianSortIsStable<0>(ExtendedCpp::LINQ::OrderType::ASC);
+    AssertSchwartzianSortIsStable<0>(ExtendedCpp::LINQ::OrderType::DESC);
+    AssertSchwartzianSortIsStable<16>(ExtendedCpp::LINQ::OrderType::ASC);
+    AssertSchwartzianSortIsStable<16>(ExtendedCpp::LINQ::OrderType::DESC);
+}
+
+TEST(SortTests, SchwartzianSortTest)
+{
+    // Average
+    std::mt19937 generator(42);
+    std::vector<std::pair<int, std::size_t>> pairs(10000);
+    for (std::size_t i = 0; i < pairs.size(); ++i)
+        pairs[i] = std::make_pair(static_cast<int>(generator() % 100), i);
+    std::vector<std::pair<int, std::size_t>> expectedPairs = pairs;
+    std::ranges::stable_sort(expectedPairs, std::greater<>(), &std::pair<int, std::size_t>::first);
+    std::size_t selectorCalls = 0;
+
+    // Act
+    ExtendedCpp::LINQ::Sort::SchwartzianSort(pairs, 0, pairs.size() - 1,
+                                             [&selectorCalls](const std::pair<int, std::size_t>& pair)
+                                             { ++selectorCalls; return pair.first; },
+                                             ExtendedCpp::LINQ::OrderType::DESC);
+
+    // Assert
+    ASSERT_EQ(pairs, expectedPairs);
+    ASSERT_EQ(selectorCalls, pairs.size());
+
+    // Average
+    Person people[6] = { Person("Tom", 23), Person("Bob", 27), Person("Alice", 29),
+                         Person("Bob", 24), Person("Al", 30), Person("Tom", 20) };
+
+    // Act
+    ExtendedCpp::LINQ::Sort::SchwartzianSort(people, 1, 5, [](const Person& person){ return person.Name; });
+
+    // Assert
+    ASSERT_EQ(people[0].Age, 23);
+    ASSERT_EQ(people[1].Name, "Al");
+    ASSERT_EQ(people[2].Name, "Alice");
+    ASSERT_EQ(people[3].Age, 27);
+    ASSERT_EQ(people[4].Age, 24);
+    ASSERT_EQ(people[5].Age, 20);
+}
+
+template<std::size_t Padding>
+void AssertSchwartzianTopKIsStable(const ExtendedCpp::LINQ::OrderType orderType, const std::size_t threadCount)
+{
+    // Average
+    std::mt19937 generator(42);
+    std::vector<std::pair<int, std::size_t>> pairs(5000);
+    for (std::size_t i = 0; i < pairs.size(); ++i)
+        pairs[i] = std::make_pair(static_cast<int>(generator() % 1000), i);
+    const auto selector = [](const std::pair<int, std::size_t>& pair){ return CoarseKey<Padding> { pair.first % 10, pair.first }; };
+    std::vector<std::pair<int, std::size_t>> expectedPairs = pairs;
+    if (orderType == ExtendedCpp::LINQ::OrderType::ASC)
+        std::ranges::stable_sort(expectedPairs, std::less<>(), selector);
+    else
+        std::ranges::stable_sort(expectedPairs, std::greater<>(), selector);
+    constexpr std::size_t count = 1200;
+
+    // Act
+    ExtendedCpp::LINQ::Sort::ParallelTopK(pairs, 0, pairs.size() - 1, count, selector, orderType, threadCount);
+
+    // Assert
+    ASSERT_TRUE(std::ranges::equal(expectedPairs.begin(), expectedPairs.begin() + count,
+                                   pairs.begin(), pairs.begin() + count));
+}
+
+TEST(SortTests, TopKEquivalentKeysTest)
+{
+    for (const std::size_t threadCount : { std::size_t { 1 }, std::size_t { 4 } })
+    {
+        AssertSchwartzianTopKIsStable<0>(ExtendedCpp::LINQ::OrderType::ASC, threadCount);
+        AssertSchwartzianTopKIsStable<0>(ExtendedCpp::LINQ::OrderType::DESC, threadCount);
+        AssertSchwartzianTopKIsStable<16>(ExtendedCpp::LINQ::OrderType::ASC, threadCount);
+        AssertSchwartzianTopKIsStable<16>(ExtendedCpp::LINQ::OrderType::DESC, threadCount);
+    }
+}
+
+TEST(SortTests, TopKTest)
+{
+    // Average
+    std::mt19937 generator(42);
+    std::vector<int> numbers(100000);
+    for (int& number : numbers)
+        number = static_cast<int>(generator() % 1000);
+    std::vector<int> sortedNumbers = numbers;
+    std::ranges::sort(sortedNumbers);
+
+    for (const std::size_t count : { std::size_t { 0 }, std::size_t { 1 }, std::size_t { 100 },
+                                     std::size_t { 50000 }, numbers.size() })
+    {
+        std::vector<int> topNumbers = numbers;
+        std::vector<int> parallelTopNumbers = numbers;
+
+        // Act
+        ExtendedCpp::LINQ::Sort::TopK(topNumbers, 0, topNumbers.size() - 1, count);
+        ExtendedCpp::LINQ::Sort::ParallelTopK(parallelTopNumbers, 0, parallelTopNumbers.size() - 1, count,
+                                              ExtendedCpp::LINQ::OrderType::ASC, 4);
+
+        // Assert
+        ASSERT_TRUE(std::ranges::equal(sortedNumbers.begin(), sortedNumbers.begin() + count,
+                                       topNumbers.begin(), topNumbers.begin() + count));
+        ASSERT_TRUE(std::ranges::equal(sortedNumbers.begin(), sortedNumbers.begin() + count,
+                                       parallelTopNumbers.begin(), parallelTopNumbers.begin() + count));
+        std::ranges::sort(topNumbers);
+        ASSERT_EQ(sortedNumbers, topNumbers);
+    }
+
+    // Average
+    Person people[6] = { Person("Tom", 23), Person("Bob", 27), Person("Alice", 29),
+                         Person("Bob", 24), Person("Al", 30), Person("Tom", 20) };
+
+    // Act
+    ExtendedCpp::LINQ::Sort::TopK(people, 0, 5, 3, [](const Person& person){ return person.Name; },
+                                  ExtendedCpp::LINQ::OrderType::DESC);
+
+    // Assert
+    ASSERT_EQ(people[0].Age, 23);
+    ASSERT_EQ(people[1].Age, 20);
+    ASSERT_EQ(people[2].Age, 27);
+}